@@ -126,6 +126,22 @@ template < class ValueType > struct container_gen< hash_multimapS, ValueType >
     typedef boost::unordered_multiset< ValueType > type;
 };
 
+// Like vecS, but the containers use Allocator (rebound to each stored
+// type), e.g. a placement_allocator.  As the VertexList selector it keeps
+// the integer vertex descriptors of vecS.
+template < class Allocator > struct vec_with_allocatorS
+{
+};
+
+template < class Allocator, class ValueType >
+struct container_gen< vec_with_allocatorS< Allocator >, ValueType >
+{
+    typedef std::vector< ValueType,
+        typename std::allocator_traits<
+            Allocator >::template rebind_alloc< ValueType > >
+        type;
+};
+
 template < class StorageSelector > struct parallel_edge_traits
 {
 };
@@ -135,6 +151,12 @@ template <> struct parallel_edge_traits< vecS >
     typedef allow_parallel_edge_tag type;
 };
 
+template < class Allocator >
+struct parallel_edge_traits< vec_with_allocatorS< Allocator > >
+{
+    typedef allow_parallel_edge_tag type;
+};
+
 template <> struct parallel_edge_traits< listS >
 {
     typedef allow_parallel_edge_tag type;
@@ -194,6 +216,15 @@ namespace detail
         };
         typedef std::true_type type;
     };
+    template < class Allocator >
+    struct is_random_access< vec_with_allocatorS< Allocator > >
+    {
+        enum
+        {
+            value = true
+        };
+        typedef std::true_type type;
+    };
 
 } // namespace detail
 
@@ -468,6 +499,13 @@ struct graph_mutability_traits< adjacency_list< OEL, vecS, D, VP, EP, GP, EL > >
 {
     typedef add_only_property_graph_tag category;
 };
+template < typename OEL, typename A, typename D, typename VP, typename EP,
+    typename GP, typename EL >
+struct graph_mutability_traits<
+    adjacency_list< OEL, vec_with_allocatorS< A >, D, VP, EP, GP, EL > >
+{
+    typedef add_only_property_graph_tag category;
+};
 #undef ADJLIST_PARAMS
 #undef ADJLIST
 
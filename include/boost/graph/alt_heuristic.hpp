@@ -0,0 +1,452 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#ifndef BOOST_GRAPH_ALT_HEURISTIC_HPP
+#define BOOST_GRAPH_ALT_HEURISTIC_HPP
+
+#include <boost/graph/astar_search.hpp>
+#include <boost/graph/dijkstra_workspace.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/graph/reverse_graph.hpp>
+#include <boost/concept/assert.hpp>
+#include <boost/limits.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace boost
+{
+
+// How alt_landmarks picks its landmarks.  farthest_landmarks repeatedly
+// takes the vertex farthest from the landmarks chosen so far;
+// avoid_landmarks (Goldberg and Werneck, "Computing point-to-point shortest
+// paths from external memory", ALENEX 2005) grows a shortest path tree from
+// a random root and takes a leaf below the subtree whose distances the
+// current landmarks bound worst.
+enum landmark_selection
+{
+    farthest_landmarks,
+    avoid_landmarks
+};
+
+namespace detail
+{
+    // Writes the distances of a finished search from landmark i to column
+    // i of a vertex-major table, as dijkstra_batch's result callback
+    template < typename Distance, typename VertexIndexMap >
+    struct alt_table_writer
+    {
+        template < typename Workspace >
+        void operator()(std::size_t i, const Workspace& ws) const
+        {
+            for (std::size_t j = 0; j < ws.reached_vertices().size(); ++j)
+            {
+                typename Workspace::vertex_descriptor v
+                    = ws.reached_vertices()[j];
+                (*table)[get(index, v) * num_landmarks + i] = ws.distance(v);
+            }
+        }
+
+        std::vector< Distance >* table;
+        std::size_t num_landmarks;
+        VertexIndexMap index;
+    };
+
+    // Records the order in which a search settles the vertices
+    template < typename Vertex >
+    struct alt_settle_recorder : public dijkstra_visitor<>
+    {
+        explicit alt_settle_recorder(std::vector< Vertex >& order)
+        : m_order(&order)
+        {
+        }
+
+        template < typename Graph > void finish_vertex(Vertex u, const Graph&)
+        {
+            m_order->push_back(u);
+        }
+
+        std::vector< Vertex >* m_order;
+    };
+
+    // A lower bound on the distance from u to t given by one landmark L,
+    // from d(u, L), d(t, L), d(L, u) and d(L, t); terms with an unknown
+    // (infinite) distance are skipped
+    template < typename Distance >
+    inline Distance alt_landmark_bound(
+        Distance to_u, Distance to_t, Distance from_u, Distance from_t)
+    {
+        const Distance inf = (std::numeric_limits< Distance >::max)();
+        Distance bound = Distance(0);
+        if (to_u != inf && to_t != inf && to_t < to_u)
+            bound = to_u - to_t;
+        if (from_u != inf && from_t != inf && from_u < from_t
+            && bound < from_t - from_u)
+            bound = from_t - from_u;
+        return bound;
+    }
+
+    // Picks the landmarks one at a time, filling in the column of each
+    // landmark in the table of distances from the landmarks as it goes
+    template < typename Graph, typename WeightMap, typename VertexIndexMap,
+        typename Distance >
+    void alt_select_landmarks(const Graph& g, std::size_t num_landmarks,
+        landmark_selection selection, WeightMap weight, VertexIndexMap index,
+        bool symmetric, std::vector< std::size_t >& landmarks,
+        std::vector< Distance >& from)
+    {
+        typedef typename graph_traits< Graph >::vertex_descriptor Vertex;
+        const Distance inf = (std::numeric_limits< Distance >::max)();
+        const std::size_t n = num_vertices(g);
+        std::vector< Vertex > vertex_of(n);
+        typename graph_traits< Graph >::vertex_iterator vi, vi_end;
+        for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+            vertex_of[get(index, *vi)] = *vi;
+
+        dijkstra_workspace< Graph, Distance, VertexIndexMap > ws(g, index);
+        alt_table_writer< Distance, VertexIndexMap > write_column
+            = { &from, num_landmarks, index };
+        // The smallest distance from a landmark to each vertex
+        std::vector< Distance > nearest(n, inf);
+        std::vector< char > is_landmark(n, 0);
+        std::vector< Vertex > order;
+        std::vector< double > size(n);
+        std::vector< std::size_t > best_child(n);
+        boost::minstd_rand gen(1);
+        boost::random::uniform_int_distribution< std::size_t > pick(0, n - 1);
+
+        // The first landmark is the vertex farthest from vertex index 0
+        ws.search(g, &vertex_of[0], &vertex_of[0] + 1, weight,
+            dijkstra_visitor<>());
+        for (std::size_t v = 0; v < n; ++v)
+            nearest[v] = ws.distance(vertex_of[v]);
+        while (landmarks.size() < num_landmarks)
+        {
+            const std::size_t k = landmarks.size();
+            // Farthest: an unreached vertex first, which covers the
+            // components no landmark reaches yet
+            std::size_t next = n;
+            for (std::size_t v = 0; v < n; ++v)
+                if (!is_landmark[v]
+                    && (next == n || nearest[next] < nearest[v]))
+                    next = v;
+
+            if (selection == avoid_landmarks && k > 0)
+            {
+                std::size_t root = pick(gen);
+                order.clear();
+                ws.search(g, &vertex_of[root], &vertex_of[root] + 1, weight,
+                    alt_settle_recorder< Vertex >(order));
+                // Weigh each vertex by how far the landmarks' bound on its
+                // distance from the root falls short, and sum the weights
+                // over the subtrees that hold no landmark
+                for (std::size_t j = 0; j < order.size(); ++j)
+                {
+                    std::size_t v = get(index, order[j]);
+                    Distance bound = Distance(0);
+                    for (std::size_t i = 0; i < k; ++i)
+                    {
+                        Distance lb = alt_landmark_bound(
+                            symmetric ? from[root * num_landmarks + i] : inf,
+                            symmetric ? from[v * num_landmarks + i] : inf,
+                            from[root * num_landmarks + i],
+                            from[v * num_landmarks + i]);
+                        bound = (std::max)(bound, lb);
+                    }
+                    Distance d = ws.distance(order[j]);
+                    size[v] = bound < d ? double(d - bound) : 0.0;
+                    if (is_landmark[v])
+                        size[v] = -1.0;
+                    best_child[v] = n;
+                }
+                // Subtrees holding a landmark get a negative size; from the
+                // root, descend to the largest subtree without one
+                for (std::size_t j = order.size(); j-- > 1;)
+                {
+                    std::size_t v = get(index, order[j]);
+                    std::size_t u = get(index, ws.predecessor(order[j]));
+                    if (size[v] < 0.0)
+                        size[u] = -1.0;
+                    else if (size[u] >= 0.0)
+                        size[u] += size[v];
+                    if (size[v] > 0.0
+                        && (best_child[u] == n
+                            || size[best_child[u]] < size[v]))
+                        best_child[u] = v;
+                }
+                std::size_t leaf = root;
+                while (best_child[leaf] != n)
+                    leaf = best_child[leaf];
+                if (leaf != root || size[root] > 0.0)
+                    next = leaf;
+            }
+
+            landmarks.push_back(next);
+            is_landmark[next] = 1;
+            ws.search(g, &vertex_of[next], &vertex_of[next] + 1, weight,
+                dijkstra_visitor<>());
+            write_column(k, ws);
+            for (std::size_t v = 0; v < n; ++v)
+                nearest[v]
+                    = (std::min)(nearest[v], from[v * num_landmarks + k]);
+        }
+    }
+
+    template < typename Graph, typename WeightMap, typename VertexIndexMap,
+        typename Distance >
+    void alt_tables_to_landmarks(const Graph&, WeightMap, VertexIndexMap,
+        std::size_t, const std::vector< std::size_t >&,
+        std::vector< Distance >&, undirected_tag)
+    {
+        // Symmetric: the distances from the landmarks serve both ways
+    }
+
+    // Searches the reversed graph from every landmark at once
+    template < typename Graph, typename WeightMap, typename VertexIndexMap,
+        typename Distance >
+    void alt_tables_to_landmarks(const Graph& g, WeightMap weight,
+        VertexIndexMap index, std::size_t num_threads,
+        const std::vector< std::size_t >& landmarks,
+        std::vector< Distance >& to, directed_tag)
+    {
+        BOOST_CONCEPT_ASSERT((BidirectionalGraphConcept< Graph >));
+        typedef typename graph_traits< Graph >::vertex_descriptor Vertex;
+        std::vector< Vertex > sources(landmarks.size());
+        typename graph_traits< Graph >::vertex_iterator vi, vi_end;
+        for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+        {
+            std::size_t v = get(index, *vi);
+            for (std::size_t i = 0; i < landmarks.size(); ++i)
+                if (landmarks[i] == v)
+                    sources[i] = *vi;
+        }
+        to.assign(num_vertices(g) * landmarks.size(),
+            (std::numeric_limits< Distance >::max)());
+        alt_table_writer< Distance, VertexIndexMap > write_column
+            = { &to, landmarks.size(), index };
+        reverse_graph< Graph > r(g);
+        dijkstra_batch(r, sources.begin(), sources.end(),
+            reverse_graph_edge_property_map< WeightMap >(weight), index,
+            num_threads, dijkstra_null_visitor_maker(), write_column);
+    }
+
+    template < typename Graph, typename RandomAccessIter, typename WeightMap,
+        typename VertexIndexMap, typename Distance >
+    void alt_tables_from_landmarks(const Graph& g, RandomAccessIter first,
+        RandomAccessIter last, WeightMap weight, VertexIndexMap index,
+        std::size_t num_threads, std::vector< Distance >& from)
+    {
+        const std::size_t k = std::size_t(last - first);
+        from.assign(
+            num_vertices(g) * k, (std::numeric_limits< Distance >::max)());
+        alt_table_writer< Distance, VertexIndexMap > write_column
+            = { &from, k, index };
+        dijkstra_batch(g, first, last, weight, index, num_threads,
+            dijkstra_null_visitor_maker(), write_column);
+    }
+} // namespace detail
+
+// Landmark distance tables for ALT search (Goldberg and Harrelson,
+// "Computing the shortest path: A* search meets graph theory", SODA 2005).
+// For each landmark L the tables hold d(L, v) and d(v, L) for every vertex
+// v, which bound d(u, t) from below by the triangle inequality; see
+// alt_heuristic.  The tables are vertex-major, so a heuristic evaluation
+// reads one contiguous row per vertex, and undirected graphs keep a single
+// table.  Unreachable entries hold the largest Distance value.
+template < typename Distance > class alt_landmarks
+{
+public:
+    alt_landmarks() : m_symmetric(true) {}
+
+    // Picks num_landmarks landmarks (at most the number of vertices) and
+    // computes their tables.  The selection runs one search at a time;
+    // the searches for the distances to the landmarks, on directed graphs,
+    // run on num_threads threads (0 for the hardware concurrency).
+    template < typename Graph, typename WeightMap, typename VertexIndexMap >
+    alt_landmarks(const Graph& g, std::size_t num_landmarks,
+        landmark_selection selection, WeightMap weight, VertexIndexMap index,
+        std::size_t num_threads = 0)
+    : m_symmetric(is_undirected(g))
+    {
+        num_landmarks
+            = (std::min)(num_landmarks, std::size_t(num_vertices(g)));
+        if (num_landmarks == 0)
+            return;
+        m_from.assign(num_vertices(g) * num_landmarks,
+            (std::numeric_limits< Distance >::max)());
+        m_landmarks.reserve(num_landmarks);
+        detail::alt_select_landmarks(g, num_landmarks, selection, weight,
+            index, m_symmetric, m_landmarks, m_from);
+        detail::alt_tables_to_landmarks(g, weight, index, num_threads,
+            m_landmarks, m_to,
+            typename graph_traits< Graph >::directed_category());
+    }
+
+    // Uses the given landmarks, running all searches on num_threads
+    // threads (0 for the hardware concurrency)
+    template < typename Graph, typename InputIter, typename WeightMap,
+        typename VertexIndexMap >
+    alt_landmarks(const Graph& g, InputIter first, InputIter last,
+        WeightMap weight, VertexIndexMap index, std::size_t num_threads = 0)
+    : m_symmetric(is_undirected(g))
+    {
+        std::vector< typename graph_traits< Graph >::vertex_descriptor >
+            sources(first, last);
+        for (std::size_t i = 0; i < sources.size(); ++i)
+            m_landmarks.push_back(get(index, sources[i]));
+        detail::alt_tables_from_landmarks(g, sources.begin(), sources.end(),
+            weight, index, num_threads, m_from);
+        detail::alt_tables_to_landmarks(g, weight, index, num_threads,
+            m_landmarks, m_to,
+            typename graph_traits< Graph >::directed_category());
+    }
+
+    std::size_t num_landmarks() const { return m_landmarks.size(); }
+
+    // The vertex index of landmark i
+    std::size_t landmark(std::size_t i) const { return m_landmarks[i]; }
+
+    // d(landmark i, v) and d(v, landmark i), by vertex index
+    Distance distance_from_landmark(std::size_t i, std::size_t v) const
+    {
+        return m_from[v * m_landmarks.size() + i];
+    }
+
+    Distance distance_to_landmark(std::size_t i, std::size_t v) const
+    {
+        return m_symmetric ? distance_from_landmark(i, v)
+                           : m_to[v * m_landmarks.size() + i];
+    }
+
+    // The lower bound on d(u, t) given by landmark i, and by all of them
+    Distance lower_bound(std::size_t i, std::size_t u, std::size_t t) const
+    {
+        return detail::alt_landmark_bound(distance_to_landmark(i, u),
+            distance_to_landmark(i, t), distance_from_landmark(i, u),
+            distance_from_landmark(i, t));
+    }
+
+    Distance lower_bound(std::size_t u, std::size_t t) const
+    {
+        Distance bound = Distance(0);
+        for (std::size_t i = 0; i < m_landmarks.size(); ++i)
+            bound = (std::max)(bound, lower_bound(i, u, t));
+        return bound;
+    }
+
+private:
+    std::vector< std::size_t > m_landmarks;
+    std::vector< Distance > m_from, m_to;
+    bool m_symmetric;
+};
+
+// The ALT heuristic for astar_search: the largest landmark lower bound on
+// the distance to the target.  It is consistent, so astar_search settles
+// each vertex once.  Restricting it to the num_active landmarks that bound
+// d(source, target) best makes each evaluation cheaper, usually for a
+// small increase in the search space.
+template < typename Graph, typename Distance,
+    typename VertexIndexMap =
+        typename property_map< Graph, vertex_index_t >::const_type >
+class alt_heuristic : public astar_heuristic< Graph, Distance >
+{
+public:
+    typedef typename graph_traits< Graph >::vertex_descriptor Vertex;
+
+    alt_heuristic(const alt_landmarks< Distance >& landmarks, Vertex target,
+        VertexIndexMap index)
+    : m_landmarks(&landmarks), m_index(index)
+    {
+        for (std::size_t i = 0; i < landmarks.num_landmarks(); ++i)
+            activate(i, get(index, target));
+    }
+
+    alt_heuristic(const alt_landmarks< Distance >& landmarks, Vertex source,
+        Vertex target, VertexIndexMap index, std::size_t num_active)
+    : m_landmarks(&landmarks), m_index(index)
+    {
+        std::size_t s = get(index, source), t = get(index, target);
+        std::vector< std::pair< Distance, std::size_t > > ranked;
+        for (std::size_t i = 0; i < landmarks.num_landmarks(); ++i)
+            ranked.push_back(
+                std::make_pair(landmarks.lower_bound(i, s, t), i));
+        num_active = (std::min)(num_active, ranked.size());
+        std::partial_sort(ranked.begin(), ranked.begin() + num_active,
+            ranked.end(), ranked_greater());
+        for (std::size_t j = 0; j < num_active; ++j)
+            activate(ranked[j].second, t);
+    }
+
+    Distance operator()(Vertex u) const
+    {
+        std::size_t v = get(m_index, u);
+        Distance bound = Distance(0);
+        for (std::size_t j = 0; j < m_active.size(); ++j)
+        {
+            std::size_t i = m_active[j];
+            bound = (std::max)(bound,
+                detail::alt_landmark_bound(
+                    m_landmarks->distance_to_landmark(i, v), m_to_target[j],
+                    m_landmarks->distance_from_landmark(i, v),
+                    m_from_target[j]));
+        }
+        return bound;
+    }
+
+private:
+    struct ranked_greater
+    {
+        bool operator()(const std::pair< Distance, std::size_t >& a,
+            const std::pair< Distance, std::size_t >& b) const
+        {
+            return b.first < a.first;
+        }
+    };
+
+    void activate(std::size_t i, std::size_t t)
+    {
+        m_active.push_back(i);
+        m_to_target.push_back(m_landmarks->distance_to_landmark(i, t));
+        m_from_target.push_back(m_landmarks->distance_from_landmark(i, t));
+    }
+
+    const alt_landmarks< Distance >* m_landmarks;
+    VertexIndexMap m_index;
+    std::vector< std::size_t > m_active;
+    std::vector< Distance > m_to_target, m_from_target;
+};
+
+template < typename Graph, typename Distance >
+alt_heuristic< Graph, Distance > make_alt_heuristic(const Graph& g,
+    const alt_landmarks< Distance >& landmarks,
+    typename graph_traits< Graph >::vertex_descriptor target)
+{
+    return alt_heuristic< Graph, Distance >(
+        landmarks, target, get(vertex_index, g));
+}
+
+template < typename Graph, typename Distance >
+alt_heuristic< Graph, Distance > make_alt_heuristic(const Graph& g,
+    const alt_landmarks< Distance >& landmarks,
+    typename graph_traits< Graph >::vertex_descriptor source,
+    typename graph_traits< Graph >::vertex_descriptor target,
+    std::size_t num_active)
+{
+    return alt_heuristic< Graph, Distance >(
+        landmarks, source, target, get(vertex_index, g), num_active);
+}
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_ALT_HEURISTIC_HPP
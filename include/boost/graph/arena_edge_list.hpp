@@ -0,0 +1,546 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// The arenaS out-edge list selector for adjacency_list.  Each out-edge list
+// keeps up to InlineEdges edges inside the vertex itself; longer lists move
+// to blocks carved from large per-thread chunks, so that a graph with millions
+// of low-degree vertices performs few allocations and its edge lists lie
+// close together in memory.
+
+#ifndef BOOST_GRAPH_ARENA_EDGE_LIST_HPP
+#define BOOST_GRAPH_ARENA_EDGE_LIST_HPP
+
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/pending/container_traits.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/throw_exception.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+#include <mutex>
+#endif
+
+namespace boost
+{
+
+// Out-edge lists stored inline for up to InlineEdges edges, and in blocks
+// of a per-thread arena beyond that.  Behaves like vecS otherwise:
+// parallel edges are allowed and out-edge iterators are random access.
+template < std::size_t InlineEdges = 4 > struct arenaS
+{
+};
+
+namespace detail
+{
+    // Power-of-two blocks of 16 bytes to 4 KiB, carved from 256 KiB chunks
+    // and recycled through one free list per size.  Each thread allocates
+    // from an arena of its own; blocks may be returned from any thread.
+    // An arena lives while its thread runs or any of its blocks is in use,
+    // and gives its chunks back to the system when both have ended.
+    // Larger blocks use operator new.
+    class edge_list_arena
+    {
+    public:
+        static const std::size_t min_block_bytes = 16;
+        static const std::size_t max_block_bytes = 4096;
+        static const std::size_t chunk_bytes = std::size_t(1) << 18;
+
+        // The arena that serves allocations of the calling thread
+        static edge_list_arena& current()
+        {
+#ifndef BOOST_NO_CXX11_THREAD_LOCAL
+            static thread_local thread_owner owner;
+            if (!owner.arena)
+                owner.arena = new edge_list_arena;
+            return *owner.arena;
+#else
+            // Without thread_local storage one arena serves the process
+            // and is kept, so that graphs with static storage duration
+            // may release their blocks during program exit
+            static edge_list_arena* arena = new edge_list_arena;
+            return *arena;
+#endif
+        }
+
+        // The block size used for a request of bytes
+        static std::size_t block_bytes(std::size_t bytes)
+        {
+            std::size_t b = min_block_bytes;
+            while (b < bytes)
+                b *= 2;
+            return b;
+        }
+
+        // bytes must be a value returned by block_bytes.  The block must
+        // be returned to this arena.
+        void* allocate(std::size_t bytes)
+        {
+            if (bytes > max_block_bytes)
+            {
+                void* p = ::operator new(bytes);
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+                std::lock_guard< std::mutex > lock(m_mutex);
+#endif
+                ++m_users;
+                return p;
+            }
+            std::size_t c = size_class(bytes);
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+            std::lock_guard< std::mutex > lock(m_mutex);
+#endif
+            free_block* b = m_free[c];
+            if (b)
+                m_free[c] = b->next;
+            else
+            {
+                if (std::size_t(m_end - m_next) < bytes)
+                {
+                    m_chunks.reserve(m_chunks.size() + 1);
+                    m_next = static_cast< char* >(::operator new(chunk_bytes));
+                    m_end = m_next + chunk_bytes;
+                    m_chunks.push_back(m_next);
+                }
+                b = reinterpret_cast< free_block* >(m_next);
+                m_next += bytes;
+            }
+            ++m_users;
+            return b;
+        }
+
+        // May destroy the arena when p was its last block in use
+        void deallocate(void* p, std::size_t bytes) BOOST_NOEXCEPT
+        {
+            if (bytes > max_block_bytes)
+                ::operator delete(p);
+            else
+            {
+                std::size_t c = size_class(bytes);
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+                std::lock_guard< std::mutex > lock(m_mutex);
+#endif
+                m_free[c] = new (p) free_block(m_free[c]);
+            }
+            release_user();
+        }
+
+        // Bytes taken from the system for chunks so far
+        std::size_t reserved_bytes() const
+        {
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+            std::lock_guard< std::mutex > lock(m_mutex);
+#endif
+            return m_chunks.size() * chunk_bytes;
+        }
+
+    private:
+        struct free_block
+        {
+            explicit free_block(free_block* n) : next(n) {}
+            free_block* next;
+        };
+
+        // Holds the thread's use of its arena until the thread exits
+        struct thread_owner
+        {
+            thread_owner() : arena(0) {}
+            ~thread_owner()
+            {
+                if (arena)
+                    arena->release_user();
+            }
+            edge_list_arena* arena;
+        };
+
+        static const std::size_t num_classes = 9;
+
+        edge_list_arena() : m_next(0), m_end(0), m_users(1)
+        {
+            for (std::size_t c = 0; c < num_classes; ++c)
+                m_free[c] = 0;
+        }
+
+        ~edge_list_arena()
+        {
+            for (std::size_t i = 0; i < m_chunks.size(); ++i)
+                ::operator delete(m_chunks[i]);
+        }
+
+        static std::size_t size_class(std::size_t bytes)
+        {
+            std::size_t c = 0;
+            for (std::size_t b = min_block_bytes; b < bytes; b *= 2)
+                ++c;
+            return c;
+        }
+
+        void release_user() BOOST_NOEXCEPT
+        {
+            bool last;
+            {
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+                std::lock_guard< std::mutex > lock(m_mutex);
+#endif
+                last = --m_users == 0;
+            }
+            if (last)
+                delete this;
+        }
+
+        free_block* m_free[num_classes];
+        char* m_next;
+        char* m_end;
+        std::vector< char* > m_chunks;
+        // Blocks in use, plus one while the owning thread runs
+        std::size_t m_users;
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+        mutable std::mutex m_mutex;
+#endif
+    };
+
+    // A vector with room for N elements inside the object, growing into
+    // edge_list_arena blocks.  Element moves are assumed not to throw, as
+    // holds for the stored edges of adjacency_list.
+    template < typename T, std::size_t N > class small_edge_vector
+    {
+        BOOST_STATIC_ASSERT(N > 0);
+        BOOST_STATIC_ASSERT(std::alignment_of< T >::value
+            <= edge_list_arena::min_block_bytes);
+
+    public:
+        typedef T value_type;
+        typedef T& reference;
+        typedef const T& const_reference;
+        typedef T* pointer;
+        typedef const T* const_pointer;
+        typedef T* iterator;
+        typedef const T* const_iterator;
+        typedef std::reverse_iterator< iterator > reverse_iterator;
+        typedef std::reverse_iterator< const_iterator > const_reverse_iterator;
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+
+        small_edge_vector() : m_size(0), m_capacity(N) {}
+
+        small_edge_vector(const small_edge_vector& x) : m_size(0), m_capacity(N)
+        {
+            append_copies(x);
+        }
+
+        small_edge_vector(small_edge_vector&& x) BOOST_NOEXCEPT
+        : m_size(0),
+          m_capacity(N)
+        {
+            take(x);
+        }
+
+        ~small_edge_vector()
+        {
+            clear();
+            release();
+        }
+
+        small_edge_vector& operator=(const small_edge_vector& x)
+        {
+            if (this != &x)
+            {
+                clear();
+                append_copies(x);
+            }
+            return *this;
+        }
+
+        small_edge_vector& operator=(small_edge_vector&& x) BOOST_NOEXCEPT
+        {
+            if (this != &x)
+            {
+                clear();
+                release();
+                take(x);
+            }
+            return *this;
+        }
+
+        iterator begin() { return data(); }
+        iterator end() { return data() + m_size; }
+        const_iterator begin() const { return data(); }
+        const_iterator end() const { return data() + m_size; }
+        reverse_iterator rbegin() { return reverse_iterator(end()); }
+        reverse_iterator rend() { return reverse_iterator(begin()); }
+        const_reverse_iterator rbegin() const
+        {
+            return const_reverse_iterator(end());
+        }
+        const_reverse_iterator rend() const
+        {
+            return const_reverse_iterator(begin());
+        }
+
+        size_type size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+        size_type capacity() const { return m_capacity; }
+        size_type max_size() const { return ~boost::uint32_t(0); }
+
+        reference operator[](size_type i) { return data()[i]; }
+        const_reference operator[](size_type i) const { return data()[i]; }
+        reference front() { return data()[0]; }
+        const_reference front() const { return data()[0]; }
+        reference back() { return data()[m_size - 1]; }
+        const_reference back() const { return data()[m_size - 1]; }
+
+        T* data() { return is_inline() ? inline_data() : m_heap.data; }
+        const T* data() const
+        {
+            return is_inline() ? inline_data() : m_heap.data;
+        }
+
+        void reserve(size_type n)
+        {
+            if (n > m_capacity)
+                grow(n);
+        }
+
+        void push_back(const T& x)
+        {
+            if (m_size == m_capacity)
+            {
+                // x may refer to an element of this vector
+                T copy(x);
+                grow(size_type(m_size) + 1);
+                new (data() + m_size) T(std::move(copy));
+            }
+            else
+                new (data() + m_size) T(x);
+            ++m_size;
+        }
+
+        void push_back(T&& x)
+        {
+            if (m_size == m_capacity)
+            {
+                T moved(std::move(x));
+                grow(size_type(m_size) + 1);
+                new (data() + m_size) T(std::move(moved));
+            }
+            else
+                new (data() + m_size) T(std::move(x));
+            ++m_size;
+        }
+
+        void pop_back()
+        {
+            --m_size;
+            data()[m_size].~T();
+        }
+
+        iterator erase(iterator pos) { return erase(pos, pos + 1); }
+
+        iterator erase(iterator first, iterator last)
+        {
+            iterator e = end();
+            iterator new_end = std::move(last, e, first);
+            for (iterator i = new_end; i != e; ++i)
+                i->~T();
+            m_size = boost::uint32_t(new_end - begin());
+            return first;
+        }
+
+        // Keeps the storage, like std::vector
+        void clear()
+        {
+            T* d = data();
+            for (boost::uint32_t i = 0; i < m_size; ++i)
+                d[i].~T();
+            m_size = 0;
+        }
+
+        // Moves a list that fits back into the object
+        void shrink_to_fit()
+        {
+            if (is_inline() || m_size > N)
+                return;
+            heap_block old_block = m_heap;
+            T* old = old_block.data;
+            std::size_t bytes = heap_bytes(m_capacity);
+            m_capacity = N;
+            for (boost::uint32_t i = 0; i < m_size; ++i)
+            {
+                new (inline_data() + i) T(std::move(old[i]));
+                old[i].~T();
+            }
+            old_block.arena->deallocate(old, bytes);
+        }
+
+        void swap(small_edge_vector& x) BOOST_NOEXCEPT
+        {
+            small_edge_vector tmp(std::move(x));
+            x = std::move(*this);
+            *this = std::move(tmp);
+        }
+
+    private:
+        bool is_inline() const { return m_capacity == N; }
+        T* inline_data() { return reinterpret_cast< T* >(&m_inline); }
+        const T* inline_data() const
+        {
+            return reinterpret_cast< const T* >(&m_inline);
+        }
+
+        static std::size_t heap_bytes(size_type capacity)
+        {
+            return edge_list_arena::block_bytes(capacity * sizeof(T));
+        }
+
+        // Moves to a block holding at least n > capacity() elements
+        void grow(size_type n)
+        {
+            if (n > max_size())
+                BOOST_THROW_EXCEPTION(
+                    std::length_error("small_edge_vector: too many edges"));
+            size_type wanted = (std::max)(n, 2 * size_type(m_capacity));
+            std::size_t bytes = heap_bytes(
+                (std::min)(wanted, size_type(max_size())));
+            edge_list_arena& arena = edge_list_arena::current();
+            T* block = static_cast< T* >(arena.allocate(bytes));
+            T* old = data();
+            for (boost::uint32_t i = 0; i < m_size; ++i)
+            {
+                new (block + i) T(std::move(old[i]));
+                old[i].~T();
+            }
+            release();
+            m_heap.data = block;
+            m_heap.arena = &arena;
+            m_capacity = boost::uint32_t(bytes / sizeof(T));
+        }
+
+        // Returns a heap block, leaving the (empty) vector inline
+        void release() BOOST_NOEXCEPT
+        {
+            if (!is_inline())
+                m_heap.arena->deallocate(
+                    m_heap.data, heap_bytes(m_capacity));
+            m_capacity = N;
+        }
+
+        // Takes the elements of x, which is left empty and inline; *this
+        // must be empty and inline
+        void take(small_edge_vector& x) BOOST_NOEXCEPT
+        {
+            if (x.is_inline())
+            {
+                for (boost::uint32_t i = 0; i < x.m_size; ++i)
+                    new (inline_data() + i) T(std::move(x.inline_data()[i]));
+                m_size = x.m_size;
+                x.clear();
+            }
+            else
+            {
+                m_heap = x.m_heap;
+                m_size = x.m_size;
+                m_capacity = x.m_capacity;
+                x.m_size = 0;
+                x.m_capacity = N;
+            }
+        }
+
+        void append_copies(const small_edge_vector& x)
+        {
+            reserve(size_type(m_size) + x.m_size);
+            for (const_iterator i = x.begin(); i != x.end(); ++i)
+                push_back(*i);
+        }
+
+        // A heap block and the arena it must be returned to
+        struct heap_block
+        {
+            T* data;
+            edge_list_arena* arena;
+        };
+
+        boost::uint32_t m_size;
+        boost::uint32_t m_capacity;
+        union
+        {
+            heap_block m_heap;
+            typename std::aligned_storage< sizeof(T) * N,
+                std::alignment_of< T >::value >::type m_inline;
+        };
+    };
+
+    template < typename T, std::size_t N >
+    void swap(small_edge_vector< T, N >& x, small_edge_vector< T, N >& y)
+    {
+        x.swap(y);
+    }
+
+    template < typename T, std::size_t N >
+    bool operator==(
+        const small_edge_vector< T, N >& x, const small_edge_vector< T, N >& y)
+    {
+        return x.size() == y.size()
+            && std::equal(x.begin(), x.end(), y.begin());
+    }
+
+    template < typename T, std::size_t N >
+    bool operator!=(
+        const small_edge_vector< T, N >& x, const small_edge_vector< T, N >& y)
+    {
+        return !(x == y);
+    }
+
+    // Found by argument-dependent lookup from the generic container
+    // functions of graph_detail
+    template < typename T, std::size_t N >
+    graph_detail::vector_tag container_category(
+        const small_edge_vector< T, N >&)
+    {
+        return graph_detail::vector_tag();
+    }
+
+    template < typename T, std::size_t N >
+    graph_detail::unstable_tag iterator_stability(
+        const small_edge_vector< T, N >&)
+    {
+        return graph_detail::unstable_tag();
+    }
+} // namespace detail
+
+namespace graph_detail
+{
+    template < typename T, std::size_t N >
+    struct container_traits< boost::detail::small_edge_vector< T, N > >
+    {
+        typedef vector_tag category;
+        typedef unstable_tag iterator_stability;
+    };
+} // namespace graph_detail
+
+template < std::size_t InlineEdges, class ValueType >
+struct container_gen< arenaS< InlineEdges >, ValueType >
+{
+    typedef detail::small_edge_vector< ValueType, InlineEdges > type;
+};
+
+template < std::size_t InlineEdges >
+struct parallel_edge_traits< arenaS< InlineEdges > >
+{
+    typedef allow_parallel_edge_tag type;
+};
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_ARENA_EDGE_LIST_HPP
@@ -22,7 +22,14 @@
 #include <type_traits>
 #include <boost/property_map/property_map.hpp>
 #include <boost/graph/named_function_params.hpp>
+#include <boost/graph/detail/parallel_for.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/throw_exception.hpp>
 #include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
 
 namespace boost
 {
@@ -585,6 +592,755 @@ void brandes_betweenness_centrality(const Graph& g, CentralityMap centrality,
         g, centrality, edge_centrality_map, get(vertex_index, g));
 }
 
+namespace detail
+{
+    namespace graph
+    {
+        /**
+         * The per-source state of Brandes' algorithm, indexed by vertex
+         * index: the incoming edges on shortest paths (P), the distances
+         * (d), the dependencies (delta) and the shortest path counts
+         * (sigma). Path counts are kept in the centrality type, which does
+         * not overflow where an integer count would. Every entry but the
+         * distance is restored as the dependencies are accumulated, so only
+         * the reached vertices are reset. The shortest-path search itself
+         * still costs O(V) per source: Dijkstra initializes every vertex,
+         * and the unweighted search allocates a color map over all of them.
+         */
+        template < typename Graph, typename Centrality,
+            typename VertexIndexMap >
+        class brandes_workspace
+        {
+        public:
+            typedef typename graph_traits< Graph >::vertex_descriptor
+                vertex_descriptor;
+            typedef
+                typename graph_traits< Graph >::edge_descriptor edge_descriptor;
+
+            brandes_workspace(const Graph& g, VertexIndexMap vertex_index)
+            : m_incoming(num_vertices(g))
+            , m_distance(num_vertices(g))
+            , m_dependency(num_vertices(g))
+            , m_path_count(num_vertices(g))
+            , m_index(vertex_index)
+            {
+            }
+
+            /**
+             * Runs the shortest paths algorithm from s, then calls
+             * add_vertex(w, delta) with the dependency of s on every other
+             * vertex w it reaches, and add_edge(e, delta) with the
+             * dependency of s on every edge e of its shortest paths.
+             */
+            template < typename ShortestPaths, typename VertexFunction,
+                typename EdgeFunction >
+            void run(const Graph& g, vertex_descriptor s,
+                ShortestPaths& shortest_paths, VertexFunction& add_vertex,
+                EdgeFunction& add_edge)
+            {
+                m_path_count[get(m_index, s)] = Centrality(1);
+                m_distance[get(m_index, s)] = Centrality(0);
+                shortest_paths(g, s, m_ordered,
+                    make_iterator_property_map(m_incoming.begin(), m_index),
+                    make_iterator_property_map(m_distance.begin(), m_index),
+                    make_iterator_property_map(m_path_count.begin(), m_index),
+                    m_index);
+
+                while (!m_ordered.empty())
+                {
+                    vertex_descriptor w = m_ordered.top();
+                    m_ordered.pop();
+                    std::size_t iw = get(m_index, w);
+                    std::vector< edge_descriptor >& incoming = m_incoming[iw];
+                    const Centrality path_count = m_path_count[iw];
+                    const Centrality dependency = m_dependency[iw];
+                    for (std::size_t i = 0; i < incoming.size(); ++i)
+                    {
+                        std::size_t iv = get(m_index, source(incoming[i], g));
+                        Centrality factor = m_path_count[iv] / path_count;
+                        factor *= (Centrality(1) + dependency);
+                        m_dependency[iv] += factor;
+                        add_edge(incoming[i], factor);
+                    }
+                    if (w != s)
+                        add_vertex(w, dependency);
+
+                    // Nothing reads the entries of w once it is popped
+                    incoming.clear();
+                    m_path_count[iw] = Centrality(0);
+                    m_dependency[iw] = Centrality(0);
+                }
+            }
+
+        private:
+            std::vector< std::vector< edge_descriptor > > m_incoming;
+            std::vector< Centrality > m_distance;
+            std::vector< Centrality > m_dependency;
+            std::vector< Centrality > m_path_count;
+            std::stack< vertex_descriptor > m_ordered;
+            VertexIndexMap m_index;
+        };
+
+        // Adds values into a vector by the index of their key
+        template < typename IndexMap, typename Centrality >
+        struct brandes_indexed_sum
+        {
+            template < typename Key >
+            void operator()(const Key& k, const Centrality& x) const
+            {
+                m_values[get(m_index, k)] += x;
+            }
+
+            Centrality* m_values;
+            IndexMap m_index;
+        };
+
+        struct brandes_ignore_sum
+        {
+            template < typename Key, typename T >
+            void operator()(const Key&, const T&) const
+            {
+            }
+        };
+
+        // The accumulator of one thread for a centrality map, and the
+        // number of values it needs; nothing for a dummy property map
+        template < typename CentralityMap, typename IndexMap,
+            typename Centrality >
+        struct brandes_accumulator
+        {
+            typedef brandes_indexed_sum< IndexMap, Centrality > type;
+
+            static std::size_t size(std::size_t n) { return n; }
+
+            static type make(std::vector< Centrality >& values, IndexMap index)
+            {
+                type sum = { values.empty() ? 0 : &values[0], index };
+                return sum;
+            }
+        };
+
+        template < typename IndexMap, typename Centrality >
+        struct brandes_accumulator< dummy_property_map, IndexMap, Centrality >
+        {
+            typedef brandes_ignore_sum type;
+
+            static std::size_t size(std::size_t) { return 0; }
+
+            static type make(std::vector< Centrality >&, IndexMap)
+            {
+                return type();
+            }
+        };
+
+        // Stores the sums of the per-thread vertex centralities, halved
+        // for undirected graphs
+        template < typename Graph, typename Vertex, typename Centrality,
+            typename CentralityMap, typename VertexIndexMap >
+        void parallel_brandes_store(const Graph&,
+            const std::vector< Vertex >& vertex_list,
+            const std::vector< std::vector< Centrality > >& sums,
+            CentralityMap centrality, VertexIndexMap vertex_index,
+            bool halve, std::size_t num_threads)
+        {
+            boost::graph::detail::parallel_for_blocks(vertex_list.size(),
+                num_threads,
+                [&](std::size_t, std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i < end; ++i)
+                    {
+                        std::size_t k = get(vertex_index, vertex_list[i]);
+                        Centrality c = sums[0][k];
+                        for (std::size_t t = 1; t < sums.size(); ++t)
+                            c += sums[t][k];
+                        if (halve)
+                            c /= Centrality(2);
+                        put(centrality, vertex_list[i], c);
+                    }
+                });
+        }
+
+        template < typename Graph, typename Vertex, typename Centrality,
+            typename VertexIndexMap >
+        void parallel_brandes_store(const Graph&, const std::vector< Vertex >&,
+            const std::vector< std::vector< Centrality > >&,
+            dummy_property_map, VertexIndexMap, bool, std::size_t)
+        {
+        }
+
+        // The same for the edge centralities
+        template < typename Graph, typename Centrality,
+            typename EdgeCentralityMap, typename EdgeIndexMap >
+        void parallel_brandes_store_edges(const Graph& g,
+            const std::vector< std::vector< Centrality > >& sums,
+            EdgeCentralityMap edge_centrality_map, EdgeIndexMap edge_index,
+            bool halve)
+        {
+            typename graph_traits< Graph >::edge_iterator e, e_end;
+            for (boost::tie(e, e_end) = edges(g); e != e_end; ++e)
+            {
+                std::size_t k = get(edge_index, *e);
+                Centrality c = sums[0][k];
+                for (std::size_t t = 1; t < sums.size(); ++t)
+                    c += sums[t][k];
+                if (halve)
+                    c /= Centrality(2);
+                put(edge_centrality_map, *e, c);
+            }
+        }
+
+        template < typename Graph, typename Centrality, typename EdgeIndexMap >
+        void parallel_brandes_store_edges(const Graph&,
+            const std::vector< std::vector< Centrality > >&,
+            dummy_property_map, EdgeIndexMap, bool)
+        {
+        }
+
+        /**
+         * Brandes' algorithm with the sources divided among num_threads
+         * threads. Each thread owns a brandes_workspace and one vector of
+         * vertex and of edge centralities, which are summed at the end.
+         * Threads take sources as they become idle, unless deterministic
+         * is set: then thread t takes the sources t, t + num_threads, ...
+         * in order, and the sums, added in thread order, are the same on
+         * every run with the same number of threads.
+         */
+        template < typename Graph, typename CentralityMap,
+            typename EdgeCentralityMap, typename VertexIndexMap,
+            typename EdgeIndexMap, typename ShortestPaths >
+        void parallel_brandes_betweenness_centrality_impl(const Graph& g,
+            CentralityMap centrality, EdgeCentralityMap edge_centrality_map,
+            VertexIndexMap vertex_index, EdgeIndexMap edge_index,
+            ShortestPaths shortest_paths, std::size_t num_threads,
+            bool deterministic)
+        {
+            typedef typename graph_traits< Graph >::vertex_descriptor
+                vertex_descriptor;
+            typedef typename std::conditional<
+                (is_same< CentralityMap, dummy_property_map >::value),
+                EdgeCentralityMap, CentralityMap >::type a_centrality_map;
+            typedef typename property_traits< a_centrality_map >::value_type
+                centrality_type;
+            typedef brandes_workspace< Graph, centrality_type,
+                VertexIndexMap >
+                workspace_type;
+            typedef brandes_accumulator< CentralityMap, VertexIndexMap,
+                centrality_type >
+                vertex_accumulator;
+            typedef brandes_accumulator< EdgeCentralityMap, EdgeIndexMap,
+                centrality_type >
+                edge_accumulator;
+
+            typename graph_traits< Graph >::vertex_iterator v, v_end;
+            boost::tie(v, v_end) = vertices(g);
+            const std::vector< vertex_descriptor > vertex_list(v, v_end);
+            const std::size_t n = vertex_list.size();
+            num_threads = (std::min)(
+                boost::graph::detail::resolve_num_threads(num_threads), n);
+            if (num_threads == 0)
+                return;
+
+            std::vector< std::vector< centrality_type > > vertex_sums(
+                num_threads,
+                std::vector< centrality_type >(vertex_accumulator::size(n)));
+            std::vector< std::vector< centrality_type > > edge_sums(
+                num_threads,
+                std::vector< centrality_type >(
+                    edge_accumulator::size(num_edges(g))));
+            // Workspaces are created by their own threads, on first use
+            std::vector< std::unique_ptr< workspace_type > > workspaces(
+                num_threads);
+
+            auto run_sources = [&](std::size_t t, std::size_t begin,
+                                   std::size_t end, std::size_t stride) {
+                if (!workspaces[t])
+                    workspaces[t].reset(new workspace_type(g, vertex_index));
+                typename vertex_accumulator::type add_vertex
+                    = vertex_accumulator::make(vertex_sums[t], vertex_index);
+                typename edge_accumulator::type add_edge
+                    = edge_accumulator::make(edge_sums[t], edge_index);
+                ShortestPaths thread_shortest_paths(shortest_paths);
+                for (std::size_t i = begin; i < end; i += stride)
+                    workspaces[t]->run(g, vertex_list[i],
+                        thread_shortest_paths, add_vertex, add_edge);
+            };
+            if (deterministic)
+                boost::graph::detail::run_in_parallel(
+                    num_threads, [&](std::size_t t) {
+                        run_sources(t, t, n, num_threads);
+                    });
+            else
+                boost::graph::detail::parallel_for_dynamic(n,
+                    std::size_t(1), num_threads,
+                    [&](std::size_t t, std::size_t begin, std::size_t end) {
+                        run_sources(t, begin, end, 1);
+                    });
+            workspaces.clear();
+
+            typedef typename graph_traits< Graph >::directed_category
+                directed_category;
+            const bool is_undirected
+                = is_convertible< directed_category*, undirected_tag* >::value;
+            parallel_brandes_store(g, vertex_list, vertex_sums, centrality,
+                vertex_index, is_undirected, num_threads);
+            parallel_brandes_store_edges(
+                g, edge_sums, edge_centrality_map, edge_index, is_undirected);
+        }
+
+        // The shortest paths function object for a weight map: Dijkstra's
+        // algorithm, or breadth-first search without weights
+        template < typename WeightMap > struct brandes_shortest_paths_for
+        {
+            typedef brandes_dijkstra_shortest_paths< WeightMap > type;
+
+            static type make(WeightMap weight_map) { return type(weight_map); }
+        };
+
+        template <> struct brandes_shortest_paths_for< param_not_found >
+        {
+            typedef brandes_unweighted_shortest_paths type;
+
+            static type make(param_not_found) { return type(); }
+        };
+
+        // The edge index map is only needed for edge centralities
+        template < typename EdgeCentralityMap >
+        struct parallel_brandes_edge_index
+        {
+            template < typename Graph, typename Param >
+            static typename boost::detail::choose_impl_result< mpl::true_,
+                Graph, Param, edge_index_t >::type
+            choose(const Graph& g, const Param& p)
+            {
+                return choose_const_pmap(p, g, edge_index);
+            }
+        };
+
+        template <>
+        struct parallel_brandes_edge_index< dummy_property_map >
+        {
+            template < typename Graph, typename Param >
+            static dummy_property_map choose(const Graph&, const Param&)
+            {
+                return dummy_property_map();
+            }
+        };
+
+        template < typename Graph, typename CentralityMap,
+            typename EdgeCentralityMap, typename Param, typename Tag,
+            typename Rest >
+        void parallel_brandes_betweenness_centrality_dispatch(const Graph& g,
+            CentralityMap centrality, EdgeCentralityMap edge_centrality_map,
+            const bgl_named_params< Param, Tag, Rest >& params)
+        {
+            typedef bgl_named_params< Param, Tag, Rest > named_params;
+            typedef typename get_param_type< edge_weight_t, named_params >::type
+                weight_map_type;
+            typedef brandes_shortest_paths_for< weight_map_type >
+                shortest_paths_for;
+
+            parallel_brandes_betweenness_centrality_impl(g, centrality,
+                edge_centrality_map,
+                choose_const_pmap(get_param(params, vertex_index), g,
+                    vertex_index),
+                parallel_brandes_edge_index< EdgeCentralityMap >::choose(
+                    g, get_param(params, edge_index)),
+                shortest_paths_for::make(get_param(params, edge_weight)),
+                choose_param(
+                    get_param(params, num_threads_t()), std::size_t(0)),
+                choose_param(
+                    get_param(params, deterministic_reduction_t()), false));
+        }
+
+    }
+} // end namespace detail::graph
+
+/**
+ * Brandes' betweenness centrality with the sources divided among
+ * num_threads threads (0 for one per hardware thread). The edge index map
+ * numbers the edges from 0 to num_edges(g) - 1; it is only used when an
+ * edge centrality map is given. With deterministic set, the result is the
+ * same on every run with the same number of threads.
+ */
+template < typename Graph, typename CentralityMap, typename EdgeCentralityMap,
+    typename VertexIndexMap, typename EdgeIndexMap, typename WeightMap >
+void parallel_brandes_betweenness_centrality(const Graph& g,
+    CentralityMap centrality, EdgeCentralityMap edge_centrality_map,
+    VertexIndexMap vertex_index, EdgeIndexMap edge_index,
+    WeightMap weight_map, std::size_t num_threads,
+    bool deterministic BOOST_GRAPH_ENABLE_IF_MODELS_PARM(
+        Graph, vertex_list_graph_tag))
+{
+    detail::graph::parallel_brandes_betweenness_centrality_impl(g,
+        centrality, edge_centrality_map, vertex_index, edge_index,
+        detail::graph::brandes_dijkstra_shortest_paths< WeightMap >(
+            weight_map),
+        num_threads, deterministic);
+}
+
+template < typename Graph, typename CentralityMap, typename EdgeCentralityMap,
+    typename VertexIndexMap, typename EdgeIndexMap >
+void parallel_brandes_betweenness_centrality(const Graph& g,
+    CentralityMap centrality, EdgeCentralityMap edge_centrality_map,
+    VertexIndexMap vertex_index, EdgeIndexMap edge_index,
+    std::size_t num_threads,
+    bool deterministic BOOST_GRAPH_ENABLE_IF_MODELS_PARM(
+        Graph, vertex_list_graph_tag))
+{
+    detail::graph::parallel_brandes_betweenness_centrality_impl(g,
+        centrality, edge_centrality_map, vertex_index, edge_index,
+        detail::graph::brandes_unweighted_shortest_paths(), num_threads,
+        deterministic);
+}
+
+template < typename Graph, typename Param, typename Tag, typename Rest >
+void parallel_brandes_betweenness_centrality(const Graph& g,
+    const bgl_named_params< Param, Tag, Rest >& params
+        BOOST_GRAPH_ENABLE_IF_MODELS_PARM(Graph, vertex_list_graph_tag))
+{
+    detail::graph::parallel_brandes_betweenness_centrality_dispatch(g,
+        choose_param(
+            get_param(params, vertex_centrality), dummy_property_map()),
+        choose_param(get_param(params, edge_centrality), dummy_property_map()),
+        params);
+}
+
+template < typename Graph, typename CentralityMap >
+typename disable_if< detail::graph::is_bgl_named_params< CentralityMap >,
+    void >::type
+parallel_brandes_betweenness_centrality(const Graph& g,
+    CentralityMap centrality BOOST_GRAPH_ENABLE_IF_MODELS_PARM(
+        Graph, vertex_list_graph_tag))
+{
+    parallel_brandes_betweenness_centrality(g, centrality_map(centrality));
+}
+
+template < typename Graph, typename CentralityMap, typename EdgeCentralityMap >
+void parallel_brandes_betweenness_centrality(const Graph& g,
+    CentralityMap centrality,
+    EdgeCentralityMap edge_centrality_map BOOST_GRAPH_ENABLE_IF_MODELS_PARM(
+        Graph, vertex_list_graph_tag))
+{
+    parallel_brandes_betweenness_centrality(g,
+        centrality_map(centrality).edge_centrality_map(edge_centrality_map));
+}
+
+// How approximate_betweenness_centrality decides how many sources to
+// sample.  uniform_sampling takes the number that Hoeffding's inequality
+// requires for every vertex; adaptive_sampling checks an empirical
+// Bernstein bound as the sample doubles and stops once it is met, which
+// takes far fewer samples when the centralities vary little.
+enum betweenness_sampling
+{
+    uniform_sampling,
+    adaptive_sampling
+};
+
+// What approximate_betweenness_centrality achieved: with probability at
+// least 1 - delta, the relative betweenness of every vertex (see
+// relative_betweenness_centrality) is within epsilon of its estimate.
+struct approximate_betweenness_result
+{
+    std::size_t samples;
+    double epsilon;
+    double delta;
+};
+
+namespace detail
+{
+    namespace graph
+    {
+        // Adds the values, and their squares, into vectors by the index of
+        // their key
+        template < typename IndexMap, typename Centrality >
+        struct brandes_moment_sum
+        {
+            template < typename Key >
+            void operator()(const Key& k, const Centrality& x) const
+            {
+                std::size_t i = get(m_index, k);
+                m_sum[i] += x;
+                m_sum_of_squares[i] += x * x;
+            }
+
+            Centrality* m_sum;
+            Centrality* m_sum_of_squares;
+            IndexMap m_index;
+        };
+
+        /**
+         * Estimates betweenness from the dependencies of sources drawn
+         * uniformly with replacement. Scaled by n / ((n - 1)(n - 2)), or
+         * twice that on directed graphs, the dependency of a random source
+         * on v is a sample in [0, n / (n - 1)], or [0, 2n / (n - 1)], whose
+         * mean is the relative betweenness of v.
+         * The sample is drawn in batches that end at the checkpoints; the
+         * checkpoints and the failure probability allotted to each are
+         * fixed in advance, so the union bound over all of them and all
+         * vertices holds wherever the sampling stops.
+         */
+        template < typename Graph, typename CentralityMap,
+            typename Generator, typename VertexIndexMap,
+            typename ShortestPaths >
+        approximate_betweenness_result approximate_betweenness_centrality_impl(
+            const Graph& g, CentralityMap centrality, double epsilon,
+            double delta, Generator& gen, betweenness_sampling sampling,
+            std::size_t max_samples, VertexIndexMap vertex_index,
+            ShortestPaths shortest_paths, std::size_t num_threads)
+        {
+            typedef typename graph_traits< Graph >::vertex_descriptor
+                vertex_descriptor;
+            typedef typename property_traits< CentralityMap >::value_type
+                centrality_type;
+            typedef brandes_workspace< Graph, centrality_type,
+                VertexIndexMap >
+                workspace_type;
+            typedef brandes_moment_sum< VertexIndexMap, centrality_type >
+                moment_sum;
+
+            if (!(epsilon > 0) || !(delta > 0 && delta < 1))
+                boost::throw_exception(std::invalid_argument(
+                    "epsilon must be positive and delta in (0, 1)."));
+
+            typename graph_traits< Graph >::vertex_iterator v, v_end;
+            boost::tie(v, v_end) = vertices(g);
+            const std::vector< vertex_descriptor > vertex_list(v, v_end);
+            const std::size_t n = vertex_list.size();
+            approximate_betweenness_result result = { 0, 0.0, delta };
+            if (n < 3)
+            {
+                for (std::size_t i = 0; i < n; ++i)
+                    put(centrality, vertex_list[i], centrality_type(0));
+                return result;
+            }
+
+            using std::ceil;
+            using std::log;
+            using std::sqrt;
+            typedef typename graph_traits< Graph >::directed_category
+                directed_category;
+            const bool is_undirected
+                = is_convertible< directed_category*, undirected_tag* >::value;
+            // Relative betweenness counts ordered pairs on directed graphs
+            // with the same 2 / ((n - 1)(n - 2)) as unordered ones
+            const double nd = double(n);
+            const double pairs = is_undirected ? 1 : 2;
+            const double range = pairs * nd / (nd - 1);
+            const double scale = pairs * nd / ((nd - 1) * (nd - 2));
+            // Hoeffding: k samples give epsilon with probability 1 - d
+            // when k >= range^2 ln(2n / d) / (2 epsilon^2)
+            const double hoeffding_delta
+                = sampling == adaptive_sampling ? delta / 2 : delta;
+            const double hoeffding_log = log(2 * nd / hoeffding_delta);
+            std::size_t last = std::size_t(
+                ceil(range * range * hoeffding_log / (2 * epsilon * epsilon)));
+            if (max_samples != 0)
+                last = (std::min)(last, max_samples);
+            last = (std::max)(last, std::size_t(2));
+            // A sample as large as the graph costs more than every source
+            // once, which gives the exact result
+            const bool exact = last >= n;
+            if (exact)
+                last = n;
+
+            std::vector< std::size_t > checkpoints;
+            if (sampling == adaptive_sampling)
+                for (std::size_t k = (std::max)(std::size_t(2),
+                         std::size_t(ceil(log(2 * nd / delta) / epsilon)));
+                     k < last; k *= 2)
+                    checkpoints.push_back(k);
+            if (!exact)
+                checkpoints.push_back(last);
+            // Empirical Bernstein (Maurer and Pontil, 2009) at every
+            // checkpoint and vertex, with delta / 2 shared among them
+            const double bernstein_log = log(8
+                * double((std::max)(checkpoints.size(), std::size_t(1))) * nd
+                / delta);
+
+            num_threads = (std::min)(
+                boost::graph::detail::resolve_num_threads(num_threads), last);
+            std::vector< std::vector< centrality_type > > sums(
+                num_threads, std::vector< centrality_type >(n));
+            std::vector< std::vector< centrality_type > > squares(
+                sampling == adaptive_sampling ? num_threads : 0,
+                std::vector< centrality_type >(n));
+            std::vector< centrality_type > total(n);
+            std::vector< std::unique_ptr< workspace_type > > workspaces(
+                num_threads);
+            std::vector< vertex_descriptor > batch;
+            boost::random::uniform_int_distribution< std::size_t > pick(
+                0, n - 1);
+            brandes_ignore_sum ignore;
+
+            std::size_t k = 0;
+            bool done = false;
+            for (std::size_t c = 0; c < checkpoints.size() && !done; ++c)
+            {
+                batch.clear();
+                for (; k < checkpoints[c]; ++k)
+                    batch.push_back(vertex_list[pick(gen)]);
+                boost::graph::detail::parallel_for_dynamic(batch.size(),
+                    std::size_t(1), num_threads,
+                    [&](std::size_t t, std::size_t begin, std::size_t end) {
+                        if (!workspaces[t])
+                            workspaces[t].reset(
+                                new workspace_type(g, vertex_index));
+                        ShortestPaths thread_shortest_paths(shortest_paths);
+                        brandes_indexed_sum< VertexIndexMap,
+                            centrality_type >
+                            add_sum = { &sums[t][0], vertex_index };
+                        moment_sum add_moments = { &sums[t][0],
+                            squares.empty() ? 0 : &squares[t][0],
+                            vertex_index };
+                        for (std::size_t i = begin; i < end; ++i)
+                            if (squares.empty())
+                                workspaces[t]->run(g, batch[i],
+                                    thread_shortest_paths, add_sum, ignore);
+                            else
+                                workspaces[t]->run(g, batch[i],
+                                    thread_shortest_paths, add_moments,
+                                    ignore);
+                    });
+
+                // Largest confidence radius over the vertices
+                std::vector< double > radius(num_threads, 0.0);
+                const double kd = double(k);
+                boost::graph::detail::parallel_for_blocks(n, num_threads,
+                    [&](std::size_t t, std::size_t begin, std::size_t end) {
+                        for (std::size_t i = begin; i < end; ++i)
+                        {
+                            centrality_type sum = sums[0][i];
+                            for (std::size_t u = 1; u < sums.size(); ++u)
+                                sum += sums[u][i];
+                            total[i] = sum;
+                            if (squares.empty())
+                                continue;
+                            double square = double(squares[0][i]);
+                            for (std::size_t u = 1; u < squares.size(); ++u)
+                                square += double(squares[u][i]);
+                            double mean = scale * double(sum) / kd;
+                            double variance
+                                = (scale * scale * square - kd * mean * mean)
+                                / (kd - 1);
+                            double r = sqrt(2 * (std::max)(variance, 0.0)
+                                           * bernstein_log / kd)
+                                + 7 * range * bernstein_log / (3 * (kd - 1));
+                            radius[t] = (std::max)(radius[t], r);
+                        }
+                    });
+                const bool last_checkpoint
+                    = !exact && c + 1 == checkpoints.size();
+                result.samples = k;
+                result.epsilon = range * sqrt(hoeffding_log / (2 * kd));
+                if (sampling == adaptive_sampling)
+                {
+                    double r
+                        = *std::max_element(radius.begin(), radius.end());
+                    if (!last_checkpoint && r > epsilon)
+                        continue;
+                    result.epsilon
+                        = last_checkpoint ? (std::min)(r, result.epsilon) : r;
+                }
+                done = true;
+            }
+            if (!done)
+            {
+                workspaces.clear();
+                sums.clear();
+                squares.clear();
+                parallel_brandes_betweenness_centrality_impl(g, centrality,
+                    dummy_property_map(), vertex_index, dummy_property_map(),
+                    shortest_paths, num_threads, false);
+                result.samples = n;
+                result.epsilon = 0.0;
+                result.delta = 0.0;
+                return result;
+            }
+
+            // Scaled to absolute betweenness, halved for undirected graphs
+            const centrality_type factor = centrality_type(nd)
+                / centrality_type(result.samples)
+                / centrality_type(is_undirected ? 2 : 1);
+            for (std::size_t i = 0; i < n; ++i)
+                put(centrality, vertex_list[i],
+                    factor * total[get(vertex_index, vertex_list[i])]);
+            return result;
+        }
+
+    }
+} // end namespace detail::graph
+
+/**
+ * Estimates the betweenness centrality of every vertex from the Brandes
+ * dependencies of randomly sampled sources, on num_threads threads (0 for
+ * one per hardware thread). The estimates are absolute centralities, like
+ * those of brandes_betweenness_centrality. The result tells how many
+ * sources were searched and the epsilon that holds with probability
+ * 1 - delta. A nonzero max_samples caps the number of sources; epsilon is
+ * then larger than requested if the cap is reached first.
+ */
+template < typename Graph, typename CentralityMap, typename Generator,
+    typename VertexIndexMap, typename WeightMap >
+approximate_betweenness_result approximate_betweenness_centrality(
+    const Graph& g, CentralityMap centrality, double epsilon, double delta,
+    Generator& gen, betweenness_sampling sampling, std::size_t max_samples,
+    VertexIndexMap vertex_index, WeightMap weight_map,
+    std::size_t num_threads BOOST_GRAPH_ENABLE_IF_MODELS_PARM(
+        Graph, vertex_list_graph_tag))
+{
+    return detail::graph::approximate_betweenness_centrality_impl(g,
+        centrality, epsilon, delta, gen, sampling, max_samples, vertex_index,
+        detail::graph::brandes_dijkstra_shortest_paths< WeightMap >(
+            weight_map),
+        num_threads);
+}
+
+template < typename Graph, typename CentralityMap, typename Generator,
+    typename VertexIndexMap >
+approximate_betweenness_result approximate_betweenness_centrality(
+    const Graph& g, CentralityMap centrality, double epsilon, double delta,
+    Generator& gen, betweenness_sampling sampling, std::size_t max_samples,
+    VertexIndexMap vertex_index,
+    std::size_t num_threads BOOST_GRAPH_ENABLE_IF_MODELS_PARM(
+        Graph, vertex_list_graph_tag))
+{
+    return detail::graph::approximate_betweenness_centrality_impl(g,
+        centrality, epsilon, delta, gen, sampling, max_samples, vertex_index,
+        detail::graph::brandes_unweighted_shortest_paths(), num_threads);
+}
+
+// Adaptive sampling without a cap; the named parameters are weight_map,
+// vertex_index_map and num_threads
+template < typename Graph, typename CentralityMap, typename Generator,
+    typename Param, typename Tag, typename Rest >
+approximate_betweenness_result approximate_betweenness_centrality(
+    const Graph& g, CentralityMap centrality, double epsilon, double delta,
+    Generator& gen,
+    const bgl_named_params< Param, Tag, Rest >& params
+        BOOST_GRAPH_ENABLE_IF_MODELS_PARM(Graph, vertex_list_graph_tag))
+{
+    typedef bgl_named_params< Param, Tag, Rest > named_params;
+    typedef typename get_param_type< edge_weight_t, named_params >::type
+        weight_map_type;
+    typedef detail::graph::brandes_shortest_paths_for< weight_map_type >
+        shortest_paths_for;
+
+    return detail::graph::approximate_betweenness_centrality_impl(g,
+        centrality, epsilon, delta, gen, adaptive_sampling, 0,
+        choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+        shortest_paths_for::make(get_param(params, edge_weight)),
+        choose_param(get_param(params, num_threads_t()), std::size_t(0)));
+}
+
+template < typename Graph, typename CentralityMap, typename Generator >
+approximate_betweenness_result approximate_betweenness_centrality(
+    const Graph& g, CentralityMap centrality, double epsilon, double delta,
+    Generator& gen BOOST_GRAPH_ENABLE_IF_MODELS_PARM(
+        Graph, vertex_list_graph_tag))
+{
+    return approximate_betweenness_centrality(g, centrality, epsilon, delta,
+        gen, vertex_index_map(get(vertex_index, g)));
+}
+
 /**
  * Converts "absolute" betweenness centrality (as computed by the
  * brandes_betweenness_centrality algorithm) in the centrality map
@@ -0,0 +1,294 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#ifndef BOOST_GRAPH_BIDIRECTIONAL_DIJKSTRA_SHORTEST_PATH_HPP
+#define BOOST_GRAPH_BIDIRECTIONAL_DIJKSTRA_SHORTEST_PATH_HPP
+
+#include <boost/graph/detail/d_ary_heap.hpp>
+#include <boost/graph/exception.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/named_function_params.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/concept/assert.hpp>
+#include <boost/limits.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/throw_exception.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace boost
+{
+
+namespace detail
+{
+    // The value type of the weight map given by named parameters
+    template < typename Graph, typename Params >
+    struct bidirectional_distance_type
+    {
+        typedef typename choose_impl_result< mpl::true_, Graph,
+            typename get_param_type< edge_weight_t, Params >::type,
+            edge_weight_t >::type weight_map;
+        typedef typename property_traits< weight_map >::value_type type;
+    };
+
+    template < typename Distance > struct bidirectional_zero_heuristic
+    {
+        template < typename Vertex > Distance operator()(Vertex) const
+        {
+            return Distance(0);
+        }
+    };
+
+    // One direction of a bidirectional search.  Vertices are keyed by
+    // 2 d(v) + h(v) - h'(v), with h estimating the distance to this
+    // search's goal and h' that to its origin, i.e. twice the distance
+    // reduced by the average potential (Ikeda et al., "A fast algorithm for
+    // finding better routes by AI search techniques", VNIS 1994), which
+    // keeps integral keys exact.  As h'(v) <= d(v), the key is computed
+    // without going below 0, for unsigned distances.
+    template < typename Distance, typename Vertex, typename ToGoal,
+        typename ToOrigin >
+    inline Distance bidirectional_key(
+        Distance d, Vertex v, ToGoal& to_goal, ToOrigin& to_origin)
+    {
+        return (d - to_origin(v)) + d + to_goal(v);
+    }
+
+    // Whether kf + kb < 2 best, i.e. whether unsettled vertices may still
+    // lie on a shorter path, evaluated without forming either sum since
+    // 2 best may exceed the range of Distance
+    template < typename Distance >
+    inline bool bidirectional_may_improve(
+        Distance kf, Distance kb, Distance best)
+    {
+        Distance lo = (std::min)(kf, kb), hi = (std::max)(kf, kb);
+        if (!(lo < best))
+            return false;
+        if (hi < best)
+            return true;
+        return hi - best < best - lo;
+    }
+
+    template < typename Graph, typename Distance, typename VertexIndexMap >
+    struct bidirectional_search_side
+    {
+        typedef typename graph_traits< Graph >::vertex_descriptor Vertex;
+        typedef iterator_property_map<
+            typename std::vector< Distance >::iterator, VertexIndexMap >
+            key_map;
+        typedef iterator_property_map< std::vector< std::size_t >::iterator,
+            VertexIndexMap >
+            index_in_heap_map;
+
+        bidirectional_search_side(std::size_t n, VertexIndexMap index)
+        : distance(n, (std::numeric_limits< Distance >::max)())
+        , key(n)
+        , parent(n)
+        , index_in_heap(n, std::size_t(-1))
+        , queue(make_iterator_property_map(key.begin(), index),
+              make_iterator_property_map(index_in_heap.begin(), index))
+        {
+        }
+
+        std::vector< Distance > distance;
+        std::vector< Distance > key;
+        std::vector< Vertex > parent;
+        std::vector< std::size_t > index_in_heap;
+        d_ary_heap_indirect< Vertex, 4, index_in_heap_map, key_map,
+            std::less< Distance > >
+            queue;
+    };
+
+    template < typename Graph, typename WeightMap, typename VertexIndexMap,
+        typename Side, typename ToGoal, typename ToOrigin >
+    void bidirectional_relax(typename graph_traits< Graph >::vertex_descriptor u,
+        typename graph_traits< Graph >::vertex_descriptor v,
+        typename property_traits< WeightMap >::value_type w,
+        VertexIndexMap index, Side& side, const Side& other,
+        ToGoal& to_goal, ToOrigin& to_origin,
+        typename property_traits< WeightMap >::value_type& best,
+        typename graph_traits< Graph >::vertex_descriptor& meet)
+    {
+        typedef typename property_traits< WeightMap >::value_type Distance;
+        const Distance inf = (std::numeric_limits< Distance >::max)();
+        if (w < Distance(0))
+            boost::throw_exception(negative_edge());
+        std::size_t iu = get(index, u), iv = get(index, v);
+        Distance d = side.distance[iu] + w;
+        if (!(d < side.distance[iv]))
+            return;
+        bool queued = side.distance[iv] != inf;
+        side.distance[iv] = d;
+        side.parent[iv] = u;
+        side.key[iv] = bidirectional_key(d, v, to_goal, to_origin);
+        if (queued)
+            side.queue.update(v);
+        else
+            side.queue.push(v);
+        if (other.distance[iv] != inf && d + other.distance[iv] < best)
+        {
+            best = d + other.distance[iv];
+            meet = v;
+        }
+    }
+
+    // Searches from s along out-edges and from t along in-edges, always
+    // advancing the side with the smaller key, until the two smallest keys
+    // show that no path through unsettled vertices beats the best one found
+    template < typename Graph, typename WeightMap, typename VertexIndexMap,
+        typename ToTarget, typename ToSource, typename OutputIterator >
+    typename property_traits< WeightMap >::value_type
+    bidirectional_shortest_path_impl(const Graph& g,
+        typename graph_traits< Graph >::vertex_descriptor s,
+        typename graph_traits< Graph >::vertex_descriptor t,
+        WeightMap weight, VertexIndexMap index, ToTarget to_target,
+        ToSource to_source, OutputIterator path)
+    {
+        BOOST_CONCEPT_ASSERT((BidirectionalGraphConcept< Graph >));
+        typedef typename graph_traits< Graph >::vertex_descriptor Vertex;
+        typedef typename property_traits< WeightMap >::value_type Distance;
+        typedef bidirectional_search_side< Graph, Distance, VertexIndexMap >
+            Side;
+        const Distance inf = (std::numeric_limits< Distance >::max)();
+
+        Side forward(num_vertices(g), index), backward(num_vertices(g), index);
+        Distance best = inf;
+        Vertex meet = s;
+        forward.distance[get(index, s)] = Distance(0);
+        forward.parent[get(index, s)] = s;
+        forward.key[get(index, s)]
+            = bidirectional_key(Distance(0), s, to_target, to_source);
+        forward.queue.push(s);
+        backward.distance[get(index, t)] = Distance(0);
+        backward.parent[get(index, t)] = t;
+        backward.key[get(index, t)]
+            = bidirectional_key(Distance(0), t, to_source, to_target);
+        backward.queue.push(t);
+        if (s == t)
+            best = Distance(0);
+
+        while (!forward.queue.empty() && !backward.queue.empty())
+        {
+            Vertex uf = forward.queue.top(), ub = backward.queue.top();
+            Distance kf = forward.key[get(index, uf)];
+            Distance kb = backward.key[get(index, ub)];
+            if (best != inf && !bidirectional_may_improve(kf, kb, best))
+                break;
+            if (!(kb < kf))
+            {
+                forward.queue.pop();
+                typename graph_traits< Graph >::out_edge_iterator ei, ei_end;
+                for (boost::tie(ei, ei_end) = out_edges(uf, g); ei != ei_end;
+                     ++ei)
+                    bidirectional_relax< Graph, WeightMap >(uf,
+                        target(*ei, g), get(weight, *ei), index, forward,
+                        backward, to_target, to_source, best, meet);
+            }
+            else
+            {
+                backward.queue.pop();
+                typename graph_traits< Graph >::in_edge_iterator ei, ei_end;
+                for (boost::tie(ei, ei_end) = in_edges(ub, g); ei != ei_end;
+                     ++ei)
+                    bidirectional_relax< Graph, WeightMap >(ub,
+                        source(*ei, g), get(weight, *ei), index, backward,
+                        forward, to_source, to_target, best, meet);
+            }
+        }
+
+        if (best == inf)
+            return inf;
+        std::vector< Vertex > half;
+        for (Vertex v = meet; v != s; v = forward.parent[get(index, v)])
+            half.push_back(v);
+        *path++ = s;
+        for (std::size_t i = half.size(); i-- > 0;)
+            *path++ = half[i];
+        for (Vertex v = meet; v != t;)
+        {
+            v = backward.parent[get(index, v)];
+            *path++ = v;
+        }
+        return best;
+    }
+} // namespace detail
+
+// Point-to-point shortest path by bidirectional Dijkstra: writes the
+// vertices of a shortest path from s to t to path, in order, and returns
+// its length, or the largest distance value (writing nothing) if t is
+// unreachable from s.
+template < typename Graph, typename WeightMap, typename VertexIndexMap,
+    typename OutputIterator >
+typename property_traits< WeightMap >::value_type
+bidirectional_dijkstra_shortest_path(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s,
+    typename graph_traits< Graph >::vertex_descriptor t, WeightMap weight,
+    VertexIndexMap index, OutputIterator path)
+{
+    typedef typename property_traits< WeightMap >::value_type Distance;
+    return detail::bidirectional_shortest_path_impl(g, s, t, weight, index,
+        detail::bidirectional_zero_heuristic< Distance >(),
+        detail::bidirectional_zero_heuristic< Distance >(), path);
+}
+
+// Named parameter version: weight_map and vertex_index_map
+template < typename Graph, typename OutputIterator, typename P, typename T,
+    typename R >
+typename detail::bidirectional_distance_type< Graph,
+    bgl_named_params< P, T, R > >::type
+bidirectional_dijkstra_shortest_path(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s,
+    typename graph_traits< Graph >::vertex_descriptor t, OutputIterator path,
+    const bgl_named_params< P, T, R >& params)
+{
+    return bidirectional_dijkstra_shortest_path(g, s, t,
+        choose_const_pmap(get_param(params, edge_weight), g, edge_weight),
+        choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+        path);
+}
+
+// Bidirectional A*: to_target(v) must estimate the distance from v to t
+// and to_source(v) that from s to v, both consistent (never decreasing by
+// more than the weight of an edge).  The two searches use their average,
+// so that each vertex is settled at most once per direction.
+template < typename Graph, typename ToTarget, typename ToSource,
+    typename WeightMap, typename VertexIndexMap, typename OutputIterator >
+typename property_traits< WeightMap >::value_type
+bidirectional_astar_shortest_path(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s,
+    typename graph_traits< Graph >::vertex_descriptor t, ToTarget to_target,
+    ToSource to_source, WeightMap weight, VertexIndexMap index,
+    OutputIterator path)
+{
+    return detail::bidirectional_shortest_path_impl(
+        g, s, t, weight, index, to_target, to_source, path);
+}
+
+// Named parameter version: weight_map and vertex_index_map
+template < typename Graph, typename ToTarget, typename ToSource,
+    typename OutputIterator, typename P, typename T, typename R >
+typename detail::bidirectional_distance_type< Graph,
+    bgl_named_params< P, T, R > >::type
+bidirectional_astar_shortest_path(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s,
+    typename graph_traits< Graph >::vertex_descriptor t, ToTarget to_target,
+    ToSource to_source, OutputIterator path,
+    const bgl_named_params< P, T, R >& params)
+{
+    return detail::bidirectional_shortest_path_impl(g, s, t,
+        choose_const_pmap(get_param(params, edge_weight), g, edge_weight),
+        choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+        to_target, to_source, path);
+}
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_BIDIRECTIONAL_DIJKSTRA_SHORTEST_PATH_HPP
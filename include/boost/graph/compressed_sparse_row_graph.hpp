@@ -14,6 +14,7 @@
 #define BOOST_GRAPH_COMPRESSED_SPARSE_ROW_GRAPH_HPP
 
 #include <vector>
+#include <memory>
 #include <utility>
 #include <algorithm>
 #include <climits>
@@ -27,6 +28,7 @@
 #include <boost/graph/filtered_graph.hpp> // For keep_all
 #include <boost/graph/detail/indexed_properties.hpp>
 #include <boost/graph/detail/compressed_sparse_row_struct.hpp>
+#include <boost/graph/detail/parallel_for.hpp>
 #include <boost/graph/iteration_macros.hpp>
 #include <boost/iterator/counting_iterator.hpp>
 #include <boost/iterator/reverse_iterator.hpp>
@@ -86,6 +88,40 @@ enum edges_are_unsorted_multi_pass_t
     edges_are_unsorted_multi_pass
 };
 
+// A type (edges_are_unsorted_parallel_t) and a value
+// (edges_are_unsorted_parallel) used to indicate that the edge list passed
+// into the CSR graph is not sorted by source vertex and is given as a
+// random-access range, so that the edges can be counted and placed by
+// several threads.  The resulting graph is identical to the one built with
+// edges_are_unsorted_multi_pass.  The default value uses one thread per
+// hardware thread; edges_are_unsorted_parallel_t(n) uses n threads.
+struct edges_are_unsorted_parallel_t
+{
+    explicit edges_are_unsorted_parallel_t(std::size_t num_threads = 0)
+    : num_threads(num_threads)
+    {
+    }
+    std::size_t num_threads;
+};
+static const edges_are_unsorted_parallel_t edges_are_unsorted_parallel
+    = edges_are_unsorted_parallel_t();
+
+// A type (in_edges_on_demand_t) and a value (in_edges_on_demand) that, passed
+// ahead of the usual constructor arguments of a bidirectional CSR graph,
+// defer building its in-edge index until in_edges or in_degree is first
+// called (or build_in_edge_index).  The index is then built once, in a
+// thread-safe way, using one thread per hardware thread by default or
+// num_threads threads with in_edges_on_demand_t(num_threads).
+struct in_edges_on_demand_t
+{
+    explicit in_edges_on_demand_t(std::size_t num_threads = 0)
+    : num_threads(num_threads)
+    {
+    }
+    std::size_t num_threads;
+};
+static const in_edges_on_demand_t in_edges_on_demand = in_edges_on_demand_t();
+
 // A type (edges_are_unsorted_multi_pass_global_t) and a value
 // (edges_are_unsorted_multi_pass_global) used to indicate that the edge list
 // passed into the CSR graph is not sorted by source vertex.  This version uses
@@ -136,24 +172,25 @@ enum edges_are_unsorted_global_t
 /****************************************************************************
  * Local helper macros to reduce typing and clutter later on.               *
  ****************************************************************************/
-#define BOOST_CSR_GRAPH_TEMPLATE_PARMS                                 \
-    typename Directed, typename VertexProperty, typename EdgeProperty, \
-        typename GraphProperty, typename Vertex, typename EdgeIndex
+#define BOOST_CSR_GRAPH_TEMPLATE_PARMS                                  \
+    typename Directed, typename VertexProperty, typename EdgeProperty,  \
+        typename GraphProperty, typename Vertex, typename EdgeIndex,    \
+        typename Allocator
 #define BOOST_CSR_GRAPH_TYPE                                             \
     compressed_sparse_row_graph< Directed, VertexProperty, EdgeProperty, \
-        GraphProperty, Vertex, EdgeIndex >
+        GraphProperty, Vertex, EdgeIndex, Allocator >
 #define BOOST_DIR_CSR_GRAPH_TEMPLATE_PARMS                                  \
     typename VertexProperty, typename EdgeProperty, typename GraphProperty, \
-        typename Vertex, typename EdgeIndex
+        typename Vertex, typename EdgeIndex, typename Allocator
 #define BOOST_DIR_CSR_GRAPH_TYPE                                          \
     compressed_sparse_row_graph< directedS, VertexProperty, EdgeProperty, \
-        GraphProperty, Vertex, EdgeIndex >
+        GraphProperty, Vertex, EdgeIndex, Allocator >
 #define BOOST_BIDIR_CSR_GRAPH_TEMPLATE_PARMS                                \
     typename VertexProperty, typename EdgeProperty, typename GraphProperty, \
-        typename Vertex, typename EdgeIndex
+        typename Vertex, typename EdgeIndex, typename Allocator
 #define BOOST_BIDIR_CSR_GRAPH_TYPE                                             \
     compressed_sparse_row_graph< bidirectionalS, VertexProperty, EdgeProperty, \
-        GraphProperty, Vertex, EdgeIndex >
+        GraphProperty, Vertex, EdgeIndex, Allocator >
 
 namespace detail
 {
@@ -197,29 +234,46 @@ namespace detail
             return t.template get< N >();
         }
     };
+
+    // Whether the in-edge index of a bidirectional CSR graph is built
+    // eagerly or on demand, and if it is currently built
+    struct csr_in_edge_index_state
+    {
+        csr_in_edge_index_state() : deferred(false), num_threads(1), built() {}
+
+        bool deferred;
+        std::size_t num_threads;
+        boost::graph::detail::lazy_init_flag built;
+    };
 }
 
 /** Compressed sparse row graph.
  *
  * Vertex and EdgeIndex should be unsigned integral types and should
- * specialize numeric_limits.
+ * specialize numeric_limits.  Allocator is rebound to allocate the vertex
+ * property, row, column and edge property arrays (see
+ * placement_allocator.hpp for allocators that control huge-page and NUMA
+ * placement).
  */
 template < typename Directed = directedS, typename VertexProperty = no_property,
     typename EdgeProperty = no_property, typename GraphProperty = no_property,
     typename Vertex = std::size_t,
-    typename EdgeIndex = Vertex >
+    typename EdgeIndex = Vertex, typename Allocator = std::allocator< bool > >
 class compressed_sparse_row_graph; // Not defined
 
 template < typename VertexProperty, typename EdgeProperty,
-    typename GraphProperty, typename Vertex, typename EdgeIndex >
+    typename GraphProperty, typename Vertex, typename EdgeIndex,
+    typename Allocator >
 class compressed_sparse_row_graph< directedS, VertexProperty, EdgeProperty,
-    GraphProperty, Vertex, EdgeIndex >
+    GraphProperty, Vertex, EdgeIndex, Allocator >
 : public detail::indexed_vertex_properties< BOOST_DIR_CSR_GRAPH_TYPE,
-      VertexProperty, Vertex, typed_identity_property_map< Vertex > >
+      VertexProperty, Vertex, typed_identity_property_map< Vertex >,
+      Allocator >
 {
 public:
     typedef detail::indexed_vertex_properties< compressed_sparse_row_graph,
-        VertexProperty, Vertex, typed_identity_property_map< Vertex > >
+        VertexProperty, Vertex, typed_identity_property_map< Vertex >,
+        Allocator >
         inherited_vertex_properties;
 
     // Some tests to prevent use of "void" is a property type (as was done in
@@ -235,7 +289,7 @@ public:
         graph_bundled;
 
     typedef detail::compressed_sparse_row_structure< EdgeProperty, Vertex,
-        EdgeIndex >
+        EdgeIndex, Allocator >
         forward_type;
 
 public:
@@ -274,7 +328,8 @@ public:
     typedef EdgeIndex degree_size_type;
 
     // For AdjacencyGraph
-    typedef typename std::vector< Vertex >::const_iterator adjacency_iterator;
+    typedef typename forward_type::column_type::const_iterator
+        adjacency_iterator;
 
     // For EdgeListGraph
     typedef detail::csr_edge_iterator< compressed_sparse_row_graph >
@@ -346,6 +401,32 @@ public:
             edge_begin, edge_end, numlocalverts, global_to_local, source_pred);
     }
 
+    //  From number of vertices and random-access range of unsorted edges,
+    //  built using several threads
+    template < typename RandomAccessIterator >
+    compressed_sparse_row_graph(edges_are_unsorted_parallel_t tag,
+        RandomAccessIterator edge_begin, RandomAccessIterator edge_end,
+        vertices_size_type numverts,
+        const GraphProperty& prop = GraphProperty())
+    : inherited_vertex_properties(numverts), m_property(prop)
+    {
+        m_forward.assign_unsorted_edges_parallel(
+            edge_begin, edge_end, numverts, tag.num_threads);
+    }
+
+    //  From number of vertices and random-access ranges of unsorted edges and
+    //  edge properties, built using several threads
+    template < typename RandomAccessIterator, typename EdgePropertyIterator >
+    compressed_sparse_row_graph(edges_are_unsorted_parallel_t tag,
+        RandomAccessIterator edge_begin, RandomAccessIterator edge_end,
+        EdgePropertyIterator ep_iter, vertices_size_type numverts,
+        const GraphProperty& prop = GraphProperty())
+    : inherited_vertex_properties(numverts), m_property(prop)
+    {
+        m_forward.assign_unsorted_edges_parallel(
+            edge_begin, edge_end, ep_iter, numverts, tag.num_threads);
+    }
+
     //  From number of vertices and unsorted list of edges, plus edge
     //  properties, with filter and global-to-local map
     template < typename MultiPassInputIterator, typename EdgePropertyIterator,
@@ -655,6 +736,18 @@ public:
         inherited_vertex_properties::resize(numverts);
     }
 
+    // Relabel each vertex v as get(perm, v), moving vertex and edge
+    // properties along
+    template < typename PermutationMap >
+    void permute_vertices_internal(const PermutationMap& perm)
+    {
+        std::vector< std::size_t > old_vertex(num_vertices(*this));
+        for (std::size_t v = 0; v < old_vertex.size(); ++v)
+            old_vertex[get(perm, Vertex(v))] = v;
+        inherited_vertex_properties::permute(old_vertex);
+        m_forward.permute_vertices(perm);
+    }
+
     // Add edges from a sorted (smallest sources first) range of pairs and edge
     // properties
     template < typename BidirectionalIteratorOrig, typename EPIterOrig,
@@ -775,12 +868,14 @@ public:
     using inherited_vertex_properties::operator[];
 
     // Directly access a edge or edge bundle
-    edge_push_back_type& operator[](const edge_descriptor& v)
+    typename forward_type::inherited_edge_properties::edge_reference
+    operator[](const edge_descriptor& v)
     {
         return m_forward.m_edge_properties[get(edge_index, *this, v)];
     }
 
-    const edge_push_back_type& operator[](const edge_descriptor& v) const
+    typename forward_type::inherited_edge_properties::const_edge_reference
+    operator[](const edge_descriptor& v) const
     {
         return m_forward.m_edge_properties[get(edge_index, *this, v)];
     }
@@ -814,15 +909,18 @@ public:
 };
 
 template < typename VertexProperty, typename EdgeProperty,
-    typename GraphProperty, typename Vertex, typename EdgeIndex >
+    typename GraphProperty, typename Vertex, typename EdgeIndex,
+    typename Allocator >
 class compressed_sparse_row_graph< bidirectionalS, VertexProperty, EdgeProperty,
-    GraphProperty, Vertex, EdgeIndex >
+    GraphProperty, Vertex, EdgeIndex, Allocator >
 : public detail::indexed_vertex_properties< BOOST_BIDIR_CSR_GRAPH_TYPE,
-      VertexProperty, Vertex, typed_identity_property_map< Vertex > >
+      VertexProperty, Vertex, typed_identity_property_map< Vertex >,
+      Allocator >
 {
 public:
     typedef detail::indexed_vertex_properties< compressed_sparse_row_graph,
-        VertexProperty, Vertex, typed_identity_property_map< Vertex > >
+        VertexProperty, Vertex, typed_identity_property_map< Vertex >,
+        Allocator >
         inherited_vertex_properties;
 
 public:
@@ -833,13 +931,13 @@ public:
     // typedef GraphProperty graph_property_type;
 
     typedef detail::compressed_sparse_row_structure< EdgeProperty, Vertex,
-        EdgeIndex >
+        EdgeIndex, Allocator >
         forward_type;
     typedef EdgeIndex /* typename boost::mpl::if_c<boost::is_same<EdgeProperty,
                          boost::no_property>, boost::no_property, EdgeIndex> */
         backward_edge_property;
     typedef detail::compressed_sparse_row_structure< backward_edge_property,
-        Vertex, EdgeIndex >
+        Vertex, EdgeIndex, Allocator >
         backward_type;
 
 public:
@@ -872,7 +970,8 @@ public:
     typedef EdgeIndex degree_size_type;
 
     // For AdjacencyGraph
-    typedef typename std::vector< Vertex >::const_iterator adjacency_iterator;
+    typedef typename forward_type::column_type::const_iterator
+        adjacency_iterator;
 
     // For EdgeListGraph
     typedef detail::csr_edge_iterator< compressed_sparse_row_graph >
@@ -907,20 +1006,37 @@ public:
     }
 
 private:
-    void set_up_backward_property_links()
+    // Rebuild the in-edge index after m_forward changed, or drop it if it is
+    // built on demand
+    void set_up_backward_property_links(std::size_t num_threads = 1)
     {
-        std::pair< edge_iterator, edge_iterator > e = edges(*this);
-        m_backward.assign_unsorted_multi_pass_edges(
-            detail::transpose_edges(detail::make_edge_to_index_pair_iter(
-                *this, get(vertex_index, *this), e.first)),
-            detail::transpose_edges(detail::make_edge_to_index_pair_iter(
-                *this, get(vertex_index, *this), e.second)),
-            boost::counting_iterator< EdgeIndex >(0),
-            m_forward.m_rowstart.size() - 1,
-            typed_identity_property_map< Vertex >(), keep_all());
+        if (m_in_edges.deferred)
+        {
+            m_in_edges.built.reset(false);
+            m_backward = backward_type();
+            return;
+        }
+        m_backward.assign_transpose_parallel(m_forward, num_threads);
     }
 
 public:
+    //  Using any of the constructors of the directed CSR graph, building the
+    //  in-edge index only when first needed
+    template < typename... Args >
+    compressed_sparse_row_graph(in_edges_on_demand_t mode, Args&&... args)
+    : m_property()
+    {
+        compressed_sparse_row_graph< directedS, VertexProperty, EdgeProperty,
+            GraphProperty, Vertex, EdgeIndex, Allocator >
+            g(std::forward< Args >(args)...);
+        inherited_vertex_properties::swap_properties(g.vertex_properties());
+        m_forward = std::move(g.m_forward);
+        m_property = g.m_property;
+        m_in_edges.deferred = true;
+        m_in_edges.num_threads = mode.num_threads;
+        set_up_backward_property_links();
+    }
+
     //  From number of vertices and unsorted list of edges
     template < typename MultiPassInputIterator >
     compressed_sparse_row_graph(edges_are_unsorted_multi_pass_t,
@@ -964,6 +1080,34 @@ public:
         set_up_backward_property_links();
     }
 
+    //  From number of vertices and random-access range of unsorted edges,
+    //  built using several threads
+    template < typename RandomAccessIterator >
+    compressed_sparse_row_graph(edges_are_unsorted_parallel_t tag,
+        RandomAccessIterator edge_begin, RandomAccessIterator edge_end,
+        vertices_size_type numverts,
+        const GraphProperty& prop = GraphProperty())
+    : inherited_vertex_properties(numverts), m_property(prop)
+    {
+        m_forward.assign_unsorted_edges_parallel(
+            edge_begin, edge_end, numverts, tag.num_threads);
+        set_up_backward_property_links(tag.num_threads);
+    }
+
+    //  From number of vertices and random-access ranges of unsorted edges and
+    //  edge properties, built using several threads
+    template < typename RandomAccessIterator, typename EdgePropertyIterator >
+    compressed_sparse_row_graph(edges_are_unsorted_parallel_t tag,
+        RandomAccessIterator edge_begin, RandomAccessIterator edge_end,
+        EdgePropertyIterator ep_iter, vertices_size_type numverts,
+        const GraphProperty& prop = GraphProperty())
+    : inherited_vertex_properties(numverts), m_property(prop)
+    {
+        m_forward.assign_unsorted_edges_parallel(
+            edge_begin, edge_end, ep_iter, numverts, tag.num_threads);
+        set_up_backward_property_links(tag.num_threads);
+    }
+
     //  From number of vertices and unsorted list of edges, plus edge
     //  properties, with filter and global-to-local map
     template < typename MultiPassInputIterator, typename EdgePropertyIterator,
@@ -1034,6 +1178,19 @@ public:
         set_up_backward_property_links();
     }
 
+    // Relabel each vertex v as get(perm, v), moving vertex and edge
+    // properties along
+    template < typename PermutationMap >
+    void permute_vertices_internal(const PermutationMap& perm)
+    {
+        std::vector< std::size_t > old_vertex(num_vertices(*this));
+        for (std::size_t v = 0; v < old_vertex.size(); ++v)
+            old_vertex[get(perm, Vertex(v))] = v;
+        inherited_vertex_properties::permute(old_vertex);
+        m_forward.permute_vertices(perm);
+        set_up_backward_property_links();
+    }
+
     // Requires the above, plus VertexListGraph and EdgeListGraph
     template < typename Graph, typename VertexIndexMap >
     void assign(const Graph& g, const VertexIndexMap& vi)
@@ -1070,16 +1227,31 @@ public:
     using inherited_vertex_properties::operator[];
 
     // Directly access a edge or edge bundle
-    edge_push_back_type& operator[](const edge_descriptor& v)
+    typename forward_type::inherited_edge_properties::edge_reference
+    operator[](const edge_descriptor& v)
     {
         return m_forward.m_edge_properties[get(edge_index, *this, v)];
     }
 
-    const edge_push_back_type& operator[](const edge_descriptor& v) const
+    typename forward_type::inherited_edge_properties::const_edge_reference
+    operator[](const edge_descriptor& v) const
     {
         return m_forward.m_edge_properties[get(edge_index, *this, v)];
     }
 
+    // The in-edge index, built first if it was deferred.  Concurrent calls
+    // are safe; only the first one builds the index.
+    const backward_type& in_edge_index() const
+    {
+        m_in_edges.built.call_once([this]() {
+            m_backward.assign_transpose_parallel(
+                m_forward, m_in_edges.num_threads);
+        });
+        return m_backward;
+    }
+
+    bool in_edge_index_built() const { return m_in_edges.built.done(); }
+
     // private: non-portable, requires friend templates
     inherited_vertex_properties& vertex_properties() { return *this; }
     const inherited_vertex_properties& vertex_properties() const
@@ -1097,7 +1269,8 @@ public:
     }
 
     forward_type m_forward;
-    backward_type m_backward;
+    mutable backward_type m_backward;
+    mutable detail::csr_in_edge_index_state m_in_edges;
     GraphProperty m_property;
 };
 
@@ -1105,7 +1278,7 @@ public:
 template < BOOST_CSR_GRAPH_TEMPLATE_PARMS >
 inline Vertex add_vertex(BOOST_CSR_GRAPH_TYPE& g)
 {
-    add_vertex(g, typename BOOST_CSR_GRAPH_TYPE::vertex_bundled());
+    return add_vertex(g, typename BOOST_CSR_GRAPH_TYPE::vertex_bundled());
 }
 
 template < BOOST_DIR_CSR_GRAPH_TEMPLATE_PARMS >
@@ -1124,7 +1297,8 @@ inline Vertex add_vertex(BOOST_BIDIR_CSR_GRAPH_TYPE& g,
 {
     Vertex old_num_verts_plus_one = g.m_forward.m_rowstart.size();
     g.m_forward.m_rowstart.push_back(g.m_forward.m_rowstart.back());
-    g.m_backward.m_rowstart.push_back(g.m_backward.m_rowstart.back());
+    if (g.in_edge_index_built())
+        g.m_backward.m_rowstart.push_back(g.m_backward.m_rowstart.back());
     g.vertex_properties().push_back(p);
     return old_num_verts_plus_one - 1;
 }
@@ -1219,6 +1393,17 @@ inline void add_edges_global(InputIterator first, InputIterator last,
     g.add_edges_internal(first, last, ep_iter, ep_iter_end, global_to_local);
 }
 
+// Relabel every vertex v of g as get(perm, v), where perm maps [0, n) onto
+// itself, rebuilding the CSR arrays and moving vertex and edge bundles with
+// their vertices and edges.  Orderings such as cuthill_mckee_ordering or
+// degree_sort_ordering produce the inverse of perm: see locality_ordering.hpp
+// for invert_permutation.
+template < BOOST_CSR_GRAPH_TEMPLATE_PARMS, typename PermutationMap >
+inline void permute_graph(BOOST_CSR_GRAPH_TYPE& g, const PermutationMap& perm)
+{
+    g.permute_vertices_internal(perm);
+}
+
 // From VertexListGraph
 template < BOOST_CSR_GRAPH_TEMPLATE_PARMS >
 inline Vertex num_vertices(const BOOST_CSR_GRAPH_TYPE& g)
@@ -1275,19 +1460,31 @@ inline std::pair< typename BOOST_BIDIR_CSR_GRAPH_TYPE::in_edge_iterator,
 in_edges(Vertex v, const BOOST_BIDIR_CSR_GRAPH_TYPE& g)
 {
     typedef typename BOOST_BIDIR_CSR_GRAPH_TYPE::in_edge_iterator it;
-    EdgeIndex v_row_start = g.m_backward.m_rowstart[v];
-    EdgeIndex next_row_start = g.m_backward.m_rowstart[v + 1];
+    const typename BOOST_BIDIR_CSR_GRAPH_TYPE::backward_type& backward
+        = g.in_edge_index();
+    EdgeIndex v_row_start = backward.m_rowstart[v];
+    EdgeIndex next_row_start = backward.m_rowstart[v + 1];
     return std::make_pair(it(g, v_row_start), it(g, next_row_start));
 }
 
 template < BOOST_BIDIR_CSR_GRAPH_TEMPLATE_PARMS >
 inline EdgeIndex in_degree(Vertex v, const BOOST_BIDIR_CSR_GRAPH_TYPE& g)
 {
-    EdgeIndex v_row_start = g.m_backward.m_rowstart[v];
-    EdgeIndex next_row_start = g.m_backward.m_rowstart[v + 1];
+    const typename BOOST_BIDIR_CSR_GRAPH_TYPE::backward_type& backward
+        = g.in_edge_index();
+    EdgeIndex v_row_start = backward.m_rowstart[v];
+    EdgeIndex next_row_start = backward.m_rowstart[v + 1];
     return next_row_start - v_row_start;
 }
 
+// Build the in-edge index of g now if it is built on demand and has not
+// been built yet, e.g. before timing or sharing g between threads
+template < BOOST_BIDIR_CSR_GRAPH_TEMPLATE_PARMS >
+inline void build_in_edge_index(const BOOST_BIDIR_CSR_GRAPH_TYPE& g)
+{
+    g.in_edge_index();
+}
+
 // From AdjacencyGraph
 template < BOOST_CSR_GRAPH_TEMPLATE_PARMS >
 inline std::pair< typename BOOST_CSR_GRAPH_TYPE::adjacency_iterator,
@@ -1331,7 +1528,8 @@ template < BOOST_CSR_GRAPH_TEMPLATE_PARMS >
 inline typename BOOST_CSR_GRAPH_TYPE::edge_descriptor edge_from_index(
     EdgeIndex idx, const BOOST_CSR_GRAPH_TYPE& g)
 {
-    typedef typename std::vector< EdgeIndex >::const_iterator row_start_iter;
+    typedef typename BOOST_CSR_GRAPH_TYPE::forward_type::rowstart_type::
+        const_iterator row_start_iter;
     BOOST_ASSERT(idx < num_edges(g));
     row_start_iter src_plus_1 = std::upper_bound(
         g.m_forward.m_rowstart.begin(), g.m_forward.m_rowstart.end(), idx);
@@ -1686,14 +1884,18 @@ get(edge_all_t, const BOOST_CSR_GRAPH_TYPE& g)
 }
 
 template < BOOST_CSR_GRAPH_TEMPLATE_PARMS >
-inline EdgeProperty& get(edge_all_t, BOOST_CSR_GRAPH_TYPE& g,
+inline typename property_traits<
+    typename property_map< BOOST_CSR_GRAPH_TYPE, edge_all_t >::type >::reference
+get(edge_all_t, BOOST_CSR_GRAPH_TYPE& g,
     const typename BOOST_CSR_GRAPH_TYPE::edge_descriptor& e)
 {
     return get(edge_all, g)[e];
 }
 
 template < BOOST_CSR_GRAPH_TEMPLATE_PARMS >
-inline const EdgeProperty& get(edge_all_t, const BOOST_CSR_GRAPH_TYPE& g,
+inline typename property_traits< typename property_map< BOOST_CSR_GRAPH_TYPE,
+    edge_all_t >::const_type >::reference
+get(edge_all_t, const BOOST_CSR_GRAPH_TYPE& g,
     const typename BOOST_CSR_GRAPH_TYPE::edge_descriptor& e)
 {
     return get(edge_all, g)[e];
@@ -1702,7 +1904,7 @@ inline const EdgeProperty& get(edge_all_t, const BOOST_CSR_GRAPH_TYPE& g,
 template < BOOST_CSR_GRAPH_TEMPLATE_PARMS >
 inline void put(edge_all_t, BOOST_CSR_GRAPH_TYPE& g,
     const typename BOOST_CSR_GRAPH_TYPE::edge_descriptor& e,
-    const EdgeProperty& val)
+    const typename BOOST_CSR_GRAPH_TYPE::edge_bundled& val)
 {
     put(get(edge_all, g), e, val);
 }
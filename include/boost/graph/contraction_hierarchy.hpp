@@ -0,0 +1,724 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#ifndef BOOST_GRAPH_CONTRACTION_HIERARCHY_HPP
+#define BOOST_GRAPH_CONTRACTION_HIERARCHY_HPP
+
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/exception.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/concept/assert.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/limits.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/throw_exception.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <queue>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace boost
+{
+
+// An arc of a contraction hierarchy.  A shortcut stands for the two arcs
+// through its middle vertex; original arcs have no middle vertex.
+template < typename Distance > struct contraction_hierarchy_arc
+{
+    Distance weight;
+    std::size_t middle;
+};
+
+template < typename Distance > class contraction_hierarchy;
+
+template < typename Distance >
+void write_contraction_hierarchy(
+    std::ostream& out, const contraction_hierarchy< Distance >& ch);
+
+template < typename Distance >
+void read_contraction_hierarchy(
+    std::istream& in, contraction_hierarchy< Distance >& ch);
+
+namespace detail
+{
+    struct ch_entry_greater
+    {
+        template < typename Entry >
+        bool operator()(const Entry& a, const Entry& b) const
+        {
+            return b.first < a.first;
+        }
+    };
+
+    // Contracts the vertices of a graph one by one, keeping the remaining
+    // graph as per-vertex arc lists in both directions
+    template < typename Distance > class ch_builder
+    {
+    public:
+        struct arc
+        {
+            std::size_t target;
+            Distance weight;
+            std::size_t middle;
+        };
+        typedef std::pair< std::size_t, std::size_t > vertex_pair;
+        typedef contraction_hierarchy_arc< Distance > hierarchy_arc;
+
+        ch_builder(std::size_t n, std::size_t witness_limit)
+        : m_out(n)
+        , m_in(n)
+        , m_contracted(n, 0)
+        , m_deleted_neighbors(n, 0)
+        , m_witness_limit(witness_limit)
+        , m_simulation_limit((std::min)(witness_limit, std::size_t(50)))
+        , m_distance(n)
+        , m_stamp(n, 0)
+        , m_target(n, 0)
+        , m_epoch(0)
+        {
+        }
+
+        // Adds the arc u -> x unless one at most as heavy is present
+        void add_arc(
+            std::size_t u, std::size_t x, Distance w, std::size_t middle)
+        {
+            if (u == x)
+                return;
+            std::vector< arc >& out = m_out[u];
+            for (std::size_t i = 0; i < out.size(); ++i)
+                if (out[i].target == x)
+                {
+                    if (w < out[i].weight)
+                    {
+                        out[i].weight = w;
+                        out[i].middle = middle;
+                        arc& back = find(m_in[x], u);
+                        back.weight = w;
+                        back.middle = middle;
+                    }
+                    return;
+                }
+            arc forward = { x, w, middle }, backward = { u, w, middle };
+            out.push_back(forward);
+            m_in[x].push_back(backward);
+        }
+
+        // Contracts every vertex, recording its rank and the arcs of the
+        // hierarchy: up arcs lead to a higher rank, and down arcs, which
+        // come from a higher rank, are recorded reversed
+        void run(std::vector< std::size_t >& rank,
+            std::vector< vertex_pair >& up_ends,
+            std::vector< hierarchy_arc >& up_arcs,
+            std::vector< vertex_pair >& down_ends,
+            std::vector< hierarchy_arc >& down_arcs)
+        {
+            typedef std::pair< long, std::size_t > entry;
+            const std::size_t n = m_out.size();
+            std::vector< long > priority(n);
+            std::priority_queue< entry, std::vector< entry >,
+                ch_entry_greater >
+                queue;
+            for (std::size_t v = 0; v < n; ++v)
+            {
+                priority[v] = compute_priority(v);
+                queue.push(entry(priority[v], v));
+            }
+            rank.assign(n, 0);
+            std::size_t next_rank = 0;
+            std::vector< std::size_t > neighbors;
+            while (!queue.empty())
+            {
+                entry top = queue.top();
+                queue.pop();
+                std::size_t v = top.second;
+                if (m_contracted[v] || top.first != priority[v])
+                    continue;
+                // Lazy update: contract v only if it is still the best,
+                // comparing with the next entry that is not outdated
+                priority[v] = compute_priority(v);
+                while (!queue.empty()
+                    && (m_contracted[queue.top().second]
+                        || queue.top().first != priority[queue.top().second]))
+                    queue.pop();
+                if (!queue.empty() && queue.top().first < priority[v])
+                {
+                    queue.push(entry(priority[v], v));
+                    continue;
+                }
+
+                contract(v, false);
+                rank[v] = next_rank++;
+                m_contracted[v] = 1;
+                neighbors.clear();
+                for (std::size_t i = 0; i < m_in[v].size(); ++i)
+                {
+                    const arc& a = m_in[v][i];
+                    down_ends.push_back(vertex_pair(v, a.target));
+                    hierarchy_arc h = { a.weight, a.middle };
+                    down_arcs.push_back(h);
+                    erase(m_out[a.target], v);
+                    neighbors.push_back(a.target);
+                }
+                for (std::size_t i = 0; i < m_out[v].size(); ++i)
+                {
+                    const arc& a = m_out[v][i];
+                    up_ends.push_back(vertex_pair(v, a.target));
+                    hierarchy_arc h = { a.weight, a.middle };
+                    up_arcs.push_back(h);
+                    erase(m_in[a.target], v);
+                    neighbors.push_back(a.target);
+                }
+                std::vector< arc >().swap(m_in[v]);
+                std::vector< arc >().swap(m_out[v]);
+
+                std::sort(neighbors.begin(), neighbors.end());
+                neighbors.erase(std::unique(neighbors.begin(), neighbors.end()),
+                    neighbors.end());
+                for (std::size_t i = 0; i < neighbors.size(); ++i)
+                {
+                    std::size_t u = neighbors[i];
+                    ++m_deleted_neighbors[u];
+                    priority[u] = compute_priority(u);
+                    queue.push(entry(priority[u], u));
+                }
+            }
+        }
+
+    private:
+        static arc& find(std::vector< arc >& arcs, std::size_t target)
+        {
+            std::size_t i = 0;
+            while (arcs[i].target != target)
+                ++i;
+            return arcs[i];
+        }
+
+        static void erase(std::vector< arc >& arcs, std::size_t target)
+        {
+            arc& a = find(arcs, target);
+            a = arcs.back();
+            arcs.pop_back();
+        }
+
+        // Edge difference plus the number of contracted neighbors, which
+        // spreads the contraction evenly over the graph
+        long compute_priority(std::size_t v)
+        {
+            long shortcuts = long(contract(v, true));
+            return shortcuts - long(m_in[v].size() + m_out[v].size())
+                + long(m_deleted_neighbors[v]);
+        }
+
+        // Counts, or adds, the shortcuts u -> x through v needed for the
+        // pairs of neighbors with no witness path avoiding v
+        std::size_t contract(std::size_t v, bool simulate)
+        {
+            std::size_t count = 0;
+            const std::vector< arc >& in = m_in[v];
+            const std::vector< arc >& out = m_out[v];
+            for (std::size_t i = 0; i < in.size(); ++i)
+            {
+                std::size_t u = in[i].target;
+                bool any = false;
+                Distance limit = Distance(0);
+                for (std::size_t j = 0; j < out.size(); ++j)
+                    if (out[j].target != u)
+                    {
+                        Distance need = in[i].weight + out[j].weight;
+                        if (!any || limit < need)
+                            limit = need;
+                        any = true;
+                    }
+                if (!any)
+                    continue;
+                start_search();
+                std::size_t targets = 0;
+                for (std::size_t j = 0; j < out.size(); ++j)
+                    if (out[j].target != u)
+                    {
+                        m_target[out[j].target] = m_epoch;
+                        ++targets;
+                    }
+                witness_search(u, v, limit, targets,
+                    simulate ? m_simulation_limit : m_witness_limit);
+                for (std::size_t j = 0; j < out.size(); ++j)
+                {
+                    std::size_t x = out[j].target;
+                    if (x == u)
+                        continue;
+                    Distance need = in[i].weight + out[j].weight;
+                    if (need < witness_distance(x))
+                    {
+                        ++count;
+                        if (!simulate)
+                            add_arc(u, x, need, v);
+                    }
+                }
+            }
+            return count;
+        }
+
+        void start_search()
+        {
+            if (++m_epoch == 0)
+            {
+                std::fill(m_stamp.begin(), m_stamp.end(), boost::uint32_t(0));
+                std::fill(
+                    m_target.begin(), m_target.end(), boost::uint32_t(0));
+                m_epoch = 1;
+            }
+        }
+
+        // Dijkstra's algorithm from u in the remaining graph without v, up
+        // to distance limit and max_settled settled vertices, or until the
+        // targets marked for this search are all settled.  Simulated
+        // contractions, which only estimate priorities, search less.
+        void witness_search(std::size_t u, std::size_t v, Distance limit,
+            std::size_t targets, std::size_t max_settled)
+        {
+            typedef std::pair< Distance, std::size_t > entry;
+            std::priority_queue< entry, std::vector< entry >,
+                ch_entry_greater >
+                queue;
+            m_stamp[u] = m_epoch;
+            m_distance[u] = Distance(0);
+            queue.push(entry(Distance(0), u));
+            std::size_t settled = 0;
+            while (!queue.empty())
+            {
+                entry top = queue.top();
+                queue.pop();
+                std::size_t y = top.second;
+                if (m_distance[y] < top.first)
+                    continue;
+                if (limit < top.first || ++settled > max_settled)
+                    break;
+                if (m_target[y] == m_epoch && --targets == 0)
+                    break;
+                const std::vector< arc >& out = m_out[y];
+                for (std::size_t i = 0; i < out.size(); ++i)
+                {
+                    std::size_t z = out[i].target;
+                    if (z == v)
+                        continue;
+                    Distance d = top.first + out[i].weight;
+                    if (m_stamp[z] != m_epoch || d < m_distance[z])
+                    {
+                        m_stamp[z] = m_epoch;
+                        m_distance[z] = d;
+                        queue.push(entry(d, z));
+                    }
+                }
+            }
+        }
+
+        Distance witness_distance(std::size_t x) const
+        {
+            return m_stamp[x] == m_epoch
+                ? m_distance[x]
+                : (std::numeric_limits< Distance >::max)();
+        }
+
+        std::vector< std::vector< arc > > m_out, m_in;
+        std::vector< char > m_contracted;
+        std::vector< std::size_t > m_deleted_neighbors;
+        std::size_t m_witness_limit;
+        std::size_t m_simulation_limit;
+        std::vector< Distance > m_distance;
+        std::vector< boost::uint32_t > m_stamp;
+        std::vector< boost::uint32_t > m_target;
+        boost::uint32_t m_epoch;
+    };
+
+    template < typename Graph, typename WeightMap, typename VertexIndexMap,
+        typename Distance >
+    void ch_contract_graph(const Graph& g, WeightMap weight,
+        VertexIndexMap index, std::size_t witness_limit,
+        std::vector< std::size_t >& rank,
+        std::vector< std::pair< std::size_t, std::size_t > >& up_ends,
+        std::vector< contraction_hierarchy_arc< Distance > >& up_arcs,
+        std::vector< std::pair< std::size_t, std::size_t > >& down_ends,
+        std::vector< contraction_hierarchy_arc< Distance > >& down_arcs)
+    {
+        BOOST_CONCEPT_ASSERT((VertexListGraphConcept< Graph >));
+        BOOST_CONCEPT_ASSERT((IncidenceGraphConcept< Graph >));
+        ch_builder< Distance > builder(num_vertices(g), witness_limit);
+        typename graph_traits< Graph >::vertex_iterator vi, vi_end;
+        for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+        {
+            typename graph_traits< Graph >::out_edge_iterator ei, ei_end;
+            for (boost::tie(ei, ei_end) = out_edges(*vi, g); ei != ei_end;
+                 ++ei)
+            {
+                Distance w = get(weight, *ei);
+                if (w < Distance(0))
+                    boost::throw_exception(negative_edge());
+                builder.add_arc(get(index, source(*ei, g)),
+                    get(index, target(*ei, g)), w, std::size_t(-1));
+            }
+        }
+        builder.run(rank, up_ends, up_arcs, down_ends, down_arcs);
+    }
+} // namespace detail
+
+// Contraction hierarchy (Geisberger, Sanders, Schultes and Delling,
+// "Contraction hierarchies: faster and simpler hierarchical routing in road
+// networks", WEA 2008) over the vertex indices of a directed or undirected
+// graph with non-negative weights.  Vertices are contracted in order of
+// rank, adding a shortcut between two neighbors whenever the path through
+// the contracted vertex may be the only shortest one.  Every shortest path
+// then has a counterpart that climbs in rank and then descends, which
+// contraction_hierarchy_query finds with two small upward searches.
+//
+// The hierarchy is kept as two compressed_sparse_row_graph overlays: the
+// upward graph holds the arcs u -> v with rank(u) < rank(v), and the
+// downward graph the arcs u -> v with rank(u) > rank(v), stored reversed
+// as v -> u so that both searches follow out-edges.
+template < typename Distance > class contraction_hierarchy
+{
+public:
+    typedef Distance distance_type;
+    typedef contraction_hierarchy_arc< Distance > arc_type;
+    typedef compressed_sparse_row_graph< directedS, no_property, arc_type >
+        overlay_type;
+
+    // Marks original arcs
+    static const std::size_t no_middle = std::size_t(-1);
+
+    contraction_hierarchy() {}
+
+    // Witness searches settle at most witness_limit vertices; a lower
+    // limit speeds up preprocessing at the cost of extra shortcuts
+    template < typename Graph, typename WeightMap, typename VertexIndexMap >
+    contraction_hierarchy(const Graph& g, WeightMap weight,
+        VertexIndexMap index, std::size_t witness_limit = 500)
+    {
+        std::vector< std::pair< std::size_t, std::size_t > > up_ends,
+            down_ends;
+        std::vector< arc_type > up_arcs, down_arcs;
+        detail::ch_contract_graph(g, weight, index, witness_limit, m_rank,
+            up_ends, up_arcs, down_ends, down_arcs);
+        assign(up_ends, up_arcs, down_ends, down_arcs);
+    }
+
+    std::size_t num_vertices() const { return m_rank.size(); }
+
+    // The position of v in the contraction order
+    std::size_t rank(std::size_t v) const { return m_rank[v]; }
+
+    const overlay_type& upward_graph() const { return m_up; }
+    const overlay_type& downward_graph() const { return m_down; }
+
+    // The arc u -> v of the hierarchy; throws bad_graph if there is none
+    const arc_type& find_arc(std::size_t u, std::size_t v) const
+    {
+        bool up = m_rank[u] < m_rank[v];
+        const overlay_type& g = up ? m_up : m_down;
+        std::size_t from = up ? u : v, to = up ? v : u;
+        typename graph_traits< overlay_type >::out_edge_iterator ei, ei_end;
+        for (boost::tie(ei, ei_end) = out_edges(from, g); ei != ei_end; ++ei)
+            if (target(*ei, g) == to)
+                return g[*ei];
+        boost::throw_exception(
+            bad_graph("contraction_hierarchy: missing arc"));
+    }
+
+    // Writes the original vertices after u along the arc u -> v
+    template < typename OutputIterator >
+    OutputIterator unpack_arc(
+        std::size_t u, std::size_t v, OutputIterator out) const
+    {
+        std::size_t middle = find_arc(u, v).middle;
+        if (middle == no_middle)
+        {
+            *out++ = v;
+            return out;
+        }
+        out = unpack_arc(u, middle, out);
+        return unpack_arc(middle, v, out);
+    }
+
+private:
+    friend void write_contraction_hierarchy< Distance >(
+        std::ostream& out, const contraction_hierarchy& ch);
+    friend void read_contraction_hierarchy< Distance >(
+        std::istream& in, contraction_hierarchy& ch);
+
+    // Down arcs are given reversed, as stored
+    void assign(
+        const std::vector< std::pair< std::size_t, std::size_t > >& up_ends,
+        const std::vector< arc_type >& up_arcs,
+        const std::vector< std::pair< std::size_t, std::size_t > >& down_ends,
+        const std::vector< arc_type >& down_arcs)
+    {
+        m_up = overlay_type(edges_are_unsorted_multi_pass, up_ends.begin(),
+            up_ends.end(), up_arcs.begin(), m_rank.size());
+        m_down = overlay_type(edges_are_unsorted_multi_pass,
+            down_ends.begin(), down_ends.end(), down_arcs.begin(),
+            m_rank.size());
+    }
+
+    std::vector< std::size_t > m_rank;
+    overlay_type m_up;
+    overlay_type m_down;
+};
+
+template < typename Distance >
+const std::size_t contraction_hierarchy< Distance >::no_middle;
+
+// Text format: a "contraction_hierarchy 1" line, the numbers of vertices,
+// up arcs and down arcs, the rank of each vertex, then one line
+// "u v weight middle" per up arc and per stored (reversed) down arc
+template < typename Distance >
+void write_contraction_hierarchy(
+    std::ostream& out, const contraction_hierarchy< Distance >& ch)
+{
+    typedef typename contraction_hierarchy< Distance >::overlay_type Overlay;
+    std::streamsize precision = out.precision();
+    out.precision(std::numeric_limits< Distance >::max_digits10);
+    out << "contraction_hierarchy 1\n"
+        << ch.m_rank.size() << ' ' << num_edges(ch.m_up) << ' '
+        << num_edges(ch.m_down) << '\n';
+    for (std::size_t v = 0; v < ch.m_rank.size(); ++v)
+        out << ch.m_rank[v] << (v + 1 < ch.m_rank.size() ? ' ' : '\n');
+    const Overlay* overlays[] = { &ch.m_up, &ch.m_down };
+    for (std::size_t k = 0; k < 2; ++k)
+    {
+        const Overlay& g = *overlays[k];
+        typename graph_traits< Overlay >::edge_iterator ei, ei_end;
+        for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei)
+            out << source(*ei, g) << ' ' << target(*ei, g) << ' '
+                << g[*ei].weight << ' ' << std::ptrdiff_t(g[*ei].middle)
+                << '\n';
+    }
+    out.precision(precision);
+}
+
+// Reads a hierarchy written by write_contraction_hierarchy; throws
+// bad_graph if the input is malformed
+template < typename Distance >
+void read_contraction_hierarchy(
+    std::istream& in, contraction_hierarchy< Distance >& ch)
+{
+    typedef contraction_hierarchy_arc< Distance > Arc;
+    std::string magic;
+    int version = 0;
+    std::size_t n = 0, m[2] = { 0, 0 };
+    if (!(in >> magic >> version >> n >> m[0] >> m[1])
+        || magic != "contraction_hierarchy" || version != 1)
+        boost::throw_exception(
+            bad_graph("read_contraction_hierarchy: bad header"));
+    std::vector< std::size_t > rank(n);
+    for (std::size_t v = 0; v < n; ++v)
+        if (!(in >> rank[v]) || rank[v] >= n)
+            boost::throw_exception(
+                bad_graph("read_contraction_hierarchy: bad rank"));
+    std::vector< std::pair< std::size_t, std::size_t > > ends[2];
+    std::vector< Arc > arcs[2];
+    for (std::size_t k = 0; k < 2; ++k)
+        for (std::size_t i = 0; i < m[k]; ++i)
+        {
+            std::size_t u, v;
+            std::ptrdiff_t middle;
+            Arc a;
+            if (!(in >> u >> v >> a.weight >> middle) || u >= n || v >= n
+                || middle < -1 || middle >= std::ptrdiff_t(n))
+                boost::throw_exception(
+                    bad_graph("read_contraction_hierarchy: bad arc"));
+            a.middle = std::size_t(middle);
+            ends[k].push_back(std::make_pair(u, v));
+            arcs[k].push_back(a);
+        }
+
+    // The ranks must be a permutation, and both overlays store each arc
+    // from its lower to its higher ranked end
+    std::vector< bool > seen(n, false);
+    for (std::size_t v = 0; v < n; ++v)
+    {
+        if (seen[rank[v]])
+            boost::throw_exception(
+                bad_graph("read_contraction_hierarchy: bad rank"));
+        seen[rank[v]] = true;
+    }
+    std::vector< std::pair< std::size_t, std::size_t > > sorted[2];
+    for (std::size_t k = 0; k < 2; ++k)
+    {
+        for (std::size_t i = 0; i < m[k]; ++i)
+            if (!(rank[ends[k][i].first] < rank[ends[k][i].second]))
+                boost::throw_exception(bad_graph(
+                    "read_contraction_hierarchy: arc against the ranks"));
+        sorted[k] = ends[k];
+        std::sort(sorted[k].begin(), sorted[k].end());
+    }
+    // A shortcut u -> v through middle replaces the arcs u -> middle and
+    // middle -> v, and middle is ranked below u and v, so that unpacking
+    // ends
+    for (std::size_t k = 0; k < 2; ++k)
+        for (std::size_t i = 0; i < m[k]; ++i)
+        {
+            std::size_t middle = arcs[k][i].middle;
+            if (middle == contraction_hierarchy< Distance >::no_middle)
+                continue;
+            std::size_t u = ends[k][i].first, v = ends[k][i].second;
+            if (k == 1)
+                std::swap(u, v);
+            std::size_t halves[2][2] = { { u, middle }, { middle, v } };
+            bool ok = rank[middle] < rank[u] && rank[middle] < rank[v];
+            for (std::size_t h = 0; h < 2 && ok; ++h)
+            {
+                std::size_t from = halves[h][0], to = halves[h][1];
+                std::size_t j = rank[from] < rank[to] ? 0 : 1;
+                std::pair< std::size_t, std::size_t > stored = j == 0
+                    ? std::make_pair(from, to)
+                    : std::make_pair(to, from);
+                ok = std::binary_search(
+                    sorted[j].begin(), sorted[j].end(), stored);
+            }
+            if (!ok)
+                boost::throw_exception(bad_graph(
+                    "read_contraction_hierarchy: bad shortcut"));
+        }
+    ch.m_rank.swap(rank);
+    ch.assign(ends[0], arcs[0], ends[1], arcs[1]);
+}
+
+// Point-to-point queries on a contraction hierarchy: a forward search from
+// s over the upward graph and a backward search from t over the downward
+// graph, each stopping once its smallest distance reaches the best path
+// found.  A query object keeps its scratch arrays between queries and
+// resets them lazily; use one per thread.
+template < typename Distance > class contraction_hierarchy_query
+{
+public:
+    explicit contraction_hierarchy_query(
+        const contraction_hierarchy< Distance >& ch)
+    : m_ch(&ch), m_epoch(0), m_meet(0)
+    {
+        for (std::size_t k = 0; k < 2; ++k)
+        {
+            m_distance[k].resize(ch.num_vertices());
+            m_parent[k].resize(ch.num_vertices());
+            m_stamp[k].resize(ch.num_vertices(), 0);
+        }
+    }
+
+    // The length of a shortest path from s to t, or the largest Distance
+    // if there is none
+    Distance distance(std::size_t s, std::size_t t)
+    {
+        typedef std::pair< Distance, std::size_t > entry;
+        typedef typename contraction_hierarchy< Distance >::overlay_type
+            Overlay;
+        const Distance inf = (std::numeric_limits< Distance >::max)();
+        if (++m_epoch == 0)
+        {
+            for (std::size_t k = 0; k < 2; ++k)
+                std::fill(m_stamp[k].begin(), m_stamp[k].end(),
+                    boost::uint32_t(0));
+            m_epoch = 1;
+        }
+        std::priority_queue< entry, std::vector< entry >,
+            detail::ch_entry_greater >
+            queue[2];
+        const Overlay* overlays[]
+            = { &m_ch->upward_graph(), &m_ch->downward_graph() };
+        std::size_t ends[] = { s, t };
+        for (std::size_t k = 0; k < 2; ++k)
+        {
+            m_stamp[k][ends[k]] = m_epoch;
+            m_distance[k][ends[k]] = Distance(0);
+            m_parent[k][ends[k]] = ends[k];
+            queue[k].push(entry(Distance(0), ends[k]));
+        }
+        Distance best = inf;
+        m_meet = s;
+        while (!queue[0].empty() || !queue[1].empty())
+        {
+            std::size_t k = queue[1].empty()
+                    || (!queue[0].empty()
+                        && !(queue[1].top().first < queue[0].top().first))
+                ? 0
+                : 1;
+            entry top = queue[k].top();
+            queue[k].pop();
+            std::size_t u = top.second;
+            if (m_distance[k][u] < top.first)
+                continue;
+            if (!(top.first < best))
+            {
+                // Nothing further on this side can improve the path
+                std::priority_queue< entry, std::vector< entry >,
+                    detail::ch_entry_greater >()
+                    .swap(queue[k]);
+                continue;
+            }
+            if (reached(1 - k, u) && top.first + m_distance[1 - k][u] < best)
+            {
+                best = top.first + m_distance[1 - k][u];
+                m_meet = u;
+            }
+            const Overlay& g = *overlays[k];
+            typename graph_traits< Overlay >::out_edge_iterator ei, ei_end;
+            for (boost::tie(ei, ei_end) = out_edges(u, g); ei != ei_end; ++ei)
+            {
+                std::size_t v = target(*ei, g);
+                Distance d = top.first + g[*ei].weight;
+                if (!reached(k, v) || d < m_distance[k][v])
+                {
+                    m_stamp[k][v] = m_epoch;
+                    m_distance[k][v] = d;
+                    m_parent[k][v] = u;
+                    queue[k].push(entry(d, v));
+                }
+            }
+        }
+        return best;
+    }
+
+    // Also writes the vertices of a shortest path, from s to t, to out;
+    // nothing is written if t is unreachable
+    template < typename OutputIterator >
+    Distance shortest_path(std::size_t s, std::size_t t, OutputIterator out)
+    {
+        Distance d = distance(s, t);
+        if (d == (std::numeric_limits< Distance >::max)())
+            return d;
+        std::vector< std::size_t > up;
+        for (std::size_t v = m_meet; v != s; v = m_parent[0][v])
+            up.push_back(v);
+        up.push_back(s);
+        *out++ = s;
+        for (std::size_t i = up.size() - 1; i > 0; --i)
+            out = m_ch->unpack_arc(up[i], up[i - 1], out);
+        for (std::size_t v = m_meet; v != t; v = m_parent[1][v])
+            out = m_ch->unpack_arc(v, m_parent[1][v], out);
+        return d;
+    }
+
+private:
+    bool reached(std::size_t k, std::size_t v) const
+    {
+        return m_stamp[k][v] == m_epoch;
+    }
+
+    const contraction_hierarchy< Distance >* m_ch;
+    std::vector< Distance > m_distance[2];
+    std::vector< std::size_t > m_parent[2];
+    std::vector< boost::uint32_t > m_stamp[2];
+    boost::uint32_t m_epoch;
+    std::size_t m_meet;
+};
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_CONTRACTION_HIERARCHY_HPP
@@ -0,0 +1,833 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Binary snapshots of compressed_sparse_row_graph and a read-only,
+// zero-copy CSR graph that views a memory-mapped snapshot file.
+
+#ifndef BOOST_GRAPH_CSR_SNAPSHOT_HPP
+#define BOOST_GRAPH_CSR_SNAPSHOT_HPP
+
+#include <boost/config.hpp>
+#include <boost/assert.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/exception.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/iterator/counting_iterator.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/property_map/transform_value_property_map.hpp>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(BOOST_HAS_UNISTD_H)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define BOOST_GRAPH_CSR_SNAPSHOT_USE_MMAP
+#endif
+
+namespace boost
+{
+
+struct BOOST_SYMBOL_VISIBLE csr_snapshot_error : public graph_exception
+{
+    explicit csr_snapshot_error(const std::string& err)
+    : statement("csr snapshot: " + err)
+    {
+    }
+    ~csr_snapshot_error() throw() BOOST_OVERRIDE {}
+    const char* what() const throw() BOOST_OVERRIDE { return statement.c_str(); }
+    std::string statement;
+};
+
+// On-disk layout (version 1), all integers in the writer's native byte order:
+//
+//   [0, 64)                 csr_snapshot_header
+//   [64, column_offset)     num_vertices + 1 row starts (EdgeIndex)
+//   [column_offset, ...)    num_edges targets (Vertex)
+//   [edge_property_offset,  num_edges edge bundles (EdgeProperty), present
+//    ...)                   only when edge_property_bytes != 0
+//
+// Every array starts on a 64-byte boundary so that mapped arrays are
+// suitably aligned for any element type.
+struct csr_snapshot_header
+{
+    char magic[8];
+    boost::uint32_t version;
+    boost::uint32_t byte_order;
+    boost::uint32_t vertex_bytes;
+    boost::uint32_t edge_index_bytes;
+    boost::uint32_t edge_property_bytes;
+    boost::uint32_t reserved;
+    boost::uint64_t num_vertices;
+    boost::uint64_t num_edges;
+    boost::uint64_t column_offset;
+    boost::uint64_t edge_property_offset;
+};
+
+BOOST_STATIC_ASSERT(sizeof(csr_snapshot_header) == 64);
+
+namespace detail
+{
+    static const char csr_snapshot_magic[8]
+        = { 'B', 'G', 'L', '-', 'C', 'S', 'R', '\0' };
+    static const boost::uint32_t csr_snapshot_version = 1;
+    static const boost::uint32_t csr_snapshot_byte_order = 0x01020304u;
+    static const boost::uint64_t csr_snapshot_alignment = 64;
+
+    inline boost::uint64_t csr_snapshot_align(boost::uint64_t offset)
+    {
+        return (offset + csr_snapshot_alignment - 1)
+            & ~(csr_snapshot_alignment - 1);
+    }
+
+    // Number of bytes stored per edge bundle; no_property bundles are not
+    // written at all.
+    template < typename EdgeProperty >
+    struct csr_snapshot_edge_property_bytes
+    {
+        BOOST_STATIC_ASSERT_MSG(
+            std::is_trivially_copyable< EdgeProperty >::value,
+            "CSR snapshots require trivially copyable edge properties");
+        static const boost::uint32_t value = sizeof(EdgeProperty);
+    };
+
+    template <> struct csr_snapshot_edge_property_bytes< no_property >
+    {
+        static const boost::uint32_t value = 0;
+    };
+
+    template < typename Vertex, typename EdgeIndex, typename EdgeProperty >
+    csr_snapshot_header make_csr_snapshot_header(
+        boost::uint64_t num_vertices, boost::uint64_t num_edges)
+    {
+        csr_snapshot_header h;
+        std::memset(&h, 0, sizeof(h));
+        std::memcpy(h.magic, csr_snapshot_magic, sizeof(h.magic));
+        h.version = csr_snapshot_version;
+        h.byte_order = csr_snapshot_byte_order;
+        h.vertex_bytes = sizeof(Vertex);
+        h.edge_index_bytes = sizeof(EdgeIndex);
+        h.edge_property_bytes
+            = csr_snapshot_edge_property_bytes< EdgeProperty >::value;
+        h.num_vertices = num_vertices;
+        h.num_edges = num_edges;
+        h.column_offset = csr_snapshot_align(
+            sizeof(csr_snapshot_header) + (num_vertices + 1) * sizeof(EdgeIndex));
+        h.edge_property_offset = csr_snapshot_align(
+            h.column_offset + num_edges * sizeof(Vertex));
+        return h;
+    }
+
+    inline boost::uint64_t csr_snapshot_size(const csr_snapshot_header& h)
+    {
+        return h.edge_property_offset
+            + h.num_edges * boost::uint64_t(h.edge_property_bytes);
+    }
+
+    // Checks that a header was written for the given element types and that
+    // the arrays it describes fit in file_size bytes.
+    template < typename Vertex, typename EdgeIndex, typename EdgeProperty >
+    void validate_csr_snapshot_header(
+        const csr_snapshot_header& h, boost::uint64_t file_size)
+    {
+        if (std::memcmp(h.magic, csr_snapshot_magic, sizeof(h.magic)) != 0)
+            BOOST_THROW_EXCEPTION(csr_snapshot_error("bad magic number"));
+        if (h.version != csr_snapshot_version)
+            BOOST_THROW_EXCEPTION(
+                csr_snapshot_error("unsupported format version"));
+        if (h.byte_order != csr_snapshot_byte_order)
+            BOOST_THROW_EXCEPTION(csr_snapshot_error("byte order mismatch"));
+        if (h.vertex_bytes != sizeof(Vertex)
+            || h.edge_index_bytes != sizeof(EdgeIndex))
+            BOOST_THROW_EXCEPTION(
+                csr_snapshot_error("vertex or edge index width mismatch"));
+        if (h.edge_property_bytes
+            != csr_snapshot_edge_property_bytes< EdgeProperty >::value)
+            BOOST_THROW_EXCEPTION(
+                csr_snapshot_error("edge property size mismatch"));
+        // Bounds that keep the offset arithmetic below from overflowing
+        const boost::uint64_t max_count = (~boost::uint64_t(0) >> 8);
+        if (h.num_vertices >= max_count || h.num_edges >= max_count
+            || h.num_vertices >= boost::uint64_t(
+                   (std::numeric_limits< Vertex >::max)())
+            || h.num_edges > boost::uint64_t(
+                   (std::numeric_limits< EdgeIndex >::max)()))
+            BOOST_THROW_EXCEPTION(csr_snapshot_error("corrupt array sizes"));
+        csr_snapshot_header expected
+            = make_csr_snapshot_header< Vertex, EdgeIndex, EdgeProperty >(
+                h.num_vertices, h.num_edges);
+        if (h.column_offset != expected.column_offset
+            || h.edge_property_offset != expected.edge_property_offset)
+            BOOST_THROW_EXCEPTION(csr_snapshot_error("corrupt array offsets"));
+        if (csr_snapshot_size(h) > file_size)
+            BOOST_THROW_EXCEPTION(csr_snapshot_error("truncated file"));
+    }
+
+    inline void csr_snapshot_pad(std::ostream& out, boost::uint64_t& pos,
+        boost::uint64_t target)
+    {
+        static const char zeros[csr_snapshot_alignment] = {};
+        BOOST_ASSERT(target >= pos && target - pos <= csr_snapshot_alignment);
+        out.write(zeros, std::streamsize(target - pos));
+        pos = target;
+    }
+
+    template < typename T >
+    void csr_snapshot_write_array(std::ostream& out, boost::uint64_t& pos,
+        const T* data, boost::uint64_t n)
+    {
+        if (n != 0)
+            out.write(reinterpret_cast< const char* >(data),
+                std::streamsize(n * sizeof(T)));
+        pos += n * sizeof(T);
+    }
+
+    template < typename T >
+    void csr_snapshot_read_array(
+        std::istream& in, boost::uint64_t& pos, T* data, boost::uint64_t n)
+    {
+        if (n != 0)
+            in.read(reinterpret_cast< char* >(data),
+                std::streamsize(n * sizeof(T)));
+        pos += n * sizeof(T);
+    }
+
+    // Reads n elements into v.  The sizes in a header are not trusted when
+    // the stream length is unknown, so the vector then grows one bounded
+    // chunk at a time as data actually arrives, and a short stream throws
+    // before anything close to n elements is allocated.
+    template < typename Vector >
+    void csr_snapshot_read_vector(std::istream& in, boost::uint64_t& pos,
+        Vector& v, boost::uint64_t n, bool size_checked)
+    {
+        typedef typename Vector::value_type T;
+        const boost::uint64_t chunk = size_checked
+            ? n
+            : (std::max)(boost::uint64_t(1), (boost::uint64_t(1) << 20) / sizeof(T));
+        v.clear();
+        for (boost::uint64_t done = 0; done < n;)
+        {
+            const boost::uint64_t count = (std::min)(chunk, n - done);
+            v.resize(std::size_t(done + count));
+            csr_snapshot_read_array(in, pos, &v[std::size_t(done)], count);
+            if (!in)
+                BOOST_THROW_EXCEPTION(csr_snapshot_error("truncated file"));
+            done += count;
+        }
+    }
+
+    // Number of bytes left in a seekable stream, or -1 when the stream
+    // cannot tell.
+    inline boost::int64_t csr_snapshot_remaining(std::istream& in)
+    {
+        const std::istream::pos_type here = in.tellg();
+        if (here == std::istream::pos_type(-1))
+            return -1;
+        if (!in.seekg(0, std::ios::end))
+        {
+            in.clear();
+            return -1;
+        }
+        const std::istream::pos_type end = in.tellg();
+        in.seekg(here);
+        if (end == std::istream::pos_type(-1) || !in)
+        {
+            in.clear();
+            in.seekg(here);
+            return -1;
+        }
+        return boost::int64_t(end - here);
+    }
+
+    inline void csr_snapshot_skip_to(
+        std::istream& in, boost::uint64_t& pos, boost::uint64_t target)
+    {
+        BOOST_ASSERT(target >= pos);
+        in.ignore(std::streamsize(target - pos));
+        pos = target;
+    }
+
+    template < typename EdgeProperty > struct csr_snapshot_edge_properties
+    {
+        template < typename Vector >
+        static void write(std::ostream& out, boost::uint64_t& pos,
+            const Vector& props, boost::uint64_t n)
+        {
+            csr_snapshot_write_array(
+                out, pos, n == 0 ? 0 : &props[0], n);
+        }
+        template < typename Vector >
+        static void read(std::istream& in, boost::uint64_t& pos,
+            Vector& props, boost::uint64_t n, bool size_checked)
+        {
+            csr_snapshot_read_vector(in, pos, props, n, size_checked);
+        }
+    };
+
+    template <> struct csr_snapshot_edge_properties< no_property >
+    {
+        template < typename Vector >
+        static void write(
+            std::ostream&, boost::uint64_t&, const Vector&, boost::uint64_t)
+        {
+        }
+        template < typename Vector >
+        static void read(std::istream&, boost::uint64_t&, Vector& props,
+            boost::uint64_t n, bool)
+        {
+            props.resize(std::size_t(n));
+        }
+    };
+
+    // A read-only view of a whole snapshot file.  POSIX systems map the file
+    // into memory so that pages are shared between processes and loaded on
+    // demand; elsewhere the file is read into an owned buffer.
+    class csr_snapshot_region
+    {
+    public:
+        explicit csr_snapshot_region(const std::string& filename)
+        : m_data(0), m_size(0), m_mapped(false)
+        {
+#ifdef BOOST_GRAPH_CSR_SNAPSHOT_USE_MMAP
+            int fd = ::open(filename.c_str(), O_RDONLY);
+            if (fd < 0)
+                BOOST_THROW_EXCEPTION(
+                    csr_snapshot_error("cannot open " + filename));
+            struct stat st;
+            if (::fstat(fd, &st) != 0)
+            {
+                ::close(fd);
+                BOOST_THROW_EXCEPTION(
+                    csr_snapshot_error("cannot stat " + filename));
+            }
+            m_size = boost::uint64_t(st.st_size);
+            if (m_size != 0)
+            {
+                void* p = ::mmap(0, std::size_t(m_size), PROT_READ,
+                    MAP_SHARED, fd, 0);
+                if (p == MAP_FAILED)
+                {
+                    ::close(fd);
+                    BOOST_THROW_EXCEPTION(
+                        csr_snapshot_error("cannot map " + filename));
+                }
+                m_data = static_cast< const char* >(p);
+                m_mapped = true;
+            }
+            ::close(fd);
+#else
+            std::ifstream in(filename.c_str(), std::ios::binary);
+            if (!in)
+                BOOST_THROW_EXCEPTION(
+                    csr_snapshot_error("cannot open " + filename));
+            in.seekg(0, std::ios::end);
+            m_size = boost::uint64_t(in.tellg());
+            in.seekg(0, std::ios::beg);
+            // Storage from operator new is aligned for any fundamental type.
+            m_buffer.resize(std::size_t(
+                (m_size + sizeof(boost::uint64_t) - 1)
+                / sizeof(boost::uint64_t)));
+            in.read(reinterpret_cast< char* >(m_buffer.data()),
+                std::streamsize(m_size));
+            if (!in)
+                BOOST_THROW_EXCEPTION(
+                    csr_snapshot_error("cannot read " + filename));
+            m_data = reinterpret_cast< const char* >(m_buffer.data());
+#endif
+        }
+
+        ~csr_snapshot_region()
+        {
+#ifdef BOOST_GRAPH_CSR_SNAPSHOT_USE_MMAP
+            if (m_mapped)
+                ::munmap(const_cast< char* >(m_data), std::size_t(m_size));
+#endif
+        }
+
+        const char* data() const { return m_data; }
+        boost::uint64_t size() const { return m_size; }
+
+    private:
+        csr_snapshot_region(const csr_snapshot_region&);
+        csr_snapshot_region& operator=(const csr_snapshot_region&);
+
+        const char* m_data;
+        boost::uint64_t m_size;
+        bool m_mapped;
+#ifndef BOOST_GRAPH_CSR_SNAPSHOT_USE_MMAP
+        std::vector< boost::uint64_t > m_buffer;
+#endif
+    };
+
+    // The arrays of a mapped snapshot, laid out like the members of
+    // compressed_sparse_row_structure so that the shared CSR iterators work
+    // unchanged.
+    template < typename EdgeProperty, typename Vertex, typename EdgeIndex >
+    struct csr_snapshot_arrays
+    {
+        csr_snapshot_arrays()
+        : m_rowstart(0), m_column(0), m_edge_properties(0)
+        {
+        }
+
+        const EdgeIndex* m_rowstart;
+        const Vertex* m_column;
+        const EdgeProperty* m_edge_properties;
+    };
+
+} // namespace detail
+
+/** Writes the structure and edge bundles of a compressed_sparse_row_graph to
+ * a binary snapshot.  Only the forward (out-edge) structure is stored; vertex
+ * and graph properties are not part of the snapshot.
+ */
+template < typename Directed, typename VertexProperty, typename EdgeProperty,
+    typename GraphProperty, typename Vertex, typename EdgeIndex,
+    typename Allocator >
+void write_csr_snapshot(std::ostream& out,
+    const compressed_sparse_row_graph< Directed, VertexProperty, EdgeProperty,
+        GraphProperty, Vertex, EdgeIndex, Allocator >& g)
+{
+    typedef typename compressed_sparse_row_graph< Directed, VertexProperty,
+        EdgeProperty, GraphProperty, Vertex, EdgeIndex,
+        Allocator >::forward_type forward_type;
+    const typename forward_type::rowstart_type& rowstart
+        = g.m_forward.m_rowstart;
+    const typename forward_type::column_type& column = g.m_forward.m_column;
+    csr_snapshot_header h
+        = detail::make_csr_snapshot_header< Vertex, EdgeIndex, EdgeProperty >(
+            rowstart.size() - 1, column.size());
+
+    boost::uint64_t pos = 0;
+    detail::csr_snapshot_write_array(out, pos, &h, 1);
+    detail::csr_snapshot_write_array(out, pos, &rowstart[0], rowstart.size());
+    detail::csr_snapshot_pad(out, pos, h.column_offset);
+    detail::csr_snapshot_write_array(
+        out, pos, column.empty() ? 0 : &column[0], column.size());
+    detail::csr_snapshot_pad(out, pos, h.edge_property_offset);
+    detail::csr_snapshot_edge_properties< EdgeProperty >::write(
+        out, pos, g.m_forward.m_edge_properties, column.size());
+    if (!out)
+        BOOST_THROW_EXCEPTION(csr_snapshot_error("write failed"));
+}
+
+template < typename Directed, typename VertexProperty, typename EdgeProperty,
+    typename GraphProperty, typename Vertex, typename EdgeIndex,
+    typename Allocator >
+void write_csr_snapshot(const std::string& filename,
+    const compressed_sparse_row_graph< Directed, VertexProperty, EdgeProperty,
+        GraphProperty, Vertex, EdgeIndex, Allocator >& g)
+{
+    std::ofstream out(filename.c_str(), std::ios::binary | std::ios::trunc);
+    if (!out)
+        BOOST_THROW_EXCEPTION(csr_snapshot_error("cannot create " + filename));
+    write_csr_snapshot(out, g);
+}
+
+/** Replaces the contents of a directed compressed_sparse_row_graph with the
+ * contents of a snapshot.  The arrays are read directly into place, so no
+ * sorting or counting pass is needed.  Vertex properties are
+ * default-constructed.
+ *
+ * The stream is not trusted: allocations are bounded by the data actually
+ * present, and the row starts and targets are checked to describe a valid
+ * graph.  On error csr_snapshot_error is thrown and g is left unchanged.
+ */
+template < typename VertexProperty, typename EdgeProperty,
+    typename GraphProperty, typename Vertex, typename EdgeIndex,
+    typename Allocator >
+void read_csr_snapshot(std::istream& in,
+    compressed_sparse_row_graph< directedS, VertexProperty, EdgeProperty,
+        GraphProperty, Vertex, EdgeIndex, Allocator >& g)
+{
+    typedef compressed_sparse_row_graph< directedS, VertexProperty,
+        EdgeProperty, GraphProperty, Vertex, EdgeIndex, Allocator >
+        graph_type;
+    typedef typename graph_type::forward_type forward_type;
+
+    const boost::int64_t remaining = detail::csr_snapshot_remaining(in);
+    csr_snapshot_header h;
+    boost::uint64_t pos = 0;
+    detail::csr_snapshot_read_array(in, pos, &h, 1);
+    if (!in)
+        BOOST_THROW_EXCEPTION(csr_snapshot_error("truncated header"));
+    // When the stream length is unknown, truncation is caught while reading
+    const bool size_checked = remaining >= 0;
+    detail::validate_csr_snapshot_header< Vertex, EdgeIndex, EdgeProperty >(h,
+        size_checked ? boost::uint64_t(remaining) : detail::csr_snapshot_size(h));
+
+    typename forward_type::rowstart_type rowstart;
+    typename forward_type::column_type column;
+    typename forward_type::edge_property_vector edge_properties;
+    detail::csr_snapshot_read_vector(
+        in, pos, rowstart, h.num_vertices + 1, size_checked);
+    detail::csr_snapshot_skip_to(in, pos, h.column_offset);
+    detail::csr_snapshot_read_vector(
+        in, pos, column, h.num_edges, size_checked);
+    detail::csr_snapshot_skip_to(in, pos, h.edge_property_offset);
+    detail::csr_snapshot_edge_properties< EdgeProperty >::read(
+        in, pos, edge_properties, h.num_edges, size_checked);
+    if (!in)
+        BOOST_THROW_EXCEPTION(csr_snapshot_error("truncated file"));
+
+    // out_edges and friends index the arrays without checks
+    if (rowstart[0] != 0 || rowstart.back() != h.num_edges)
+        BOOST_THROW_EXCEPTION(csr_snapshot_error("inconsistent row starts"));
+    for (std::size_t v = 0; v < std::size_t(h.num_vertices); ++v)
+        if (rowstart[v + 1] < rowstart[v])
+            BOOST_THROW_EXCEPTION(
+                csr_snapshot_error("decreasing row starts"));
+    for (std::size_t i = 0; i < column.size(); ++i)
+        if (!(boost::uint64_t(column[i]) < h.num_vertices))
+            BOOST_THROW_EXCEPTION(csr_snapshot_error("target out of range"));
+
+    g.m_forward.m_rowstart.swap(rowstart);
+    g.m_forward.m_column.swap(column);
+    g.m_forward.m_edge_properties.swap(edge_properties);
+    g.vertex_properties().clear();
+    g.vertex_properties().resize(std::size_t(h.num_vertices));
+}
+
+template < typename VertexProperty, typename EdgeProperty,
+    typename GraphProperty, typename Vertex, typename EdgeIndex,
+    typename Allocator >
+void read_csr_snapshot(const std::string& filename,
+    compressed_sparse_row_graph< directedS, VertexProperty, EdgeProperty,
+        GraphProperty, Vertex, EdgeIndex, Allocator >& g)
+{
+    std::ifstream in(filename.c_str(), std::ios::binary);
+    if (!in)
+        BOOST_THROW_EXCEPTION(csr_snapshot_error("cannot open " + filename));
+    read_csr_snapshot(in, g);
+}
+
+/** Read-only directed CSR graph whose arrays are views into a snapshot file.
+ *
+ * Opening a snapshot costs O(1) beyond validating its header: the file is
+ * memory-mapped and pages are faulted in as the graph is traversed, so
+ * several processes opening the same file share one copy in the page cache.
+ * Copies of a mapped_csr_graph share the underlying mapping, which is
+ * released when the last copy is destroyed.
+ *
+ * EdgeProperty, Vertex and EdgeIndex must match the types of the graph that
+ * wrote the snapshot; a mismatch is reported with csr_snapshot_error.
+ */
+template < typename EdgeProperty = no_property, typename Vertex = std::size_t,
+    typename EdgeIndex = Vertex >
+class mapped_csr_graph
+{
+public:
+    typedef detail::csr_snapshot_arrays< EdgeProperty, Vertex, EdgeIndex >
+        forward_type;
+
+    // For Graph
+    typedef Vertex vertex_descriptor;
+    typedef detail::csr_edge_descriptor< Vertex, EdgeIndex > edge_descriptor;
+    typedef directed_tag directed_category;
+    typedef allow_parallel_edge_tag edge_parallel_category;
+
+    class traversal_category : public incidence_graph_tag,
+                               public adjacency_graph_tag,
+                               public vertex_list_graph_tag,
+                               public edge_list_graph_tag
+    {
+    };
+
+    static vertex_descriptor null_vertex() { return vertex_descriptor(-1); }
+
+    // For VertexListGraph
+    typedef counting_iterator< Vertex > vertex_iterator;
+    typedef Vertex vertices_size_type;
+
+    // For EdgeListGraph
+    typedef EdgeIndex edges_size_type;
+    typedef detail::csr_edge_iterator< mapped_csr_graph > edge_iterator;
+
+    // For IncidenceGraph
+    typedef detail::csr_out_edge_iterator< mapped_csr_graph >
+        out_edge_iterator;
+    typedef EdgeIndex degree_size_type;
+
+    // For AdjacencyGraph
+    typedef const Vertex* adjacency_iterator;
+
+    // For BidirectionalGraph (not implemented)
+    typedef void in_edge_iterator;
+
+    typedef EdgeProperty edge_bundled;
+    typedef no_property vertex_property_type;
+    typedef no_property edge_property_type;
+    typedef no_property graph_property_type;
+
+    mapped_csr_graph() : m_num_vertices(0), m_num_edges(0)
+    {
+        static const EdgeIndex empty_rowstart = 0;
+        m_forward.m_rowstart = &empty_rowstart;
+    }
+
+    explicit mapped_csr_graph(const std::string& filename)
+    : m_region(new detail::csr_snapshot_region(filename))
+    {
+        csr_snapshot_header h;
+        if (m_region->size() < sizeof(h))
+            BOOST_THROW_EXCEPTION(csr_snapshot_error("truncated header"));
+        std::memcpy(&h, m_region->data(), sizeof(h));
+        detail::validate_csr_snapshot_header< Vertex, EdgeIndex,
+            EdgeProperty >(h, m_region->size());
+        m_num_vertices = Vertex(h.num_vertices);
+        m_num_edges = EdgeIndex(h.num_edges);
+        const char* base = m_region->data();
+        m_forward.m_rowstart = reinterpret_cast< const EdgeIndex* >(
+            base + sizeof(csr_snapshot_header));
+        m_forward.m_column
+            = reinterpret_cast< const Vertex* >(base + h.column_offset);
+        if (h.edge_property_bytes != 0)
+            m_forward.m_edge_properties = reinterpret_cast< const EdgeProperty* >(
+                base + h.edge_property_offset);
+        if (m_forward.m_rowstart[0] != 0
+            || m_forward.m_rowstart[m_num_vertices] != m_num_edges)
+            BOOST_THROW_EXCEPTION(
+                csr_snapshot_error("inconsistent row starts"));
+    }
+
+    // Directly access an edge bundle
+    const EdgeProperty& operator[](const edge_descriptor& e) const
+    {
+        BOOST_ASSERT(m_forward.m_edge_properties);
+        return m_forward.m_edge_properties[e.idx];
+    }
+
+    forward_type m_forward;
+    Vertex m_num_vertices;
+    EdgeIndex m_num_edges;
+
+private:
+    std::shared_ptr< const detail::csr_snapshot_region > m_region;
+};
+
+#define BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS \
+    typename EdgeProperty, typename Vertex, typename EdgeIndex
+#define BOOST_MAPPED_CSR_GRAPH_TYPE \
+    mapped_csr_graph< EdgeProperty, Vertex, EdgeIndex >
+
+// From VertexListGraph
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline Vertex num_vertices(const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+    return g.m_num_vertices;
+}
+
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline std::pair< counting_iterator< Vertex >, counting_iterator< Vertex > >
+vertices(const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+    return std::make_pair(counting_iterator< Vertex >(0),
+        counting_iterator< Vertex >(num_vertices(g)));
+}
+
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline Vertex vertex(Vertex i, const BOOST_MAPPED_CSR_GRAPH_TYPE&)
+{
+    return i;
+}
+
+// From IncidenceGraph
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline Vertex source(typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_descriptor e,
+    const BOOST_MAPPED_CSR_GRAPH_TYPE&)
+{
+    return e.src;
+}
+
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline Vertex target(typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_descriptor e,
+    const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+    return g.m_forward.m_column[e.idx];
+}
+
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline std::pair< typename BOOST_MAPPED_CSR_GRAPH_TYPE::out_edge_iterator,
+    typename BOOST_MAPPED_CSR_GRAPH_TYPE::out_edge_iterator >
+out_edges(Vertex v, const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+    typedef typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_descriptor ed;
+    typedef typename BOOST_MAPPED_CSR_GRAPH_TYPE::out_edge_iterator it;
+    EdgeIndex v_row_start = g.m_forward.m_rowstart[v];
+    EdgeIndex next_row_start = g.m_forward.m_rowstart[v + 1];
+    return std::make_pair(it(ed(v, v_row_start)), it(ed(v, next_row_start)));
+}
+
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline EdgeIndex out_degree(Vertex v, const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+    return g.m_forward.m_rowstart[v + 1] - g.m_forward.m_rowstart[v];
+}
+
+// From AdjacencyGraph
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline std::pair< const Vertex*, const Vertex* > adjacent_vertices(
+    Vertex v, const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+    return std::make_pair(g.m_forward.m_column + g.m_forward.m_rowstart[v],
+        g.m_forward.m_column + g.m_forward.m_rowstart[v + 1]);
+}
+
+// From EdgeListGraph
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline EdgeIndex num_edges(const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+    return g.m_num_edges;
+}
+
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+std::pair< typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_iterator,
+    typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_iterator >
+edges(const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+    typedef typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_iterator ei;
+    typedef typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_descriptor edgedesc;
+    if (num_vertices(g) == 0 || num_edges(g) == 0)
+    {
+        return std::make_pair(ei(), ei());
+    }
+    else
+    {
+        // Find the first vertex that has outgoing edges
+        Vertex src = 0;
+        while (g.m_forward.m_rowstart[src + 1] == 0)
+            ++src;
+        return std::make_pair(
+            ei(g, edgedesc(src, 0), g.m_forward.m_rowstart[src + 1]),
+            ei(g, edgedesc(num_vertices(g), num_edges(g)), 0));
+    }
+}
+
+// Find an edge given its index in the graph
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_descriptor edge_from_index(
+    EdgeIndex idx, const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+    BOOST_ASSERT(idx < num_edges(g));
+    const EdgeIndex* src_plus_1 = std::upper_bound(g.m_forward.m_rowstart,
+        g.m_forward.m_rowstart + num_vertices(g) + 1, idx);
+    Vertex src = Vertex((src_plus_1 - g.m_forward.m_rowstart) - 1);
+    return typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_descriptor(src, idx);
+}
+
+// Property maps: the vertex and edge indices, and the edge bundles stored in
+// the snapshot and their members.
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+struct property_map< BOOST_MAPPED_CSR_GRAPH_TYPE, vertex_index_t >
+{
+    typedef typed_identity_property_map< Vertex > type;
+    typedef type const_type;
+};
+
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+struct property_map< BOOST_MAPPED_CSR_GRAPH_TYPE, edge_index_t >
+{
+    typedef detail::csr_edge_index_map< Vertex, EdgeIndex > type;
+    typedef type const_type;
+};
+
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+struct property_map< BOOST_MAPPED_CSR_GRAPH_TYPE, edge_bundle_t >
+{
+    typedef iterator_property_map< const EdgeProperty*,
+        detail::csr_edge_index_map< Vertex, EdgeIndex >, EdgeProperty,
+        const EdgeProperty& >
+        type;
+    typedef type const_type;
+};
+
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline typed_identity_property_map< Vertex > get(
+    vertex_index_t, const BOOST_MAPPED_CSR_GRAPH_TYPE&)
+{
+    return typed_identity_property_map< Vertex >();
+}
+
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline Vertex get(vertex_index_t, const BOOST_MAPPED_CSR_GRAPH_TYPE&, Vertex v)
+{
+    return v;
+}
+
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline detail::csr_edge_index_map< Vertex, EdgeIndex > get(
+    edge_index_t, const BOOST_MAPPED_CSR_GRAPH_TYPE&)
+{
+    return detail::csr_edge_index_map< Vertex, EdgeIndex >();
+}
+
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline EdgeIndex get(edge_index_t, const BOOST_MAPPED_CSR_GRAPH_TYPE&,
+    typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_descriptor e)
+{
+    return e.idx;
+}
+
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS >
+inline typename property_map< BOOST_MAPPED_CSR_GRAPH_TYPE,
+    edge_bundle_t >::const_type
+get(edge_bundle_t, const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+    BOOST_STATIC_ASSERT_MSG((!is_same< EdgeProperty, no_property >::value),
+        "mapped_csr_graph has no edge bundles");
+    return typename property_map< BOOST_MAPPED_CSR_GRAPH_TYPE,
+        edge_bundle_t >::const_type(g.m_forward.m_edge_properties);
+}
+
+// get(&EdgeProperty::member, g) reads one member of the stored edge bundles
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS, typename T >
+struct property_map< BOOST_MAPPED_CSR_GRAPH_TYPE, T EdgeProperty::* >
+{
+    typedef transform_value_property_map<
+        detail::lookup_one_property_f< const EdgeProperty, T EdgeProperty::* >,
+        typename property_map< BOOST_MAPPED_CSR_GRAPH_TYPE,
+            edge_bundle_t >::const_type >
+        type;
+    typedef type const_type;
+};
+
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS, typename T >
+inline typename property_map< BOOST_MAPPED_CSR_GRAPH_TYPE,
+    T EdgeProperty::* >::const_type
+get(T EdgeProperty::*p, const BOOST_MAPPED_CSR_GRAPH_TYPE& g)
+{
+    return typename property_map< BOOST_MAPPED_CSR_GRAPH_TYPE,
+        T EdgeProperty::* >::const_type(p, get(edge_bundle, g));
+}
+
+template < BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS, typename T >
+inline const T& get(T EdgeProperty::*p, const BOOST_MAPPED_CSR_GRAPH_TYPE& g,
+    typename BOOST_MAPPED_CSR_GRAPH_TYPE::edge_descriptor e)
+{
+    return g[e].*p;
+}
+
+#undef BOOST_MAPPED_CSR_GRAPH_TYPE
+#undef BOOST_MAPPED_CSR_GRAPH_TEMPLATE_PARMS
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_CSR_SNAPSHOT_HPP
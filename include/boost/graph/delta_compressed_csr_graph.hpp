@@ -0,0 +1,612 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// A read-only compressed sparse row graph whose adjacency lists are stored
+// as delta-encoded variable-length integers instead of one full Vertex per
+// edge.
+
+#ifndef BOOST_GRAPH_DELTA_COMPRESSED_CSR_GRAPH_HPP
+#define BOOST_GRAPH_DELTA_COMPRESSED_CSR_GRAPH_HPP
+
+#include <boost/assert.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/iterator/counting_iterator.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace boost
+{
+
+namespace detail
+{
+    // LEB128-style unsigned varints: seven bits per byte, low bits first,
+    // high bit set on every byte but the last.
+    inline void encode_varint(
+        boost::uint64_t value, std::vector< unsigned char >& out)
+    {
+        while (value >= 0x80)
+        {
+            out.push_back(static_cast< unsigned char >(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast< unsigned char >(value));
+    }
+
+    inline boost::uint64_t decode_varint(const unsigned char*& pos)
+    {
+        boost::uint64_t value = *pos & 0x7F;
+        unsigned shift = 7;
+        while (*pos++ & 0x80)
+        {
+            value |= boost::uint64_t(*pos & 0x7F) << shift;
+            shift += 7;
+        }
+        return value;
+    }
+
+    // Maps small signed differences to small unsigned values
+    inline boost::uint64_t zigzag_encode(boost::int64_t value)
+    {
+        return (boost::uint64_t(value) << 1)
+            ^ boost::uint64_t(value >> 63);
+    }
+
+    inline boost::uint64_t zigzag_decode(boost::uint64_t value)
+    {
+        return (value >> 1) ^ (~(value & 1) + 1);
+    }
+
+    // Rows are located through the byte offset of every 64th row plus a
+    // 16-bit offset of each row from the first row of its block.  Blocks
+    // whose rows span more than 64 KiB keep full offsets in a side table
+    // instead, marked by delta_csr_wide_block in their block offset.
+    static const std::size_t delta_csr_block_size = 64;
+    static const std::size_t delta_csr_wide_block
+        = ~(~std::size_t(0) >> 1);
+
+    // Edge descriptor of delta_compressed_csr_graph: the CSR descriptor plus
+    // the decoded target, which cannot be looked up from the edge index
+    // alone.
+    template < typename Vertex, typename EdgeIndex >
+    class delta_csr_edge_descriptor
+    : public csr_edge_descriptor< Vertex, EdgeIndex >
+    {
+    public:
+        Vertex tgt;
+
+        delta_csr_edge_descriptor(Vertex src, Vertex tgt, EdgeIndex idx)
+        : csr_edge_descriptor< Vertex, EdgeIndex >(src, idx), tgt(tgt)
+        {
+        }
+        delta_csr_edge_descriptor() : tgt(0) {}
+    };
+
+    // Decodes one compressed adjacency list.  Each row starts with the
+    // zigzag-encoded difference between the first target and the source;
+    // the remaining targets follow as gaps from their predecessor.
+    template < typename Vertex, typename EdgeIndex >
+    class delta_csr_adjacency_iterator
+    : public iterator_facade<
+          delta_csr_adjacency_iterator< Vertex, EdgeIndex >, Vertex,
+          boost::forward_traversal_tag, Vertex >
+    {
+    public:
+        delta_csr_adjacency_iterator()
+        : m_next(0), m_current(0), m_idx(0), m_end(0)
+        {
+        }
+
+        delta_csr_adjacency_iterator(const unsigned char* row, Vertex src,
+            EdgeIndex idx, EdgeIndex end)
+        : m_next(row), m_current(0), m_idx(idx), m_end(end)
+        {
+            if (m_idx != m_end)
+                m_current = Vertex(boost::uint64_t(src)
+                    + zigzag_decode(decode_varint(m_next)));
+        }
+
+        EdgeIndex index() const { return m_idx; }
+
+    private:
+        friend class boost::iterator_core_access;
+
+        Vertex dereference() const { return m_current; }
+
+        bool equal(const delta_csr_adjacency_iterator& other) const
+        {
+            return m_idx == other.m_idx;
+        }
+
+        void increment()
+        {
+            if (++m_idx != m_end)
+                m_current += Vertex(decode_varint(m_next));
+        }
+
+        const unsigned char* m_next;
+        Vertex m_current;
+        EdgeIndex m_idx;
+        EdgeIndex m_end;
+    };
+
+    template < typename Vertex, typename EdgeIndex >
+    class delta_csr_out_edge_iterator
+    : public iterator_facade< delta_csr_out_edge_iterator< Vertex, EdgeIndex >,
+          delta_csr_edge_descriptor< Vertex, EdgeIndex >,
+          boost::forward_traversal_tag,
+          delta_csr_edge_descriptor< Vertex, EdgeIndex > >
+    {
+    public:
+        typedef delta_csr_edge_descriptor< Vertex, EdgeIndex > edge_descriptor;
+
+        delta_csr_out_edge_iterator() : m_src(0) {}
+
+        delta_csr_out_edge_iterator(Vertex src,
+            const delta_csr_adjacency_iterator< Vertex, EdgeIndex >& adj)
+        : m_src(src), m_adj(adj)
+        {
+        }
+
+    private:
+        friend class boost::iterator_core_access;
+
+        edge_descriptor dereference() const
+        {
+            return edge_descriptor(m_src, *m_adj, m_adj.index());
+        }
+
+        bool equal(const delta_csr_out_edge_iterator& other) const
+        {
+            return m_adj == other.m_adj;
+        }
+
+        void increment() { ++m_adj; }
+
+        Vertex m_src;
+        delta_csr_adjacency_iterator< Vertex, EdgeIndex > m_adj;
+    };
+
+    // Visits the out-edges of every vertex in turn
+    template < typename Graph >
+    class delta_csr_edge_iterator
+    : public iterator_facade< delta_csr_edge_iterator< Graph >,
+          typename Graph::edge_descriptor, boost::forward_traversal_tag,
+          typename Graph::edge_descriptor >
+    {
+    public:
+        typedef typename Graph::vertex_descriptor Vertex;
+        typedef typename Graph::out_edge_iterator out_edge_iterator;
+
+        delta_csr_edge_iterator() : m_graph(0), m_src(0) {}
+
+        delta_csr_edge_iterator(const Graph& g, Vertex src,
+            out_edge_iterator current, out_edge_iterator end)
+        : m_graph(&g), m_src(src), m_current(current), m_end(end)
+        {
+            skip_empty_rows();
+        }
+
+    private:
+        friend class boost::iterator_core_access;
+
+        typename Graph::edge_descriptor dereference() const
+        {
+            return *m_current;
+        }
+
+        bool equal(const delta_csr_edge_iterator& other) const
+        {
+            return m_current == other.m_current;
+        }
+
+        void increment()
+        {
+            ++m_current;
+            skip_empty_rows();
+        }
+
+        void skip_empty_rows()
+        {
+            while (m_current == m_end && m_src + 1 < num_vertices(*m_graph))
+                boost::tie(m_current, m_end) = out_edges(++m_src, *m_graph);
+        }
+
+        const Graph* m_graph;
+        Vertex m_src;
+        out_edge_iterator m_current;
+        out_edge_iterator m_end;
+    };
+} // namespace detail
+
+/** Compressed sparse row graph with delta-encoded adjacency lists.
+ *
+ * The targets of each row are sorted and stored as variable-length gaps, so
+ * that graphs with locality (neighbors numbered close to each other and to
+ * their source) use one or two bytes per edge instead of sizeof(Vertex).
+ * Row starts are kept uncompressed, which keeps out_degree and edge indices
+ * constant-time; out-edges are decoded sequentially by a forward iterator.
+ * The byte offsets of the rows take two bytes per vertex.
+ *
+ * The graph is immutable once built.  Edge indices follow the sorted order
+ * of each row, so they differ from those of the graph the edges came from
+ * whenever its rows were not already sorted by target; edge properties are
+ * moved along with their edges.
+ */
+template < typename EdgeProperty = no_property, typename Vertex = std::size_t,
+    typename EdgeIndex = Vertex >
+class delta_compressed_csr_graph
+{
+public:
+    // For Graph
+    typedef Vertex vertex_descriptor;
+    typedef detail::delta_csr_edge_descriptor< Vertex, EdgeIndex >
+        edge_descriptor;
+    typedef directed_tag directed_category;
+    typedef allow_parallel_edge_tag edge_parallel_category;
+
+    class traversal_category : public incidence_graph_tag,
+                               public adjacency_graph_tag,
+                               public vertex_list_graph_tag,
+                               public edge_list_graph_tag
+    {
+    };
+
+    static vertex_descriptor null_vertex() { return vertex_descriptor(-1); }
+
+    // For VertexListGraph
+    typedef counting_iterator< Vertex > vertex_iterator;
+    typedef Vertex vertices_size_type;
+
+    // For EdgeListGraph
+    typedef EdgeIndex edges_size_type;
+    typedef detail::delta_csr_edge_iterator< delta_compressed_csr_graph >
+        edge_iterator;
+
+    // For IncidenceGraph
+    typedef detail::delta_csr_out_edge_iterator< Vertex, EdgeIndex >
+        out_edge_iterator;
+    typedef EdgeIndex degree_size_type;
+
+    // For AdjacencyGraph
+    typedef detail::delta_csr_adjacency_iterator< Vertex, EdgeIndex >
+        adjacency_iterator;
+
+    // For BidirectionalGraph (not implemented)
+    typedef void in_edge_iterator;
+
+    typedef EdgeProperty edge_bundled;
+    typedef no_property vertex_property_type;
+    typedef no_property edge_property_type;
+    typedef no_property graph_property_type;
+
+    delta_compressed_csr_graph()
+    : m_rowstart(1, EdgeIndex(0)), m_block_offset(1, 0)
+    {
+    }
+
+    //  From number of vertices and unsorted list of edges
+    template < typename MultiPassInputIterator >
+    delta_compressed_csr_graph(edges_are_unsorted_multi_pass_t,
+        MultiPassInputIterator edge_begin, MultiPassInputIterator edge_end,
+        vertices_size_type numverts)
+    {
+        detail::compressed_sparse_row_structure< EdgeProperty, Vertex,
+            EdgeIndex >
+            tmp;
+        tmp.assign_unsorted_multi_pass_edges(edge_begin, edge_end, numverts,
+            typed_identity_property_map< vertices_size_type >(),
+            keep_all());
+        assign(tmp);
+    }
+
+    //  From number of vertices and unsorted list of edges, plus edge
+    //  properties
+    template < typename MultiPassInputIterator, typename EdgePropertyIterator >
+    delta_compressed_csr_graph(edges_are_unsorted_multi_pass_t,
+        MultiPassInputIterator edge_begin, MultiPassInputIterator edge_end,
+        EdgePropertyIterator ep_iter, vertices_size_type numverts)
+    {
+        detail::compressed_sparse_row_structure< EdgeProperty, Vertex,
+            EdgeIndex >
+            tmp;
+        tmp.assign_unsorted_multi_pass_edges(edge_begin, edge_end, ep_iter,
+            numverts, typed_identity_property_map< vertices_size_type >(),
+            keep_all());
+        assign(tmp);
+    }
+
+    //  From a directed CSR graph with the same edge bundle and index types,
+    //  whatever its allocator
+    template < typename VertexProperty, typename GraphProperty,
+        typename Allocator >
+    explicit delta_compressed_csr_graph(
+        const compressed_sparse_row_graph< directedS, VertexProperty,
+            EdgeProperty, GraphProperty, Vertex, EdgeIndex, Allocator >& g)
+    {
+        assign(g.m_forward);
+    }
+
+    // Directly access an edge bundle
+    const EdgeProperty& operator[](const edge_descriptor& e) const
+    {
+        return m_edge_properties[e.idx];
+    }
+
+    // Bytes used by the compressed adjacency lists
+    std::size_t compressed_size() const { return m_bytes.size(); }
+
+    // The encoded targets of v
+    const unsigned char* row(Vertex v) const
+    {
+        const std::size_t block
+            = std::size_t(v) / detail::delta_csr_block_size;
+        const std::size_t base = m_block_offset[block];
+        const std::size_t offset = (base & detail::delta_csr_wide_block)
+            ? m_wide_row_offset[(base & ~detail::delta_csr_wide_block)
+                + std::size_t(v) % detail::delta_csr_block_size]
+            : base + m_row_offset[v];
+        return m_bytes.empty() ? 0 : &m_bytes[0] + offset;
+    }
+
+    std::vector< EdgeIndex > m_rowstart;
+    // Byte offset of the first row of each block, and the end of the rows
+    std::vector< std::size_t > m_block_offset;
+    // Byte offset of each row from the first row of its block
+    std::vector< boost::uint16_t > m_row_offset;
+    std::vector< std::size_t > m_wide_row_offset;
+    std::vector< unsigned char > m_bytes;
+    std::vector< EdgeProperty > m_edge_properties;
+
+private:
+    template < typename Structure > void assign(const Structure& s)
+    {
+        const std::size_t numverts = s.m_rowstart.size() - 1;
+        m_rowstart.assign(s.m_rowstart.begin(), s.m_rowstart.end());
+        const std::size_t block_size = detail::delta_csr_block_size;
+        m_block_offset.assign(
+            (numverts + block_size - 1) / block_size + 1, 0);
+        m_row_offset.assign(numverts, 0);
+        m_wide_row_offset.clear();
+        m_bytes.clear();
+        m_bytes.reserve(s.m_column.size() + numverts);
+        const bool has_properties
+            = !is_same< EdgeProperty, no_property >::value;
+        if (has_properties)
+            m_edge_properties.reserve(s.m_column.size());
+
+        std::vector< EdgeIndex > order;
+        std::size_t offsets[detail::delta_csr_block_size];
+        for (std::size_t v = 0; v < numverts; ++v)
+        {
+            offsets[v % block_size] = m_bytes.size();
+            if (v % block_size == block_size - 1 || v + 1 == numverts)
+                set_block_offsets(v / block_size, offsets, v % block_size + 1);
+            EdgeIndex row_begin = s.m_rowstart[v];
+            EdgeIndex row_end = s.m_rowstart[v + 1];
+            order.clear();
+            for (EdgeIndex i = row_begin; i != row_end; ++i)
+                order.push_back(i);
+            // Stable, so parallel edges keep their relative order
+            std::stable_sort(order.begin(), order.end(),
+                [&](EdgeIndex a, EdgeIndex b) {
+                    return s.m_column[a] < s.m_column[b];
+                });
+            for (std::size_t j = 0; j < order.size(); ++j)
+            {
+                Vertex t = s.m_column[order[j]];
+                if (j == 0)
+                    detail::encode_varint(
+                        detail::zigzag_encode(
+                            boost::int64_t(boost::uint64_t(t)
+                                - boost::uint64_t(v))),
+                        m_bytes);
+                else
+                    detail::encode_varint(
+                        boost::uint64_t(t - s.m_column[order[j - 1]]),
+                        m_bytes);
+                if (has_properties)
+                    m_edge_properties.push_back(
+                        s.m_edge_properties[order[j]]);
+            }
+        }
+        m_block_offset.back() = m_bytes.size();
+        m_bytes.shrink_to_fit();
+    }
+
+    void set_block_offsets(
+        std::size_t block, const std::size_t* offsets, std::size_t n)
+    {
+        const std::size_t first = block * detail::delta_csr_block_size;
+        if (offsets[n - 1] - offsets[0] <= 0xFFFF)
+        {
+            m_block_offset[block] = offsets[0];
+            for (std::size_t i = 0; i < n; ++i)
+                m_row_offset[first + i]
+                    = boost::uint16_t(offsets[i] - offsets[0]);
+        }
+        else
+        {
+            m_block_offset[block]
+                = detail::delta_csr_wide_block | m_wide_row_offset.size();
+            m_wide_row_offset.insert(
+                m_wide_row_offset.end(), offsets, offsets + n);
+        }
+    }
+};
+
+#define BOOST_DELTA_CSR_GRAPH_TEMPLATE_PARMS \
+    typename EdgeProperty, typename Vertex, typename EdgeIndex
+#define BOOST_DELTA_CSR_GRAPH_TYPE \
+    delta_compressed_csr_graph< EdgeProperty, Vertex, EdgeIndex >
+
+// From VertexListGraph
+template < BOOST_DELTA_CSR_GRAPH_TEMPLATE_PARMS >
+inline Vertex num_vertices(const BOOST_DELTA_CSR_GRAPH_TYPE& g)
+{
+    return Vertex(g.m_rowstart.size() - 1);
+}
+
+template < BOOST_DELTA_CSR_GRAPH_TEMPLATE_PARMS >
+inline std::pair< counting_iterator< Vertex >, counting_iterator< Vertex > >
+vertices(const BOOST_DELTA_CSR_GRAPH_TYPE& g)
+{
+    return std::make_pair(counting_iterator< Vertex >(0),
+        counting_iterator< Vertex >(num_vertices(g)));
+}
+
+template < BOOST_DELTA_CSR_GRAPH_TEMPLATE_PARMS >
+inline Vertex vertex(Vertex i, const BOOST_DELTA_CSR_GRAPH_TYPE&)
+{
+    return i;
+}
+
+// From IncidenceGraph
+template < BOOST_DELTA_CSR_GRAPH_TEMPLATE_PARMS >
+inline Vertex source(typename BOOST_DELTA_CSR_GRAPH_TYPE::edge_descriptor e,
+    const BOOST_DELTA_CSR_GRAPH_TYPE&)
+{
+    return e.src;
+}
+
+template < BOOST_DELTA_CSR_GRAPH_TEMPLATE_PARMS >
+inline Vertex target(typename BOOST_DELTA_CSR_GRAPH_TYPE::edge_descriptor e,
+    const BOOST_DELTA_CSR_GRAPH_TYPE&)
+{
+    return e.tgt;
+}
+
+template < BOOST_DELTA_CSR_GRAPH_TEMPLATE_PARMS >
+inline std::pair< typename BOOST_DELTA_CSR_GRAPH_TYPE::adjacency_iterator,
+    typename BOOST_DELTA_CSR_GRAPH_TYPE::adjacency_iterator >
+adjacent_vertices(Vertex v, const BOOST_DELTA_CSR_GRAPH_TYPE& g)
+{
+    typedef typename BOOST_DELTA_CSR_GRAPH_TYPE::adjacency_iterator it;
+    return std::make_pair(
+        it(g.row(v), v, g.m_rowstart[v], g.m_rowstart[v + 1]),
+        it(0, v, g.m_rowstart[v + 1], g.m_rowstart[v + 1]));
+}
+
+template < BOOST_DELTA_CSR_GRAPH_TEMPLATE_PARMS >
+inline std::pair< typename BOOST_DELTA_CSR_GRAPH_TYPE::out_edge_iterator,
+    typename BOOST_DELTA_CSR_GRAPH_TYPE::out_edge_iterator >
+out_edges(Vertex v, const BOOST_DELTA_CSR_GRAPH_TYPE& g)
+{
+    typedef typename BOOST_DELTA_CSR_GRAPH_TYPE::out_edge_iterator it;
+    typename BOOST_DELTA_CSR_GRAPH_TYPE::adjacency_iterator first, last;
+    boost::tie(first, last) = adjacent_vertices(v, g);
+    return std::make_pair(it(v, first), it(v, last));
+}
+
+template < BOOST_DELTA_CSR_GRAPH_TEMPLATE_PARMS >
+inline EdgeIndex out_degree(Vertex v, const BOOST_DELTA_CSR_GRAPH_TYPE& g)
+{
+    return g.m_rowstart[v + 1] - g.m_rowstart[v];
+}
+
+// From EdgeListGraph
+template < BOOST_DELTA_CSR_GRAPH_TEMPLATE_PARMS >
+inline EdgeIndex num_edges(const BOOST_DELTA_CSR_GRAPH_TYPE& g)
+{
+    return g.m_rowstart.back();
+}
+
+template < BOOST_DELTA_CSR_GRAPH_TEMPLATE_PARMS >
+std::pair< typename BOOST_DELTA_CSR_GRAPH_TYPE::edge_iterator,
+    typename BOOST_DELTA_CSR_GRAPH_TYPE::edge_iterator >
+edges(const BOOST_DELTA_CSR_GRAPH_TYPE& g)
+{
+    typedef typename BOOST_DELTA_CSR_GRAPH_TYPE::edge_iterator ei;
+    typedef typename BOOST_DELTA_CSR_GRAPH_TYPE::out_edge_iterator oei;
+    if (num_edges(g) == 0)
+        return std::make_pair(ei(), ei());
+    Vertex last = num_vertices(g) - 1;
+    oei first, first_end, end;
+    boost::tie(first, first_end) = out_edges(Vertex(0), g);
+    end = out_edges(last, g).second;
+    return std::make_pair(
+        ei(g, Vertex(0), first, first_end), ei(g, last, end, end));
+}
+
+// Property maps: the vertex and edge indices, and the edge bundles
+template < BOOST_DELTA_CSR_GRAPH_TEMPLATE_PARMS >
+struct property_map< BOOST_DELTA_CSR_GRAPH_TYPE, vertex_index_t >
+{
+    typedef typed_identity_property_map< Vertex > type;
+    typedef type const_type;
+};
+
+template < BOOST_DELTA_CSR_GRAPH_TEMPLATE_PARMS >
+struct property_map< BOOST_DELTA_CSR_GRAPH_TYPE, edge_index_t >
+{
+    typedef detail::csr_edge_index_map< Vertex, EdgeIndex > type;
+    typedef type const_type;
+};
+
+template < BOOST_DELTA_CSR_GRAPH_TEMPLATE_PARMS >
+struct property_map< BOOST_DELTA_CSR_GRAPH_TYPE, edge_bundle_t >
+{
+    typedef iterator_property_map<
+        typename std::vector< EdgeProperty >::const_iterator,
+        detail::csr_edge_index_map< Vertex, EdgeIndex >, EdgeProperty,
+        const EdgeProperty& >
+        type;
+    typedef type const_type;
+};
+
+template < BOOST_DELTA_CSR_GRAPH_TEMPLATE_PARMS >
+inline typed_identity_property_map< Vertex > get(
+    vertex_index_t, const BOOST_DELTA_CSR_GRAPH_TYPE&)
+{
+    return typed_identity_property_map< Vertex >();
+}
+
+template < BOOST_DELTA_CSR_GRAPH_TEMPLATE_PARMS >
+inline Vertex get(vertex_index_t, const BOOST_DELTA_CSR_GRAPH_TYPE&, Vertex v)
+{
+    return v;
+}
+
+template < BOOST_DELTA_CSR_GRAPH_TEMPLATE_PARMS >
+inline detail::csr_edge_index_map< Vertex, EdgeIndex > get(
+    edge_index_t, const BOOST_DELTA_CSR_GRAPH_TYPE&)
+{
+    return detail::csr_edge_index_map< Vertex, EdgeIndex >();
+}
+
+template < BOOST_DELTA_CSR_GRAPH_TEMPLATE_PARMS >
+inline EdgeIndex get(edge_index_t, const BOOST_DELTA_CSR_GRAPH_TYPE&,
+    typename BOOST_DELTA_CSR_GRAPH_TYPE::edge_descriptor e)
+{
+    return e.idx;
+}
+
+template < BOOST_DELTA_CSR_GRAPH_TEMPLATE_PARMS >
+inline typename property_map< BOOST_DELTA_CSR_GRAPH_TYPE,
+    edge_bundle_t >::const_type
+get(edge_bundle_t, const BOOST_DELTA_CSR_GRAPH_TYPE& g)
+{
+    BOOST_STATIC_ASSERT_MSG((!is_same< EdgeProperty, no_property >::value),
+        "delta_compressed_csr_graph has no edge bundles");
+    return typename property_map< BOOST_DELTA_CSR_GRAPH_TYPE,
+        edge_bundle_t >::const_type(g.m_edge_properties.begin());
+}
+
+#undef BOOST_DELTA_CSR_GRAPH_TYPE
+#undef BOOST_DELTA_CSR_GRAPH_TEMPLATE_PARMS
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_DELTA_COMPRESSED_CSR_GRAPH_HPP
@@ -0,0 +1,444 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Multi-threaded single-source shortest paths by delta-stepping (Meyer and
+// Sanders, "Delta-stepping: a parallelizable shortest path algorithm",
+// J. Algorithms 49, 2003).  Vertices are kept in buckets of width delta by
+// tentative distance.  The lowest non-empty bucket is emptied by relaxing
+// the light edges (weight <= delta) of its vertices in parallel, which may
+// refill it, until it stays empty; the heavy edges of every vertex removed
+// from it are then relaxed once.
+
+#ifndef BOOST_GRAPH_DELTA_STEPPING_SHORTEST_PATHS_HPP
+#define BOOST_GRAPH_DELTA_STEPPING_SHORTEST_PATHS_HPP
+
+#include <boost/config.hpp>
+#include <boost/graph/detail/parallel_for.hpp>
+#include <boost/graph/exception.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/named_function_params.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_arithmetic.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <vector>
+
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+#include <atomic>
+#endif
+
+namespace boost
+{
+
+namespace detail
+{
+    // The most buckets a relaxation may skip ahead; delta is raised if
+    // the heaviest edge would span more
+    const std::size_t delta_stepping_max_span = std::size_t(1) << 20;
+
+    // Frontier vertices handed out at a time
+    const std::size_t delta_stepping_grain = 256;
+
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+    template < typename T > class delta_stepping_atomic
+    {
+    public:
+        delta_stepping_atomic() : m_value() {}
+        T load() const { return m_value.load(std::memory_order_relaxed); }
+        void store(T x) { m_value.store(x, std::memory_order_relaxed); }
+        T exchange(T x)
+        {
+            return m_value.exchange(x, std::memory_order_relaxed);
+        }
+        T fetch_add(T x)
+        {
+            return m_value.fetch_add(x, std::memory_order_relaxed);
+        }
+        // Lowers the value to x if x is smaller
+        void fetch_min(T x)
+        {
+            T old = load();
+            while (x < old
+                && !m_value.compare_exchange_weak(
+                    old, x, std::memory_order_relaxed))
+            {
+            }
+        }
+
+    private:
+        std::atomic< T > m_value;
+    };
+
+    // Guards the distance and predecessor of one vertex
+    class delta_stepping_lock
+    {
+    public:
+        delta_stepping_lock() { m_flag.clear(); }
+        void lock()
+        {
+            while (m_flag.test_and_set(std::memory_order_acquire))
+            {
+            }
+        }
+        void unlock() { m_flag.clear(std::memory_order_release); }
+
+    private:
+        std::atomic_flag m_flag;
+    };
+#else
+    template < typename T > class delta_stepping_atomic
+    {
+    public:
+        delta_stepping_atomic() : m_value() {}
+        T load() const { return m_value; }
+        void store(T x) { m_value = x; }
+        T exchange(T x)
+        {
+            T old = m_value;
+            m_value = x;
+            return old;
+        }
+        T fetch_add(T x)
+        {
+            T old = m_value;
+            m_value += x;
+            return old;
+        }
+        void fetch_min(T x) { m_value = (std::min)(m_value, x); }
+
+    private:
+        T m_value;
+    };
+
+    class delta_stepping_lock
+    {
+    public:
+        void lock() {}
+        void unlock() {}
+    };
+#endif
+
+    // The bucket width used when the caller passes 0: the heaviest edge
+    // divided by the average out-degree (Meyer and Sanders' choice for
+    // random weights), and at least 1 for integral weights
+    template < typename Weight >
+    Weight delta_stepping_default_delta(
+        Weight max_weight, std::size_t num_edges, std::size_t num_vertices)
+    {
+        double avg_degree = num_vertices == 0
+            ? 1.0
+            : double(num_edges) / double(num_vertices);
+        double delta = double(max_weight) / (std::max)(avg_degree, 1.0);
+        if (std::numeric_limits< Weight >::is_integer)
+            delta = (std::max)(delta, 1.0);
+        return Weight(delta);
+    }
+
+    template < typename Graph, typename WeightMap, typename DistanceMap,
+        typename PredecessorMap, typename VertexIndexMap >
+    void delta_stepping_impl(const Graph& g,
+        typename graph_traits< Graph >::vertex_descriptor s, WeightMap weight,
+        DistanceMap distance, PredecessorMap predecessor,
+        VertexIndexMap index,
+        typename property_traits< DistanceMap >::value_type delta,
+        std::size_t num_threads)
+    {
+        typedef typename graph_traits< Graph >::vertex_descriptor Vertex;
+        typedef typename graph_traits< Graph >::out_edge_iterator OutEdgeIter;
+        typedef typename property_traits< WeightMap >::value_type Weight;
+        typedef typename property_traits< DistanceMap >::value_type Distance;
+        BOOST_STATIC_ASSERT(is_arithmetic< Weight >::value);
+        BOOST_STATIC_ASSERT(is_arithmetic< Distance >::value);
+        using boost::graph::detail::parallel_for_blocks;
+
+        const std::size_t n = num_vertices(g);
+        const Distance inf = (std::numeric_limits< Distance >::max)();
+        num_threads = boost::graph::detail::resolve_num_threads(num_threads);
+
+        std::vector< Vertex > vertex_of(n);
+        {
+            typename graph_traits< Graph >::vertex_iterator vi, vi_end;
+            for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+                vertex_of[get(index, *vi)] = *vi;
+        }
+
+        // Check the weights and find the heaviest edge
+        std::vector< Distance > block_max(num_threads, Distance(0));
+        std::vector< std::size_t > block_edges(num_threads, 0);
+        parallel_for_blocks(n, num_threads,
+            [&](std::size_t t, std::size_t first, std::size_t last) {
+                std::less< Weight > less;
+                for (std::size_t v = first; v < last; ++v)
+                {
+                    OutEdgeIter ei, ei_end;
+                    for (boost::tie(ei, ei_end) = out_edges(vertex_of[v], g);
+                         ei != ei_end; ++ei)
+                    {
+                        Weight w = get(weight, *ei);
+                        if (less(w, Weight(0)))
+                            throw negative_edge();
+                        block_max[t] = (std::max)(block_max[t], Distance(w));
+                        ++block_edges[t];
+                    }
+                }
+            });
+        Distance max_weight = Distance(0);
+        std::size_t m = 0;
+        for (std::size_t t = 0; t < num_threads; ++t)
+        {
+            max_weight = (std::max)(max_weight, block_max[t]);
+            m += block_edges[t];
+        }
+        if (!(delta > Distance(0)))
+            delta = delta_stepping_default_delta(max_weight, m, n);
+        if (!(delta > Distance(0)))
+            delta = Distance(1);
+        if (max_weight / delta > Distance(delta_stepping_max_span))
+            delta = max_weight / Distance(delta_stepping_max_span);
+        if (std::numeric_limits< Distance >::is_integer)
+            delta = (std::max)(delta, Distance(1));
+
+        // Buckets are cyclic: a relaxation from bucket i lands in
+        // [i, i + max_weight / delta + 1], plus one for rounding
+        const std::size_t num_bins
+            = std::size_t(max_weight / delta) + std::size_t(3);
+        auto bucket_of = [&](Distance d) { return std::size_t(d / delta); };
+
+        std::vector< delta_stepping_atomic< Distance > > dist(n);
+        std::vector< delta_stepping_lock > locks(n);
+        std::vector< std::size_t > pred(n);
+        // The bucket round in which each vertex last joined a heavy list
+        std::vector< delta_stepping_atomic< std::size_t > > heavy_round(n);
+        parallel_for_blocks(n, num_threads,
+            [&](std::size_t, std::size_t first, std::size_t last) {
+                for (std::size_t v = first; v < last; ++v)
+                {
+                    dist[v].store(inf);
+                    pred[v] = v;
+                    heavy_round[v].store(std::size_t(-1));
+                }
+            });
+        const std::size_t src = get(index, s);
+        dist[src].store(Distance(0));
+
+        // Shared state.  Counters come in pairs used by alternating light
+        // phases (and bucket rounds), so that worker 0 can reset the pair
+        // of the next one while the others still read the current one.
+        std::vector< std::size_t > frontier;
+        delta_stepping_atomic< std::size_t > frontier_size[2], next_chunk[2],
+            next_bucket[2];
+        next_bucket[0].store(std::size_t(-1));
+        next_bucket[1].store(std::size_t(-1));
+
+        typedef boost::graph::detail::thread_barrier barrier_type;
+        boost::graph::detail::run_with_barrier(num_threads, [&](std::size_t t,
+                                                  barrier_type& barrier) {
+            std::vector< std::vector< std::size_t > > bins(num_bins);
+            std::vector< std::size_t > heavy;
+            if (t == 0)
+                bins[0].push_back(src);
+
+            // Lowers the distance of v to d through u, and files v in the
+            // bucket of d
+            auto relax = [&](std::size_t u, std::size_t v, Distance d) {
+                if (!(d < dist[v].load()))
+                    return;
+                locks[v].lock();
+                bool better = d < dist[v].load();
+                if (better)
+                {
+                    dist[v].store(d);
+                    pred[v] = u;
+                }
+                locks[v].unlock();
+                if (better)
+                    bins[bucket_of(d) % num_bins].push_back(v);
+            };
+
+            std::size_t phase = 0;
+            for (std::size_t round = 0, current = 0;; ++round)
+            {
+                // Light phases: gather the bucket from all workers into
+                // the frontier and relax the light edges of its vertices
+                for (;; ++phase)
+                {
+                    const std::size_t p = phase % 2;
+                    std::vector< std::size_t >& bin
+                        = bins[current % num_bins];
+                    std::size_t offset
+                        = frontier_size[p].fetch_add(bin.size());
+                    barrier.wait();
+                    if (t == 0)
+                    {
+                        std::size_t size = frontier_size[p].load();
+                        if (frontier.size() < size)
+                            frontier.resize(size);
+                        frontier_size[1 - p].store(0);
+                        next_chunk[1 - p].store(0);
+                    }
+                    barrier.wait();
+                    std::copy(
+                        bin.begin(), bin.end(), frontier.begin() + offset);
+                    bin.clear();
+                    barrier.wait();
+                    const std::size_t size = frontier_size[p].load();
+                    if (size == 0)
+                    {
+                        ++phase;
+                        break;
+                    }
+                    for (;;)
+                    {
+                        std::size_t first
+                            = next_chunk[p].fetch_add(delta_stepping_grain);
+                        if (first >= size)
+                            break;
+                        std::size_t last
+                            = (std::min)(size, first + delta_stepping_grain);
+                        for (std::size_t i = first; i < last; ++i)
+                        {
+                            std::size_t u = frontier[i];
+                            Distance du = dist[u].load();
+                            // Skip stale entries of vertices that have
+                            // already moved to a lower bucket
+                            if (bucket_of(du) != current)
+                                continue;
+                            if (heavy_round[u].exchange(round) != round)
+                                heavy.push_back(u);
+                            OutEdgeIter ei, ei_end;
+                            for (boost::tie(ei, ei_end)
+                                 = out_edges(vertex_of[u], g);
+                                 ei != ei_end; ++ei)
+                            {
+                                Distance w = Distance(get(weight, *ei));
+                                if (w <= delta)
+                                    relax(u, get(index, target(*ei, g)),
+                                        Distance(du + w));
+                            }
+                        }
+                    }
+                }
+
+                // Heavy phase: the distances of the bucket are final
+                for (std::size_t i = 0; i < heavy.size(); ++i)
+                {
+                    std::size_t u = heavy[i];
+                    Distance du = dist[u].load();
+                    OutEdgeIter ei, ei_end;
+                    for (boost::tie(ei, ei_end) = out_edges(vertex_of[u], g);
+                         ei != ei_end; ++ei)
+                    {
+                        Distance w = Distance(get(weight, *ei));
+                        if (w > delta)
+                            relax(u, get(index, target(*ei, g)),
+                                Distance(du + w));
+                    }
+                }
+                heavy.clear();
+
+                // Move on to the lowest bucket that any worker holds.  The
+                // current one is scanned too, in case rounding put a heavy
+                // relaxation there.
+                const std::size_t r = round % 2;
+                for (std::size_t k = 0; k < num_bins; ++k)
+                    if (!bins[(current + k) % num_bins].empty())
+                    {
+                        next_bucket[r].fetch_min(current + k);
+                        break;
+                    }
+                barrier.wait();
+                current = next_bucket[r].load();
+                if (t == 0)
+                    next_bucket[1 - r].store(std::size_t(-1));
+                if (current == std::size_t(-1))
+                    break;
+            }
+        });
+
+        parallel_for_blocks(n, num_threads,
+            [&](std::size_t, std::size_t first, std::size_t last) {
+                for (std::size_t v = first; v < last; ++v)
+                {
+                    put(distance, vertex_of[v], dist[v].load());
+                    put(predecessor, vertex_of[v], vertex_of[pred[v]]);
+                }
+            });
+    }
+} // namespace detail
+
+// Computes shortest-path distances from s and a shortest-path tree over
+// non-negative edge weights, using num_threads threads (0 for one per
+// hardware thread) and buckets of width delta (0 to choose one from the
+// weights).  Unreached vertices get the largest distance value and
+// themselves as predecessor.  Throws negative_edge if a weight is
+// negative.
+template < typename Graph, typename WeightMap, typename DistanceMap,
+    typename PredecessorMap, typename VertexIndexMap >
+void delta_stepping_shortest_paths(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s, WeightMap weight,
+    DistanceMap distance, PredecessorMap predecessor, VertexIndexMap index,
+    typename property_traits< DistanceMap >::value_type delta = 0,
+    std::size_t num_threads = 0)
+{
+    detail::delta_stepping_impl(
+        g, s, weight, distance, predecessor, index, delta, num_threads);
+}
+
+namespace detail
+{
+    template < typename Graph, typename WeightMap, typename DistanceMap,
+        typename P, typename T, typename R >
+    void delta_stepping_dispatch(const Graph& g,
+        typename graph_traits< Graph >::vertex_descriptor s, WeightMap weight,
+        DistanceMap distance, const bgl_named_params< P, T, R >& params)
+    {
+        typedef typename property_traits< DistanceMap >::value_type Distance;
+        delta_stepping_impl(g, s, weight, distance,
+            choose_param(
+                get_param(params, vertex_predecessor), dummy_property_map()),
+            choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+            Distance(choose_param(
+                get_param(params, bucket_width_t()), Distance(0))),
+            choose_param(get_param(params, num_threads_t()), std::size_t(0)));
+    }
+
+    template < typename Graph, typename WeightMap, typename P, typename T,
+        typename R >
+    void delta_stepping_dispatch(const Graph& g,
+        typename graph_traits< Graph >::vertex_descriptor s, WeightMap weight,
+        param_not_found, const bgl_named_params< P, T, R >& params)
+    {
+        typedef typename property_traits< WeightMap >::value_type Weight;
+        std::vector< Weight > distance(num_vertices(g));
+        delta_stepping_dispatch(g, s, weight,
+            make_iterator_property_map(distance.begin(),
+                choose_const_pmap(
+                    get_param(params, vertex_index), g, vertex_index)),
+            params);
+    }
+} // namespace detail
+
+// Named parameter version: weight_map, distance_map, predecessor_map,
+// vertex_index_map, bucket_width and num_threads
+template < typename Graph, typename P, typename T, typename R >
+void delta_stepping_shortest_paths(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s,
+    const bgl_named_params< P, T, R >& params)
+{
+    detail::delta_stepping_dispatch(g, s,
+        choose_const_pmap(get_param(params, edge_weight), g, edge_weight),
+        get_param(params, vertex_distance), params);
+}
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_DELTA_STEPPING_SHORTEST_PATHS_HPP
@@ -0,0 +1,170 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#ifndef BOOST_GRAPH_DETAIL_BUCKET_QUEUE_HPP
+#define BOOST_GRAPH_DETAIL_BUCKET_QUEUE_HPP
+
+#include <boost/assert.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace boost
+{
+
+// Dial's bucket queue (Dial, "Algorithm 360: shortest-path forest with
+// topological ordering", CACM 12, 1969) using an indirect key, for
+// non-negative integral keys.  All stored keys must lie within span of the
+// smallest one and be at least the key of the last value removed, which
+// holds for the distances of Dijkstra's algorithm when span is the largest
+// edge weight.  The span + 1 buckets are used cyclically: pop scans
+// forward from the last removed key, so a whole run of Dijkstra's
+// algorithm costs O(V + E + D) for a largest distance D.
+//
+// - bucket_queue_indirect is a model of UpdatableQueue as is needed for
+//   dijkstra_shortest_paths.
+//
+// - IndexInHeapMap must be a ReadWritePropertyMap from Value to
+//   std::size_t; it holds the bucket and the position in the bucket of
+//   each stored value.
+// - DistanceMap must be a ReadablePropertyMap from Value to a
+//   non-negative integral type.
+//
+template < typename Value, typename IndexInHeapPropertyMap,
+    typename DistanceMap >
+class bucket_queue_indirect
+{
+public:
+    typedef std::size_t size_type;
+    typedef Value value_type;
+    typedef typename boost::property_traits< DistanceMap >::value_type key_type;
+    typedef DistanceMap key_map;
+    BOOST_STATIC_ASSERT(is_integral< key_type >::value);
+
+    bucket_queue_indirect(DistanceMap distance,
+        IndexInHeapPropertyMap index_in_heap, boost::uintmax_t span)
+    : m_buckets(std::size_t(span) + 1)
+    , m_size(0)
+    , m_current(0)
+    , m_distance(distance)
+    , m_index_in_heap(index_in_heap)
+    {
+    }
+
+    size_type size() const { return m_size; }
+
+    bool empty() const { return m_size == 0; }
+
+    void push(const Value& v)
+    {
+        boost::uintmax_t k = key(v);
+        // Once the queue has run empty, the scan restarts at the next key
+        // pushed unless that key is within reach of the last removed one
+        if (m_size == 0
+            && (k < m_current || k - m_current >= m_buckets.size()))
+            m_current = k;
+        insert(v, std::size_t(k % m_buckets.size()));
+        ++m_size;
+    }
+
+    Value& top()
+    {
+        BOOST_ASSERT(!this->empty());
+        return current_bucket().back();
+    }
+
+    void pop()
+    {
+        BOOST_ASSERT(!this->empty());
+        std::vector< Value >& bucket = current_bucket();
+        put(m_index_in_heap, bucket.back(), (size_type)(-1));
+        bucket.pop_back();
+        --m_size;
+    }
+
+    // Moves v after its key has been decreased
+    void update(const Value& v)
+    {
+        size_type index = get(m_index_in_heap, v);
+        std::size_t b = std::size_t(key(v) % m_buckets.size());
+        if (b != index % m_buckets.size())
+        {
+            erase(index);
+            insert(v, b);
+        }
+    }
+
+    bool contains(const Value& v) const
+    {
+        return get(m_index_in_heap, v) != (size_type)(-1);
+    }
+
+    void push_or_update(const Value& v)
+    {
+        if (contains(v))
+            update(v);
+        else
+            push(v);
+    }
+
+    DistanceMap keys() const { return m_distance; }
+
+private:
+    boost::uintmax_t key(const Value& v) const
+    {
+        BOOST_ASSERT(!(get(m_distance, v) < key_type(0)));
+        boost::uintmax_t k = boost::uintmax_t(get(m_distance, v));
+        BOOST_ASSERT(m_size == 0
+            || (k >= m_current && k - m_current < m_buckets.size()));
+        return k;
+    }
+
+    // Index map entries combine the bucket and the position within it
+    void insert(const Value& v, std::size_t b)
+    {
+        put(m_index_in_heap, v, m_buckets[b].size() * m_buckets.size() + b);
+        m_buckets[b].push_back(v);
+    }
+
+    void erase(size_type index)
+    {
+        std::vector< Value >& bucket = m_buckets[index % m_buckets.size()];
+        size_type pos = index / m_buckets.size();
+        if (pos + 1 != bucket.size())
+        {
+            bucket[pos] = bucket.back();
+            put(m_index_in_heap, bucket[pos], index);
+        }
+        bucket.pop_back();
+    }
+
+    std::vector< Value >& current_bucket()
+    {
+        for (;;)
+        {
+            std::vector< Value >& bucket
+                = m_buckets[m_current % m_buckets.size()];
+            if (!bucket.empty())
+                return bucket;
+            ++m_current;
+        }
+    }
+
+    std::vector< std::vector< Value > > m_buckets;
+    size_type m_size;
+    boost::uintmax_t m_current;
+    DistanceMap m_distance;
+    IndexInHeapPropertyMap m_index_in_heap;
+};
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_DETAIL_BUCKET_QUEUE_HPP
@@ -18,6 +18,7 @@
 #endif
 
 #include <vector>
+#include <memory>
 #include <utility>
 #include <algorithm>
 #include <climits>
@@ -69,34 +70,65 @@ namespace detail
         return key.idx;
     }
 
+    // Move the contents of src into dest.  Vectors with the same allocator
+    // type are swapped; otherwise the elements are copied and src is
+    // emptied.
+    template < typename T, typename Alloc >
+    void csr_take_vector(std::vector< T, Alloc >& dest,
+        std::vector< T, Alloc >& src)
+    {
+        dest.swap(src);
+    }
+
+    template < typename T, typename DestAlloc, typename SrcAlloc >
+    void csr_take_vector(std::vector< T, DestAlloc >& dest,
+        std::vector< T, SrcAlloc >& src)
+    {
+        dest.assign(src.begin(), src.end());
+        std::vector< T, SrcAlloc >().swap(src);
+    }
+
     /** Compressed sparse row graph internal structure.
      *
      * Vertex and EdgeIndex should be unsigned integral types and should
-     * specialize numeric_limits.
+     * specialize numeric_limits.  Allocator is rebound to allocate the row,
+     * column and edge property arrays.
      */
     template < typename EdgeProperty, typename Vertex = std::size_t,
-        typename EdgeIndex = Vertex >
+        typename EdgeIndex = Vertex,
+        typename Allocator = std::allocator< bool > >
     class compressed_sparse_row_structure
     : public detail::indexed_edge_properties<
-          compressed_sparse_row_structure< EdgeProperty, Vertex, EdgeIndex >,
+          compressed_sparse_row_structure< EdgeProperty, Vertex, EdgeIndex,
+              Allocator >,
           EdgeProperty, csr_edge_descriptor< Vertex, EdgeIndex >,
-          csr_edge_index_map< Vertex, EdgeIndex > >
+          csr_edge_index_map< Vertex, EdgeIndex >, Allocator >
     {
     public:
         typedef detail::indexed_edge_properties<
-            compressed_sparse_row_structure< EdgeProperty, Vertex, EdgeIndex >,
+            compressed_sparse_row_structure< EdgeProperty, Vertex, EdgeIndex,
+                Allocator >,
             EdgeProperty, csr_edge_descriptor< Vertex, EdgeIndex >,
-            csr_edge_index_map< Vertex, EdgeIndex > >
+            csr_edge_index_map< Vertex, EdgeIndex >, Allocator >
             inherited_edge_properties;
 
         typedef Vertex vertices_size_type;
         typedef Vertex vertex_descriptor;
         typedef EdgeIndex edges_size_type;
 
+        typedef std::vector< EdgeIndex,
+            typename std::allocator_traits<
+                Allocator >::template rebind_alloc< EdgeIndex > >
+            rowstart_type;
+        typedef std::vector< Vertex,
+            typename std::allocator_traits<
+                Allocator >::template rebind_alloc< Vertex > >
+            column_type;
+
         static vertex_descriptor null_vertex() { return vertex_descriptor(-1); }
 
-        std::vector< EdgeIndex > m_rowstart;
-        std::vector< Vertex > m_column;
+        rowstart_type m_rowstart;
+        column_type m_column;
 
         compressed_sparse_row_structure(Vertex numverts = 0)
         : m_rowstart(numverts + 1, EdgeIndex(0)), m_column()
@@ -192,6 +224,197 @@ namespace detail
                 boost::make_property_map_function(global_to_local));
         }
 
+        //  Relabel each vertex v as get(perm, v), which must be a permutation
+        //  of [0, numverts).  The out-edges of each vertex keep their order.
+        template < typename PermutationMap >
+        void permute_vertices(const PermutationMap& perm)
+        {
+            std::size_t numverts = m_rowstart.size() - 1;
+            rowstart_type new_rowstart(numverts + 1, 0);
+            for (std::size_t v = 0; v < numverts; ++v)
+                new_rowstart[get(perm, Vertex(v)) + 1]
+                    = m_rowstart[v + 1] - m_rowstart[v];
+            for (std::size_t v = 0; v < numverts; ++v)
+                new_rowstart[v + 1] += new_rowstart[v];
+
+            column_type new_column(m_column.size());
+            std::vector< std::size_t > old_edge(m_column.size());
+            for (std::size_t v = 0; v < numverts; ++v)
+            {
+                EdgeIndex pos = new_rowstart[get(perm, Vertex(v))];
+                for (EdgeIndex i = m_rowstart[v]; i != m_rowstart[v + 1];
+                     ++i, ++pos)
+                {
+                    new_column[pos] = get(perm, m_column[i]);
+                    old_edge[pos] = i;
+                }
+            }
+            m_rowstart.swap(new_rowstart);
+            m_column.swap(new_column);
+            inherited_edge_properties::permute(old_edge);
+        }
+
+        //  Rebuild graph from number of vertices and a random-access range of
+        //  unsorted edges, counting and scattering the edges on num_threads
+        //  threads (0 means one per hardware thread).  The result is
+        //  identical to that of assign_unsorted_multi_pass_edges.
+        template < typename RandomAccessIterator >
+        void assign_unsorted_edges_parallel(RandomAccessIterator edge_begin,
+            RandomAccessIterator edge_end, vertices_size_type numverts,
+            std::size_t num_threads)
+        {
+            assign_unsorted_edges_parallel_impl(edge_begin, edge_end,
+                numverts, num_threads, csr_default_edge_property_sink());
+        }
+
+        //  Rebuild graph from number of vertices and random-access ranges of
+        //  unsorted edges and their properties using num_threads threads
+        template < typename RandomAccessIterator,
+            typename EdgePropertyIterator >
+        void assign_unsorted_edges_parallel(RandomAccessIterator edge_begin,
+            RandomAccessIterator edge_end, EdgePropertyIterator ep_iter,
+            vertices_size_type numverts, std::size_t num_threads)
+        {
+            assign_unsorted_edges_parallel_impl(edge_begin, edge_end,
+                numverts, num_threads,
+                csr_copy_edge_property_sink< EdgePropertyIterator >(ep_iter));
+        }
+
+    private:
+        // The property sinks of assign_unsorted_edges_parallel:
+        // sink(props, i, pos) stores the property of input edge i at
+        // props[pos]
+        struct csr_default_edge_property_sink
+        {
+            template < typename Iterator >
+            void operator()(Iterator, std::size_t, EdgeIndex) const
+            {
+            }
+        };
+
+        template < typename EdgePropertyIterator >
+        struct csr_copy_edge_property_sink
+        {
+            explicit csr_copy_edge_property_sink(EdgePropertyIterator ep_iter)
+            : m_ep_iter(ep_iter)
+            {
+            }
+            template < typename Iterator >
+            void operator()(Iterator props, std::size_t i, EdgeIndex pos) const
+            {
+                props[pos] = *(m_ep_iter + i);
+            }
+            EdgePropertyIterator m_ep_iter;
+        };
+
+        template < typename RandomAccessIterator, typename PropertySink >
+        void assign_unsorted_edges_parallel_impl(
+            RandomAccessIterator edge_begin, RandomAccessIterator edge_end,
+            vertices_size_type numverts, std::size_t num_threads,
+            PropertySink sink)
+        {
+            m_rowstart.clear();
+            m_rowstart.resize(numverts + 1, 0);
+            typedef std::pair< vertices_size_type, vertices_size_type >
+                edge_type;
+            typedef boost::transform_iterator<
+                boost::graph::detail::project1st< edge_type >,
+                RandomAccessIterator >
+                source_iterator;
+            typedef boost::transform_iterator<
+                boost::graph::detail::project2nd< edge_type >,
+                RandomAccessIterator >
+                target_iterator;
+            source_iterator sources_begin(
+                edge_begin, boost::graph::detail::project1st< edge_type >());
+            source_iterator sources_end(
+                edge_end, boost::graph::detail::project1st< edge_type >());
+            target_iterator targets_begin(
+                edge_begin, boost::graph::detail::project2nd< edge_type >());
+
+            typedef std::vector< std::vector< EdgeIndex > > block_positions;
+            block_positions positions;
+            boost::graph::detail::count_starts_parallel(sources_begin,
+                sources_end, m_rowstart.begin(), numverts,
+                boost::make_property_map_function(
+                    typed_identity_property_map< vertices_size_type >()),
+                positions, num_threads);
+
+            m_column.resize(m_rowstart.back());
+            inherited_edge_properties::resize(m_rowstart.back());
+
+            typename column_type::iterator column = m_column.begin();
+            typename inherited_edge_properties::iterator props
+                = inherited_edge_properties::begin();
+            boost::graph::detail::histogram_scatter_parallel(sources_begin,
+                sources_end, numverts,
+                boost::make_property_map_function(
+                    typed_identity_property_map< vertices_size_type >()),
+                positions, [&](std::size_t i, EdgeIndex pos) {
+                    column[pos] = *(targets_begin + i);
+                    sink(props, i, pos);
+                });
+        }
+
+    public:
+        //  Rebuild as the transpose of forward, storing for each edge the
+        //  index it has in forward.  The edges of each row keep the order of
+        //  their forward indices, as when the transposed edge list is passed
+        //  to assign_unsorted_multi_pass_edges.  Uses num_threads threads (0
+        //  means one per hardware thread).
+        template < typename ForwardStructure >
+        void assign_transpose_parallel(
+            const ForwardStructure& forward, std::size_t num_threads)
+        {
+            vertices_size_type numverts
+                = vertices_size_type(forward.m_rowstart.size() - 1);
+            m_rowstart.clear();
+            m_rowstart.resize(numverts + 1, 0);
+
+            typedef std::vector< std::vector< EdgeIndex > > block_positions;
+            block_positions positions;
+            boost::graph::detail::count_starts_parallel(
+                forward.m_column.begin(), forward.m_column.end(),
+                m_rowstart.begin(), numverts,
+                boost::make_property_map_function(
+                    typed_identity_property_map< vertices_size_type >()),
+                positions, num_threads);
+
+            m_column.resize(m_rowstart.back());
+            inherited_edge_properties::resize(m_rowstart.back());
+
+            // Same partition as count_starts_parallel; each block locates the
+            // source of its first edge and then walks the forward rows
+            const std::size_t numedges = forward.m_column.size();
+            const std::size_t num_blocks = positions.size();
+            typename column_type::iterator column = m_column.begin();
+            typename inherited_edge_properties::iterator props
+                = inherited_edge_properties::begin();
+            boost::graph::detail::run_in_parallel(
+                num_blocks, [&](std::size_t t) {
+                    std::vector< EdgeIndex >& insert_positions = positions[t];
+                    std::size_t i = boost::graph::detail::block_begin(
+                        numedges, num_blocks, t);
+                    std::size_t end = boost::graph::detail::block_begin(
+                        numedges, num_blocks, t + 1);
+                    if (i == end)
+                        return;
+                    std::size_t src = std::size_t(
+                        std::upper_bound(forward.m_rowstart.begin(),
+                            forward.m_rowstart.end(), EdgeIndex(i))
+                        - forward.m_rowstart.begin() - 1);
+                    for (; i < end; ++i)
+                    {
+                        while (std::size_t(forward.m_rowstart[src + 1]) <= i)
+                            ++src;
+                        EdgeIndex pos
+                            = insert_positions[forward.m_column[i]]++;
+                        column[pos] = Vertex(src);
+                        props[pos] = EdgeIndex(i);
+                    }
+                });
+        }
+
         //  Assign from number of vertices and sorted list of edges
         template < typename InputIterator, typename GlobalToLocal,
             typename SourcePred >
@@ -295,7 +518,7 @@ namespace detail
                 boost::make_property_map_function(global_to_local));
             // Now targets is the correct vector (properly sorted by source) for
             // m_column
-            m_column.swap(targets);
+            csr_take_vector(m_column, targets);
             inherited_edge_properties::resize(m_rowstart.back());
         }
 
@@ -325,8 +548,8 @@ namespace detail
                 boost::make_property_map_function(global_to_local));
             // Now targets is the correct vector (properly sorted by source) for
             // m_column, and edge_props for m_edge_properties
-            m_column.swap(targets);
-            this->m_edge_properties.swap(edge_props);
+            csr_take_vector(m_column, targets);
+            csr_take_vector(this->m_edge_properties, edge_props);
         }
 
         // From any graph (slow and uses a lot of memory)
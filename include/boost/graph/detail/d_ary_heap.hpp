@@ -121,6 +121,14 @@ public:
 
     bool empty() const { return data.empty(); }
 
+    // Removes all values, keeping the storage for reuse
+    void clear()
+    {
+        for (size_type i = 0; i < data.size(); ++i)
+            put(index_in_heap, data[i], (size_type)(-1));
+        data.clear();
+    }
+
     void push(const Value& v)
     {
         size_type index = data.size();
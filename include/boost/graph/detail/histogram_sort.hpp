@@ -11,6 +11,11 @@
 #define BOOST_GRAPH_DETAIL_HISTOGRAM_SORT_HPP
 
 #include <boost/assert.hpp>
+#include <boost/core/ignore_unused.hpp>
+#include <boost/graph/detail/parallel_for.hpp>
+#include <algorithm>
+#include <iterator>
+#include <vector>
 
 namespace boost
 {
@@ -233,6 +238,125 @@ namespace graph
             }
         }
 
+        // Multithreaded version of count_starts for random-access keys.  The
+        // keys are split into contiguous blocks, one per thread, and each
+        // thread counts the keys of its own block.  On return, starts holds
+        // the row starts and block_positions[t][k] holds the position at
+        // which the first key k of block t goes, so that
+        // histogram_scatter_parallel can place every block independently
+        // while keeping the keys of each row in input order.
+        //
+        // Fewer blocks are used when there are fewer than numkeys + 1 input
+        // keys per thread, which keeps the per-block count arrays no larger
+        // in total than the input itself.
+        template < typename KeyIterator, typename RowstartIterator,
+            typename NumKeys, typename KeyTransform, typename EdgeIndex >
+        void count_starts_parallel(KeyIterator key_begin,
+            KeyIterator key_end,
+            RowstartIterator starts, // Must support numkeys + 1 elements
+            NumKeys numkeys, KeyTransform key_transform,
+            std::vector< std::vector< EdgeIndex > >& block_positions,
+            std::size_t num_threads)
+        {
+            typedef typename std::iterator_traits<
+                KeyIterator >::difference_type difference_type;
+            std::size_t numkeys_s = std::size_t(numkeys);
+            std::size_t n = std::size_t(key_end - key_begin);
+            std::size_t num_blocks = resolve_num_threads(num_threads);
+            num_blocks = (std::min)(
+                num_blocks, (std::max)(std::size_t(1), n / (numkeys_s + 1)));
+
+            // 1. Per-block histograms
+            block_positions.assign(num_blocks, std::vector< EdgeIndex >());
+            run_in_parallel(num_blocks, [&](std::size_t t) {
+                std::vector< EdgeIndex >& counts = block_positions[t];
+                counts.assign(numkeys_s, EdgeIndex(0));
+                std::size_t end = block_begin(n, num_blocks, t + 1);
+                for (std::size_t i = block_begin(n, num_blocks, t); i < end;
+                     ++i)
+                {
+                    NumKeys key = key_transform(
+                        *(key_begin + difference_type(i)));
+                    BOOST_ASSERT(key < numkeys);
+                    ++counts[key];
+                }
+            });
+
+            // 2. Turn the counts of each key into offsets within its row,
+            // and put the degree of each key k into starts[k + 1]
+            parallel_for_blocks(numkeys_s, num_blocks,
+                [&](std::size_t, std::size_t kb, std::size_t ke) {
+                    for (std::size_t k = kb; k < ke; ++k)
+                    {
+                        EdgeIndex degree = 0;
+                        for (std::size_t t = 0; t < num_blocks; ++t)
+                        {
+                            EdgeIndex c = block_positions[t][k];
+                            block_positions[t][k] = degree;
+                            degree += c;
+                        }
+                        starts[k + 1] = degree;
+                    }
+                });
+
+            // 3. Partial sums of the degrees: sum each range of keys, scan the
+            // range totals, then finish each range from its offset
+            std::vector< EdgeIndex > range_offset(num_blocks + 1, 0);
+            parallel_for_blocks(numkeys_s, num_blocks,
+                [&](std::size_t t, std::size_t kb, std::size_t ke) {
+                    EdgeIndex sum = 0;
+                    for (std::size_t k = kb; k < ke; ++k)
+                        sum += starts[k + 1];
+                    range_offset[t + 1] = sum;
+                });
+            for (std::size_t t = 0; t < num_blocks; ++t)
+                range_offset[t + 1] += range_offset[t];
+            starts[0] = 0;
+            parallel_for_blocks(numkeys_s, num_blocks,
+                [&](std::size_t t, std::size_t kb, std::size_t ke) {
+                    EdgeIndex start_of_next_row = range_offset[t];
+                    for (std::size_t k = kb; k < ke; ++k)
+                    {
+                        EdgeIndex start_of_this_row = start_of_next_row;
+                        start_of_next_row += starts[k + 1];
+                        starts[k + 1] = start_of_next_row;
+                        for (std::size_t b = 0; b < num_blocks; ++b)
+                            block_positions[b][k] += start_of_this_row;
+                    }
+                });
+        }
+
+        // Scatters the values of each block of keys into the positions
+        // computed by count_starts_parallel, one thread per block.
+        // move_value(i, pos) must copy the values of input element i to
+        // output position pos.
+        template < typename KeyIterator, typename NumKeys,
+            typename KeyTransform, typename EdgeIndex, typename MoveValue >
+        void histogram_scatter_parallel(KeyIterator key_begin,
+            KeyIterator key_end, NumKeys numkeys, KeyTransform key_transform,
+            std::vector< std::vector< EdgeIndex > >& block_positions,
+            MoveValue move_value)
+        {
+            typedef typename std::iterator_traits<
+                KeyIterator >::difference_type difference_type;
+            std::size_t n = std::size_t(key_end - key_begin);
+            std::size_t num_blocks = block_positions.size();
+            run_in_parallel(num_blocks, [&](std::size_t t) {
+                std::vector< EdgeIndex >& insert_positions
+                    = block_positions[t];
+                std::size_t end = block_begin(n, num_blocks, t + 1);
+                for (std::size_t i = block_begin(n, num_blocks, t); i < end;
+                     ++i)
+                {
+                    NumKeys key = key_transform(
+                        *(key_begin + difference_type(i)));
+                    BOOST_ASSERT(key < numkeys);
+                    boost::ignore_unused(numkeys);
+                    move_value(i, insert_positions[key]++);
+                }
+            });
+        }
+
         template < typename InputIterator, typename VerticesSize >
         void split_into_separate_coords(InputIterator begin, InputIterator end,
             std::vector< VerticesSize >& firsts,
@@ -14,6 +14,7 @@
 #define BOOST_GRAPH_INDEXED_PROPERTIES_HPP
 
 #include <vector>
+#include <memory>
 #include <utility>
 #include <algorithm>
 #include <climits>
@@ -31,17 +32,21 @@ namespace detail
 {
 
     template < typename Derived, typename Property, typename Descriptor,
-        typename IndexMap >
+        typename IndexMap, typename Allocator = std::allocator< Property > >
     class indexed_vertex_properties
     {
     public:
         typedef no_property vertex_property_type;
         typedef Property vertex_bundled;
+        typedef std::vector< Property,
+            typename std::allocator_traits<
+                Allocator >::template rebind_alloc< Property > >
+            vertex_property_vector;
         typedef iterator_property_map<
-            typename std::vector< Property >::iterator, IndexMap >
+            typename vertex_property_vector::iterator, IndexMap >
             vertex_map_type;
         typedef iterator_property_map<
-            typename std::vector< Property >::const_iterator, IndexMap >
+            typename vertex_property_vector::const_iterator, IndexMap >
             const_vertex_map_type;
 
         // Directly access a vertex or edge bundle
@@ -97,6 +102,24 @@ namespace detail
             m_vertex_properties[idx] = prop;
         }
 
+        // Reorder the properties so that element i becomes the element that
+        // was at old_index[i]
+        void permute(const std::vector< std::size_t >& old_index)
+        {
+            vertex_property_vector permuted;
+            permuted.reserve(old_index.size());
+            for (std::size_t i = 0; i < old_index.size(); ++i)
+                permuted.push_back(m_vertex_properties[old_index[i]]);
+            m_vertex_properties.swap(permuted);
+        }
+
+        // Exchange the property values with those of another
+        // indexed_vertex_properties of the same property and allocator types
+        template < typename Other > void swap_properties(Other& x)
+        {
+            m_vertex_properties.swap(x.m_vertex_properties);
+        }
+
         // Access to the derived object
         Derived& derived() { return *static_cast< Derived* >(this); }
 
@@ -106,11 +129,13 @@ namespace detail
         }
 
     public: // should be private, but friend templates not portable
-        std::vector< Property > m_vertex_properties;
+        vertex_property_vector m_vertex_properties;
     };
 
-    template < typename Derived, typename Descriptor, typename IndexMap >
-    class indexed_vertex_properties< Derived, void, Descriptor, IndexMap >
+    template < typename Derived, typename Descriptor, typename IndexMap,
+        typename Allocator >
+    class indexed_vertex_properties< Derived, void, Descriptor, IndexMap,
+        Allocator >
     {
         struct secret
         {
@@ -135,30 +160,51 @@ namespace detail
         void clear() {}
         void resize(std::size_t) {}
         void reserve(std::size_t) {}
+        void permute(const std::vector< std::size_t >&) {}
+        template < typename Other > void swap_properties(Other&) {}
+    };
+
+    // How indexed_edge_properties stores the values of Property: a vector of
+    // Property unless specialized (see soa_edge_bundle.hpp).  value_type is
+    // the bundle type seen by users.
+    template < typename Property, typename Allocator >
+    struct indexed_edge_property_storage
+    {
+        typedef Property value_type;
+        typedef std::vector< Property,
+            typename std::allocator_traits<
+                Allocator >::template rebind_alloc< Property > >
+            type;
     };
 
     template < typename Derived, typename Property, typename Descriptor,
-        typename IndexMap >
+        typename IndexMap, typename Allocator = std::allocator< Property > >
     class indexed_edge_properties
     {
     public:
         typedef no_property edge_property_type;
-        typedef Property edge_bundled;
-        typedef Property edge_push_back_type;
+        typedef typename indexed_edge_property_storage< Property,
+            Allocator >::value_type edge_bundled;
+        typedef edge_bundled edge_push_back_type;
+        typedef typename indexed_edge_property_storage< Property,
+            Allocator >::type edge_property_vector;
+        typedef typename edge_property_vector::reference edge_reference;
+        typedef typename edge_property_vector::const_reference
+            const_edge_reference;
         typedef iterator_property_map<
-            typename std::vector< Property >::iterator, IndexMap >
+            typename edge_property_vector::iterator, IndexMap >
             edge_map_type;
         typedef iterator_property_map<
-            typename std::vector< Property >::const_iterator, IndexMap >
+            typename edge_property_vector::const_iterator, IndexMap >
             const_edge_map_type;
 
         // Directly access a edge or edge bundle
-        Property& operator[](Descriptor v)
+        edge_reference operator[](Descriptor v)
         {
             return m_edge_properties[get(edge_index, derived(), v)];
         }
 
-        const Property& operator[](Descriptor v) const
+        const_edge_reference operator[](Descriptor v) const
         {
             return m_edge_properties[get(edge_index, derived(), v)];
         }
@@ -194,14 +240,14 @@ namespace detail
         void reserve(std::size_t n) { m_edge_properties.reserve(n); }
 
         // Write an element by raw index
-        void write_by_index(std::size_t idx, const Property& prop)
+        void write_by_index(std::size_t idx, const edge_bundled& prop)
         {
             m_edge_properties[idx] = prop;
         }
 
     public:
         // Add a new property value to the back
-        void push_back(const Property& prop)
+        void push_back(const edge_bundled& prop)
         {
             m_edge_properties.push_back(prop);
         }
@@ -215,7 +261,18 @@ namespace detail
                 m_edge_properties.begin() + dest_begin + (src_end - src_begin));
         }
 
-        typedef typename std::vector< Property >::iterator iterator;
+        // Reorder the properties so that element i becomes the element that
+        // was at old_index[i]
+        void permute(const std::vector< std::size_t >& old_index)
+        {
+            edge_property_vector permuted;
+            permuted.reserve(old_index.size());
+            for (std::size_t i = 0; i < old_index.size(); ++i)
+                permuted.push_back(m_edge_properties[old_index[i]]);
+            m_edge_properties.swap(permuted);
+        }
+
+        typedef typename edge_property_vector::iterator iterator;
         iterator begin() { return m_edge_properties.begin(); }
         iterator end() { return m_edge_properties.end(); }
 
@@ -229,7 +286,7 @@ namespace detail
         }
 
     public: // should be private, but friend templates not portable
-        std::vector< Property > m_edge_properties;
+        edge_property_vector m_edge_properties;
     };
 
     struct dummy_no_property_iterator
@@ -248,8 +305,10 @@ namespace detail
         }
     };
 
-    template < typename Derived, typename Descriptor, typename IndexMap >
-    class indexed_edge_properties< Derived, void, Descriptor, IndexMap >
+    template < typename Derived, typename Descriptor, typename IndexMap,
+        typename Allocator >
+    class indexed_edge_properties< Derived, void, Descriptor, IndexMap,
+        Allocator >
     {
         struct secret
         {
@@ -259,6 +318,8 @@ namespace detail
         typedef no_property edge_property_type;
         typedef void edge_bundled;
         typedef void* edge_push_back_type;
+        typedef edge_push_back_type& edge_reference;
+        typedef const edge_push_back_type& const_edge_reference;
         typedef secret edge_map_type;
         typedef secret const_edge_map_type;
 
@@ -285,6 +346,7 @@ namespace detail
             std::size_t /*dest_begin*/)
         {
         }
+        void permute(const std::vector< std::size_t >&) {}
 
         typedef dummy_no_property_iterator iterator;
         iterator begin() { return dummy_no_property_iterator(); }
@@ -0,0 +1,313 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Minimal fork-join helpers used by the multithreaded algorithms.  Each call
+// starts its worker threads, runs them to completion and joins them before
+// returning; the calling thread always acts as worker 0.  Without
+// <thread> support everything runs on the calling thread.
+
+#ifndef BOOST_GRAPH_DETAIL_PARALLEL_FOR_HPP
+#define BOOST_GRAPH_DETAIL_PARALLEL_FOR_HPP
+
+#include <boost/config.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <vector>
+
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+namespace boost
+{
+namespace graph
+{
+    namespace detail
+    {
+
+        // The number of threads used when the caller asks for 0 threads.
+        inline std::size_t default_num_threads()
+        {
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+            unsigned n = std::thread::hardware_concurrency();
+            return n == 0 ? 1 : n;
+#else
+            return 1;
+#endif
+        }
+
+        inline std::size_t resolve_num_threads(std::size_t num_threads)
+        {
+            return num_threads == 0 ? default_num_threads() : num_threads;
+        }
+
+        // Calls f(t) for every t in [0, num_threads), each on its own
+        // thread.  The first exception thrown by any worker is rethrown
+        // after all workers have finished.
+        template < typename Function >
+        void run_in_parallel(std::size_t num_threads, Function f)
+        {
+            num_threads = resolve_num_threads(num_threads);
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+            if (num_threads > 1)
+            {
+                std::exception_ptr error;
+                std::mutex error_mutex;
+                std::vector< std::thread > workers;
+                workers.reserve(num_threads - 1);
+                for (std::size_t t = 1; t < num_threads; ++t)
+                {
+                    workers.push_back(std::thread([&, t]() {
+                        try
+                        {
+                            f(t);
+                        }
+                        catch (...)
+                        {
+                            std::lock_guard< std::mutex > lock(error_mutex);
+                            if (!error)
+                                error = std::current_exception();
+                        }
+                    }));
+                }
+                try
+                {
+                    f(std::size_t(0));
+                }
+                catch (...)
+                {
+                    std::lock_guard< std::mutex > lock(error_mutex);
+                    if (!error)
+                        error = std::current_exception();
+                }
+                for (std::size_t i = 0; i < workers.size(); ++i)
+                    workers[i].join();
+                if (error)
+                    std::rethrow_exception(error);
+                return;
+            }
+#endif
+            for (std::size_t t = 0; t < num_threads; ++t)
+                f(t);
+        }
+
+        // Bounds of block t when [0, n) is split into num_blocks contiguous
+        // blocks whose sizes differ by at most one.
+        template < typename Size >
+        Size block_begin(Size n, std::size_t num_blocks, std::size_t t)
+        {
+            Size base = n / Size(num_blocks);
+            Size extra = n % Size(num_blocks);
+            Size tt = Size(t);
+            return tt * base + (std::min)(tt, extra);
+        }
+
+        // Splits [0, n) into num_threads contiguous blocks and calls
+        // f(t, begin, end) once per block.  The partition depends only on n
+        // and num_threads, which makes per-block results reproducible.
+        template < typename Size, typename Function >
+        void parallel_for_blocks(Size n, std::size_t num_threads, Function f)
+        {
+            num_threads = resolve_num_threads(num_threads);
+            if (Size(num_threads) > n)
+                num_threads = n == 0 ? 1 : std::size_t(n);
+            run_in_parallel(num_threads, [&](std::size_t t) {
+                f(t, block_begin(n, num_threads, t),
+                    block_begin(n, num_threads, t + 1));
+            });
+        }
+
+        // Hands out chunks of grain consecutive indices of [0, n) to the
+        // workers as they become idle and calls f(t, begin, end) for each
+        // chunk, where t is the index of the worker running it.
+        template < typename Size, typename Function >
+        void parallel_for_dynamic(
+            Size n, Size grain, std::size_t num_threads, Function f)
+        {
+            num_threads = resolve_num_threads(num_threads);
+            if (grain == 0)
+                grain = 1;
+            Size num_chunks = (n + grain - 1) / grain;
+            if (Size(num_threads) > num_chunks)
+                num_threads = num_chunks == 0 ? 1 : std::size_t(num_chunks);
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+            if (num_threads > 1)
+            {
+                std::atomic< Size > next(0);
+                run_in_parallel(num_threads, [&](std::size_t t) {
+                    for (;;)
+                    {
+                        Size chunk = next.fetch_add(1);
+                        if (chunk >= num_chunks)
+                            break;
+                        Size begin = chunk * grain;
+                        f(t, begin, (std::min)(n, begin + grain));
+                    }
+                });
+                return;
+            }
+#endif
+            for (Size begin = 0; begin < n; begin += grain)
+                f(std::size_t(0), begin, (std::min)(n, begin + grain));
+        }
+
+        // Guards a cached result that is computed at most once, possibly on
+        // demand from several threads at the same time.  Copies take over
+        // the state of the source but not its mutex.
+        class lazy_init_flag
+        {
+        public:
+            explicit lazy_init_flag(bool done = true) : m_done(done) {}
+            lazy_init_flag(const lazy_init_flag& x) : m_done(x.done()) {}
+            lazy_init_flag& operator=(const lazy_init_flag& x)
+            {
+                reset(x.done());
+                return *this;
+            }
+
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+            bool done() const
+            {
+                return m_done.load(std::memory_order_acquire);
+            }
+            void reset(bool done)
+            {
+                m_done.store(done, std::memory_order_release);
+            }
+
+            // Runs f() unless it already completed; concurrent callers wait
+            // for the one running it.  If f throws, the flag stays unset.
+            template < typename Function > void call_once(Function f)
+            {
+                if (done())
+                    return;
+                std::lock_guard< std::mutex > lock(m_mutex);
+                if (m_done.load(std::memory_order_relaxed))
+                    return;
+                f();
+                reset(true);
+            }
+
+        private:
+            std::atomic< bool > m_done;
+            std::mutex m_mutex;
+#else
+            bool done() const { return m_done; }
+            void reset(bool done) { m_done = done; }
+            template < typename Function > void call_once(Function f)
+            {
+                if (!m_done)
+                {
+                    f();
+                    m_done = true;
+                }
+            }
+
+        private:
+            bool m_done;
+#endif
+        };
+
+        // Reusable barrier for the workers of one run_with_barrier call
+        class thread_barrier
+        {
+        public:
+            // Thrown by wait() once another worker has failed
+            struct aborted
+            {
+            };
+
+            explicit thread_barrier(std::size_t num_threads)
+            : m_num_threads(num_threads)
+            , m_waiting(0)
+            , m_generation(0)
+            , m_aborted(false)
+            {
+            }
+
+            std::size_t num_threads() const { return m_num_threads; }
+
+            void wait()
+            {
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+                std::unique_lock< std::mutex > lock(m_mutex);
+                std::size_t generation = m_generation;
+                if (!m_aborted && ++m_waiting == m_num_threads)
+                {
+                    m_waiting = 0;
+                    ++m_generation;
+                    m_released.notify_all();
+                }
+                else
+                    m_released.wait(lock, [&]() {
+                        return m_aborted || m_generation != generation;
+                    });
+                if (m_aborted)
+                    throw aborted();
+#endif
+            }
+
+            // Releases all current and future waiters with aborted
+            void abort()
+            {
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+                std::lock_guard< std::mutex > lock(m_mutex);
+                m_aborted = true;
+                m_released.notify_all();
+#endif
+            }
+
+        private:
+            std::size_t m_num_threads;
+            std::size_t m_waiting;
+            std::size_t m_generation;
+            bool m_aborted;
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+            std::mutex m_mutex;
+            std::condition_variable m_released;
+#endif
+        };
+
+        // Calls f(t, barrier) on num_threads workers that synchronize
+        // through a shared thread_barrier.  If a worker throws, the others
+        // are released from the barrier and the exception is rethrown.
+        // Without thread support a single worker runs.
+        template < typename Function >
+        void run_with_barrier(std::size_t num_threads, Function f)
+        {
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+            num_threads = resolve_num_threads(num_threads);
+#else
+            num_threads = 1;
+#endif
+            thread_barrier barrier(num_threads);
+            run_in_parallel(num_threads, [&](std::size_t t) {
+                try
+                {
+                    f(t, barrier);
+                }
+                catch (thread_barrier::aborted&)
+                {
+                }
+                catch (...)
+                {
+                    barrier.abort();
+                    throw;
+                }
+            });
+        }
+
+    } // namespace detail
+} // namespace graph
+} // namespace boost
+
+#endif // BOOST_GRAPH_DETAIL_PARALLEL_FOR_HPP
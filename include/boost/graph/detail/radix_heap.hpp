@@ -0,0 +1,201 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#ifndef BOOST_GRAPH_DETAIL_RADIX_HEAP_HPP
+#define BOOST_GRAPH_DETAIL_RADIX_HEAP_HPP
+
+#include <boost/assert.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace boost
+{
+
+namespace detail
+{
+    // Index of the highest set bit of x, which must not be 0
+    inline std::size_t radix_heap_msb(boost::uintmax_t x)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return std::size_t(sizeof(unsigned long long) * 8 - 1
+            - __builtin_clzll((unsigned long long)x));
+#else
+        std::size_t i = 0;
+        while (x >>= 1)
+            ++i;
+        return i;
+#endif
+    }
+}
+
+// Monotone radix heap (Ahuja, Mehlhorn, Orlin and Tarjan, "Faster
+// algorithms for the shortest path problem", JACM 37, 1990) using an
+// indirect key, for non-negative integral keys.  Every pushed or updated
+// key must be at least the key of the last value removed, which holds for
+// the distances of Dijkstra's algorithm with non-negative weights.  Bucket
+// 0 holds the values whose key equals the last removed key and bucket
+// i > 0 those whose key first differs from it in bit i - 1, so a value
+// moves down at most once per bit of the key; pop is amortized
+// O(log C) for keys spanning C, and push and update are O(1).
+//
+// - radix_heap_indirect is a model of UpdatableQueue as is needed for
+//   dijkstra_shortest_paths.
+//
+// - IndexInHeapMap must be a ReadWritePropertyMap from Value to
+//   std::size_t; it holds the bucket and the position in the bucket of
+//   each stored value.
+// - DistanceMap must be a ReadablePropertyMap from Value to a
+//   non-negative integral type.
+//
+template < typename Value, typename IndexInHeapPropertyMap,
+    typename DistanceMap >
+class radix_heap_indirect
+{
+public:
+    typedef std::size_t size_type;
+    typedef Value value_type;
+    typedef typename boost::property_traits< DistanceMap >::value_type key_type;
+    typedef DistanceMap key_map;
+    BOOST_STATIC_ASSERT(is_integral< key_type >::value);
+
+    radix_heap_indirect(
+        DistanceMap distance, IndexInHeapPropertyMap index_in_heap)
+    : m_buckets(num_buckets)
+    , m_size(0)
+    , m_last(0)
+    , m_distance(distance)
+    , m_index_in_heap(index_in_heap)
+    {
+    }
+
+    size_type size() const { return m_size; }
+
+    bool empty() const { return m_size == 0; }
+
+    void push(const Value& v)
+    {
+        insert(v, bucket_of(key(v)));
+        ++m_size;
+    }
+
+    Value& top()
+    {
+        BOOST_ASSERT(!this->empty());
+        refill();
+        return m_buckets[0].back();
+    }
+
+    void pop()
+    {
+        BOOST_ASSERT(!this->empty());
+        refill();
+        put(m_index_in_heap, m_buckets[0].back(), (size_type)(-1));
+        m_buckets[0].pop_back();
+        --m_size;
+    }
+
+    // Moves v after its key has been decreased
+    void update(const Value& v)
+    {
+        size_type index = get(m_index_in_heap, v);
+        std::size_t b = bucket_of(key(v));
+        if (b != index % num_buckets)
+        {
+            erase(index);
+            insert(v, b);
+        }
+    }
+
+    bool contains(const Value& v) const
+    {
+        return get(m_index_in_heap, v) != (size_type)(-1);
+    }
+
+    void push_or_update(const Value& v)
+    {
+        if (contains(v))
+            update(v);
+        else
+            push(v);
+    }
+
+    DistanceMap keys() const { return m_distance; }
+
+private:
+    static const std::size_t num_buckets = sizeof(boost::uintmax_t) * 8 + 1;
+
+    boost::uintmax_t key(const Value& v) const
+    {
+        BOOST_ASSERT(!(get(m_distance, v) < key_type(0)));
+        boost::uintmax_t k = boost::uintmax_t(get(m_distance, v));
+        BOOST_ASSERT(k >= m_last);
+        return k;
+    }
+
+    std::size_t bucket_of(boost::uintmax_t k) const
+    {
+        return k == m_last ? 0 : detail::radix_heap_msb(k ^ m_last) + 1;
+    }
+
+    // Index map entries combine the bucket and the position within it
+    void insert(const Value& v, std::size_t b)
+    {
+        put(m_index_in_heap, v, m_buckets[b].size() * num_buckets + b);
+        m_buckets[b].push_back(v);
+    }
+
+    void erase(size_type index)
+    {
+        std::vector< Value >& bucket = m_buckets[index % num_buckets];
+        size_type pos = index / num_buckets;
+        if (pos + 1 != bucket.size())
+        {
+            bucket[pos] = bucket.back();
+            put(m_index_in_heap, bucket[pos], index);
+        }
+        bucket.pop_back();
+    }
+
+    // Makes bucket 0 non-empty: the smallest key of the first non-empty
+    // bucket becomes the last removed key, and that bucket's values are
+    // spread over the buckets below it
+    void refill()
+    {
+        if (!m_buckets[0].empty())
+            return;
+        std::size_t b = 1;
+        while (m_buckets[b].empty())
+            ++b;
+        std::vector< Value >& bucket = m_buckets[b];
+        boost::uintmax_t smallest = key(bucket[0]);
+        for (std::size_t i = 1; i < bucket.size(); ++i)
+        {
+            boost::uintmax_t k = key(bucket[i]);
+            if (k < smallest)
+                smallest = k;
+        }
+        m_last = smallest;
+        for (std::size_t i = 0; i < bucket.size(); ++i)
+            insert(bucket[i], bucket_of(key(bucket[i])));
+        bucket.clear();
+    }
+
+    std::vector< std::vector< Value > > m_buckets;
+    size_type m_size;
+    boost::uintmax_t m_last;
+    DistanceMap m_distance;
+    IndexInHeapPropertyMap m_index_in_heap;
+};
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_DETAIL_RADIX_HEAP_HPP
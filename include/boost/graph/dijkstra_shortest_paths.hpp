@@ -15,6 +15,7 @@
 #ifndef BOOST_GRAPH_DIJKSTRA_HPP
 #define BOOST_GRAPH_DIJKSTRA_HPP
 
+#include <algorithm>
 #include <functional>
 #include <boost/limits.hpp>
 #include <boost/graph/named_function_params.hpp>
@@ -24,7 +25,9 @@
 #include <boost/graph/exception.hpp>
 #include <boost/graph/overloading.hpp>
 #include <memory>
+#include <boost/graph/detail/bucket_queue.hpp>
 #include <boost/graph/detail/d_ary_heap.hpp>
+#include <boost/graph/detail/radix_heap.hpp>
 #include <boost/graph/two_bit_color_map.hpp>
 #include <boost/graph/detail/mpi_include.hpp>
 #include <boost/property_map/property_map.hpp>
@@ -39,6 +42,21 @@
 namespace boost
 {
 
+// Selectors for the priority_queue_kind parameter of
+// dijkstra_shortest_paths.  d_ary_heapS works with any distance type and
+// comparison; radix_heapS and bucket_queueS require non-negative integral
+// distances ordered by std::less.  bucket_queueS keeps one bucket per
+// possible distance within the largest edge weight of the current one.
+template < std::size_t Arity = 4 > struct d_ary_heapS
+{
+};
+struct radix_heapS
+{
+};
+struct bucket_queueS
+{
+};
+
 /**
  * @brief Updates a particular value in a queue used by Dijkstra's
  * algorithm.
@@ -353,6 +371,166 @@ inline void dijkstra_shortest_paths_no_init(const Graph& g,
         weight, index_map, compare, combine, zero, vis);
 }
 
+namespace detail
+{
+    // The queue type and constructor for each priority_queue_kind
+    template < class QueueKind > struct dijkstra_queue_gen;
+
+    template < std::size_t Arity >
+    struct dijkstra_queue_gen< d_ary_heapS< Arity > >
+    {
+        template < class Graph, class IndexInHeapMap, class DistanceMap,
+            class WeightMap, class Compare >
+        struct bind_
+        {
+            typedef typename graph_traits< Graph >::vertex_descriptor Vertex;
+            typedef d_ary_heap_indirect< Vertex, Arity, IndexInHeapMap,
+                DistanceMap, Compare >
+                type;
+
+            static type build(const Graph&, IndexInHeapMap index_in_heap,
+                DistanceMap distance, WeightMap, const Compare& compare)
+            {
+                return type(distance, index_in_heap, compare);
+            }
+        };
+    };
+
+    template <> struct dijkstra_queue_gen< radix_heapS >
+    {
+        template < class Graph, class IndexInHeapMap, class DistanceMap,
+            class WeightMap, class Compare >
+        struct bind_
+        {
+            typedef typename graph_traits< Graph >::vertex_descriptor Vertex;
+            typedef radix_heap_indirect< Vertex, IndexInHeapMap, DistanceMap >
+                type;
+
+            static type build(const Graph&, IndexInHeapMap index_in_heap,
+                DistanceMap distance, WeightMap, const Compare&)
+            {
+                return type(distance, index_in_heap);
+            }
+        };
+    };
+
+    template <> struct dijkstra_queue_gen< bucket_queueS >
+    {
+        template < class Graph, class IndexInHeapMap, class DistanceMap,
+            class WeightMap, class Compare >
+        struct bind_
+        {
+            typedef typename graph_traits< Graph >::vertex_descriptor Vertex;
+            typedef bucket_queue_indirect< Vertex, IndexInHeapMap,
+                DistanceMap >
+                type;
+
+            // Queued distances span at most the largest edge weight.  The
+            // weights are checked here, before the search would, because a
+            // negative one cannot be converted to a span.
+            static type build(const Graph& g, IndexInHeapMap index_in_heap,
+                DistanceMap distance, WeightMap weight, const Compare&)
+            {
+                typedef typename property_traits< WeightMap >::value_type
+                    weight_type;
+                boost::uintmax_t span = 0;
+                typename graph_traits< Graph >::vertex_iterator ui, ui_end;
+                for (boost::tie(ui, ui_end) = vertices(g); ui != ui_end; ++ui)
+                {
+                    typename graph_traits< Graph >::out_edge_iterator ei,
+                        ei_end;
+                    for (boost::tie(ei, ei_end) = out_edges(*ui, g);
+                         ei != ei_end; ++ei)
+                    {
+                        weight_type w = get(weight, *ei);
+                        if (w < weight_type())
+                            boost::throw_exception(negative_edge());
+                        span = (std::max)(span, boost::uintmax_t(w));
+                    }
+                }
+                return type(distance, index_in_heap, span);
+            }
+        };
+    };
+
+    template < class Graph, class SourceInputIter, class DijkstraVisitor,
+        class PredecessorMap, class DistanceMap, class WeightMap,
+        class IndexMap, class Compare, class Combine, class DistZero,
+        class ColorMap, class QueueKind >
+    inline void dijkstra_no_init_dispatch(const Graph& g,
+        SourceInputIter s_begin, SourceInputIter s_end,
+        PredecessorMap predecessor, DistanceMap distance, WeightMap weight,
+        IndexMap index_map, Compare compare, Combine combine, DistZero zero,
+        DijkstraVisitor vis, ColorMap color, QueueKind)
+    {
+        std::unique_ptr< std::size_t[] > index_in_heap_map_holder;
+        typedef detail::vertex_property_map_generator< Graph, IndexMap,
+            std::size_t >
+            IndexInHeapMapHelper;
+        typedef typename IndexInHeapMapHelper::type IndexInHeapMap;
+        IndexInHeapMap index_in_heap = IndexInHeapMapHelper::build(
+            g, index_map, index_in_heap_map_holder);
+        typedef typename dijkstra_queue_gen< QueueKind >::template bind_<
+            Graph, IndexInHeapMap, DistanceMap, WeightMap, Compare >
+            QueueGen;
+        typedef typename QueueGen::type MutableQueue;
+        MutableQueue Q
+            = QueueGen::build(g, index_in_heap, distance, weight, compare);
+
+        detail::dijkstra_bfs_visitor< DijkstraVisitor, MutableQueue, WeightMap,
+            PredecessorMap, DistanceMap, Combine, Compare >
+            bfs_vis(
+                vis, Q, weight, predecessor, distance, combine, compare, zero);
+
+        breadth_first_visit(g, s_begin, s_end, Q, bfs_vis, color);
+    }
+
+    template < class VertexListGraph, class SourceInputIter,
+        class DijkstraVisitor, class PredecessorMap, class DistanceMap,
+        class WeightMap, class IndexMap, class Compare, class Combine,
+        class DistInf, class DistZero, class ColorMap, class QueueKind >
+    inline void dijkstra_dispatch3(const VertexListGraph& g,
+        SourceInputIter s_begin, SourceInputIter s_end,
+        PredecessorMap predecessor, DistanceMap distance, WeightMap weight,
+        IndexMap index_map, Compare compare, Combine combine, DistInf inf,
+        DistZero zero, DijkstraVisitor vis, ColorMap color, QueueKind kind)
+    {
+        typedef typename property_traits< ColorMap >::value_type ColorValue;
+        typedef color_traits< ColorValue > Color;
+        typename graph_traits< VertexListGraph >::vertex_iterator ui, ui_end;
+        for (boost::tie(ui, ui_end) = vertices(g); ui != ui_end; ++ui)
+        {
+            vis.initialize_vertex(*ui, g);
+            put(distance, *ui, inf);
+            put(predecessor, *ui, *ui);
+            put(color, *ui, Color::white());
+        }
+        for (SourceInputIter it = s_begin; it != s_end; ++it)
+        {
+            put(distance, *it, zero);
+        }
+
+        dijkstra_no_init_dispatch(g, s_begin, s_end, predecessor, distance,
+            weight, index_map, compare, combine, zero, vis, color, kind);
+    }
+} // namespace detail
+
+// Call breadth first search, with the priority queue chosen by kind
+// (d_ary_heapS<Arity>, radix_heapS or bucket_queueS)
+template < class Graph, class SourceInputIter, class DijkstraVisitor,
+    class PredecessorMap, class DistanceMap, class WeightMap, class IndexMap,
+    class Compare, class Combine, class DistZero, class ColorMap,
+    class QueueKind >
+inline void dijkstra_shortest_paths_no_init(const Graph& g,
+    SourceInputIter s_begin, SourceInputIter s_end, PredecessorMap predecessor,
+    DistanceMap distance, WeightMap weight, IndexMap index_map, Compare compare,
+    Combine combine, DistZero zero, DijkstraVisitor vis, ColorMap color,
+    QueueKind kind)
+{
+    detail::dijkstra_no_init_dispatch(g, s_begin, s_end, predecessor,
+        distance, weight, index_map, compare, combine, zero, vis, color, kind);
+}
+
 // Call breadth first search
 template < class Graph, class SourceInputIter, class DijkstraVisitor,
     class PredecessorMap, class DistanceMap, class WeightMap, class IndexMap,
@@ -362,29 +540,23 @@ inline void dijkstra_shortest_paths_no_init(const Graph& g,
     DistanceMap distance, WeightMap weight, IndexMap index_map, Compare compare,
     Combine combine, DistZero zero, DijkstraVisitor vis, ColorMap color)
 {
-    typedef indirect_cmp< DistanceMap, Compare > IndirectCmp;
-    IndirectCmp icmp(distance, compare);
-
-    typedef typename graph_traits< Graph >::vertex_descriptor Vertex;
-
-    // Now the default: use a d-ary heap
-    std::unique_ptr< std::size_t[] > index_in_heap_map_holder;
-    typedef detail::vertex_property_map_generator< Graph, IndexMap,
-        std::size_t >
-        IndexInHeapMapHelper;
-    typedef typename IndexInHeapMapHelper::type IndexInHeapMap;
-    IndexInHeapMap index_in_heap
-        = IndexInHeapMapHelper::build(g, index_map, index_in_heap_map_holder);
-    typedef d_ary_heap_indirect< Vertex, 4, IndexInHeapMap, DistanceMap,
-        Compare >
-        MutableQueue;
-    MutableQueue Q(distance, index_in_heap, compare);
-
-    detail::dijkstra_bfs_visitor< DijkstraVisitor, MutableQueue, WeightMap,
-        PredecessorMap, DistanceMap, Combine, Compare >
-        bfs_vis(vis, Q, weight, predecessor, distance, combine, compare, zero);
-
-    breadth_first_visit(g, s_begin, s_end, Q, bfs_vis, color);
+    detail::dijkstra_no_init_dispatch(g, s_begin, s_end, predecessor,
+        distance, weight, index_map, compare, combine, zero, vis, color,
+        d_ary_heapS<>());
+}
+
+// Call breadth first search, with the priority queue chosen by kind
+template < class Graph, class DijkstraVisitor, class PredecessorMap,
+    class DistanceMap, class WeightMap, class IndexMap, class Compare,
+    class Combine, class DistZero, class ColorMap, class QueueKind >
+inline void dijkstra_shortest_paths_no_init(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s,
+    PredecessorMap predecessor, DistanceMap distance, WeightMap weight,
+    IndexMap index_map, Compare compare, Combine combine, DistZero zero,
+    DijkstraVisitor vis, ColorMap color, QueueKind kind)
+{
+    dijkstra_shortest_paths_no_init(g, &s, &s + 1, predecessor, distance,
+        weight, index_map, compare, combine, zero, vis, color, kind);
 }
 
 // Call breadth first search
@@ -410,12 +582,15 @@ inline void dijkstra_shortest_paths(const VertexListGraph& g,
     SourceInputIter s_begin, SourceInputIter s_end, PredecessorMap predecessor,
     DistanceMap distance, WeightMap weight, IndexMap index_map, Compare compare,
     Combine combine, DistInf inf, DistZero zero, DijkstraVisitor vis,
-    const bgl_named_params< T, Tag, Base >& BOOST_GRAPH_ENABLE_IF_MODELS_PARM(
-        VertexListGraph, vertex_list_graph_tag))
+    const bgl_named_params< T, Tag, Base >& params
+        BOOST_GRAPH_ENABLE_IF_MODELS_PARM(
+            VertexListGraph, vertex_list_graph_tag))
 {
     boost::two_bit_color_map< IndexMap > color(num_vertices(g), index_map);
-    dijkstra_shortest_paths(g, s_begin, s_end, predecessor, distance, weight,
-        index_map, compare, combine, inf, zero, vis, color);
+    detail::dijkstra_dispatch3(g, s_begin, s_end, predecessor, distance,
+        weight, index_map, compare, combine, inf, zero, vis, color,
+        choose_param(get_param(params, priority_queue_kind_t()),
+            d_ary_heapS<>()));
 }
 
 // Initialize distances and call breadth first search with default color map
@@ -428,11 +603,28 @@ inline void dijkstra_shortest_paths(const VertexListGraph& g,
     PredecessorMap predecessor, DistanceMap distance, WeightMap weight,
     IndexMap index_map, Compare compare, Combine combine, DistInf inf,
     DistZero zero, DijkstraVisitor vis,
-    const bgl_named_params< T, Tag, Base >& BOOST_GRAPH_ENABLE_IF_MODELS_PARM(
-        VertexListGraph, vertex_list_graph_tag))
+    const bgl_named_params< T, Tag, Base >& params
+        BOOST_GRAPH_ENABLE_IF_MODELS_PARM(
+            VertexListGraph, vertex_list_graph_tag))
 {
     dijkstra_shortest_paths(g, &s, &s + 1, predecessor, distance, weight,
-        index_map, compare, combine, inf, zero, vis);
+        index_map, compare, combine, inf, zero, vis, params);
+}
+
+// Initialize distances and call breadth first search, with the priority
+// queue chosen by kind
+template < class VertexListGraph, class SourceInputIter, class DijkstraVisitor,
+    class PredecessorMap, class DistanceMap, class WeightMap, class IndexMap,
+    class Compare, class Combine, class DistInf, class DistZero,
+    class ColorMap, class QueueKind >
+inline void dijkstra_shortest_paths(const VertexListGraph& g,
+    SourceInputIter s_begin, SourceInputIter s_end, PredecessorMap predecessor,
+    DistanceMap distance, WeightMap weight, IndexMap index_map, Compare compare,
+    Combine combine, DistInf inf, DistZero zero, DijkstraVisitor vis,
+    ColorMap color, QueueKind kind)
+{
+    detail::dijkstra_dispatch3(g, s_begin, s_end, predecessor, distance,
+        weight, index_map, compare, combine, inf, zero, vis, color, kind);
 }
 
 // Initialize distances and call breadth first search
@@ -446,23 +638,25 @@ inline void dijkstra_shortest_paths(const VertexListGraph& g,
     Combine combine, DistInf inf, DistZero zero, DijkstraVisitor vis,
     ColorMap color)
 {
-    typedef typename property_traits< ColorMap >::value_type ColorValue;
-    typedef color_traits< ColorValue > Color;
-    typename graph_traits< VertexListGraph >::vertex_iterator ui, ui_end;
-    for (boost::tie(ui, ui_end) = vertices(g); ui != ui_end; ++ui)
-    {
-        vis.initialize_vertex(*ui, g);
-        put(distance, *ui, inf);
-        put(predecessor, *ui, *ui);
-        put(color, *ui, Color::white());
-    }
-    for (SourceInputIter it = s_begin; it != s_end; ++it)
-    {
-        put(distance, *it, zero);
-    }
+    detail::dijkstra_dispatch3(g, s_begin, s_end, predecessor, distance,
+        weight, index_map, compare, combine, inf, zero, vis, color,
+        d_ary_heapS<>());
+}
 
-    dijkstra_shortest_paths_no_init(g, s_begin, s_end, predecessor, distance,
-        weight, index_map, compare, combine, zero, vis, color);
+// Initialize distances and call breadth first search, with the priority
+// queue chosen by kind
+template < class VertexListGraph, class DijkstraVisitor, class PredecessorMap,
+    class DistanceMap, class WeightMap, class IndexMap, class Compare,
+    class Combine, class DistInf, class DistZero, class ColorMap,
+    class QueueKind >
+inline void dijkstra_shortest_paths(const VertexListGraph& g,
+    typename graph_traits< VertexListGraph >::vertex_descriptor s,
+    PredecessorMap predecessor, DistanceMap distance, WeightMap weight,
+    IndexMap index_map, Compare compare, Combine combine, DistInf inf,
+    DistZero zero, DijkstraVisitor vis, ColorMap color, QueueKind kind)
+{
+    dijkstra_shortest_paths(g, &s, &s + 1, predecessor, distance, weight,
+        index_map, compare, combine, inf, zero, vis, color, kind);
 }
 
 // Initialize distances and call breadth first search
@@ -0,0 +1,584 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#ifndef BOOST_GRAPH_DIJKSTRA_WORKSPACE_HPP
+#define BOOST_GRAPH_DIJKSTRA_WORKSPACE_HPP
+
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/graph/detail/d_ary_heap.hpp>
+#include <boost/graph/detail/parallel_for.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/named_function_params.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/limits.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace boost
+{
+
+// Scratch state for repeated runs of Dijkstra's algorithm on one graph:
+// distances, predecessors, colors and the priority queue, allocated once.
+// Each search starts a new epoch; an entry stamped with an older epoch reads
+// as unreached, so starting a search costs O(1) instead of O(V), and a
+// search that reaches few vertices touches only those.
+//
+// A workspace is not thread-safe; use one per thread.
+template < typename Graph, typename Distance,
+    typename VertexIndexMap =
+        typename property_map< Graph, vertex_index_t >::const_type >
+class dijkstra_workspace
+{
+public:
+    typedef typename graph_traits< Graph >::vertex_descriptor
+        vertex_descriptor;
+    typedef Distance distance_type;
+
+    class distance_map_type
+    {
+    public:
+        typedef vertex_descriptor key_type;
+        typedef Distance value_type;
+        typedef Distance reference;
+        typedef read_write_property_map_tag category;
+
+        explicit distance_map_type(dijkstra_workspace* ws) : m_ws(ws) {}
+
+        friend Distance get(const distance_map_type& m, vertex_descriptor v)
+        {
+            return m.m_ws->distance(v);
+        }
+        friend void put(
+            const distance_map_type& m, vertex_descriptor v, Distance d)
+        {
+            m.store(v, d);
+        }
+
+    private:
+        void store(vertex_descriptor v, Distance d) const
+        {
+            m_ws->m_distance[m_ws->touch(v)] = d;
+        }
+
+        dijkstra_workspace* m_ws;
+    };
+
+    class predecessor_map_type
+    {
+    public:
+        typedef vertex_descriptor key_type;
+        typedef vertex_descriptor value_type;
+        typedef vertex_descriptor reference;
+        typedef read_write_property_map_tag category;
+
+        explicit predecessor_map_type(dijkstra_workspace* ws) : m_ws(ws) {}
+
+        friend vertex_descriptor get(
+            const predecessor_map_type& m, vertex_descriptor v)
+        {
+            return m.m_ws->predecessor(v);
+        }
+        friend void put(const predecessor_map_type& m, vertex_descriptor v,
+            vertex_descriptor u)
+        {
+            m.store(v, u);
+        }
+
+    private:
+        void store(vertex_descriptor v, vertex_descriptor u) const
+        {
+            m_ws->m_predecessor[m_ws->touch(v)] = u;
+        }
+
+        dijkstra_workspace* m_ws;
+    };
+
+    class color_map_type
+    {
+    public:
+        typedef vertex_descriptor key_type;
+        typedef default_color_type value_type;
+        typedef default_color_type reference;
+        typedef read_write_property_map_tag category;
+
+        explicit color_map_type(dijkstra_workspace* ws) : m_ws(ws) {}
+
+        friend default_color_type get(
+            const color_map_type& m, vertex_descriptor v)
+        {
+            return m.load(v);
+        }
+        friend void put(const color_map_type& m, vertex_descriptor v,
+            default_color_type c)
+        {
+            m.store(v, c);
+        }
+
+    private:
+        default_color_type load(vertex_descriptor v) const
+        {
+            std::size_t i = get(m_ws->m_index, v);
+            return m_ws->current(i) ? m_ws->m_color[i] : white_color;
+        }
+        void store(vertex_descriptor v, default_color_type c) const
+        {
+            m_ws->m_color[m_ws->touch(v)] = c;
+        }
+
+        dijkstra_workspace* m_ws;
+    };
+
+    explicit dijkstra_workspace(const Graph& g)
+    : m_index(get(vertex_index, g))
+    , m_distance(num_vertices(g))
+    , m_predecessor(num_vertices(g))
+    , m_color(num_vertices(g))
+    , m_stamp(num_vertices(g), 0)
+    , m_index_in_heap(num_vertices(g))
+    , m_epoch(1)
+    , m_stopped(false)
+    , m_heap(make_iterator_property_map(m_distance.begin(), m_index),
+          make_iterator_property_map(m_index_in_heap.begin(), m_index))
+    {
+    }
+
+    dijkstra_workspace(const Graph& g, VertexIndexMap index)
+    : m_index(index)
+    , m_distance(num_vertices(g))
+    , m_predecessor(num_vertices(g))
+    , m_color(num_vertices(g))
+    , m_stamp(num_vertices(g), 0)
+    , m_index_in_heap(num_vertices(g))
+    , m_epoch(1)
+    , m_stopped(false)
+    , m_heap(make_iterator_property_map(m_distance.begin(), m_index),
+          make_iterator_property_map(m_index_in_heap.begin(), m_index))
+    {
+    }
+
+    // The scratch maps refer to the workspace itself
+    dijkstra_workspace(const dijkstra_workspace&) = delete;
+    dijkstra_workspace& operator=(const dijkstra_workspace&) = delete;
+
+    // Results of the last search; unreached vertices have an infinite
+    // distance and are their own predecessors
+    Distance distance(vertex_descriptor v) const
+    {
+        std::size_t i = get(m_index, v);
+        return current(i) ? m_distance[i]
+                          : (std::numeric_limits< Distance >::max)();
+    }
+
+    vertex_descriptor predecessor(vertex_descriptor v) const
+    {
+        std::size_t i = get(m_index, v);
+        return current(i) ? m_predecessor[i] : v;
+    }
+
+    bool reached(vertex_descriptor v) const
+    {
+        return current(get(m_index, v));
+    }
+
+    // The vertices discovered by the last search, in discovery order
+    const std::vector< vertex_descriptor >& reached_vertices() const
+    {
+        return m_reached;
+    }
+
+    distance_map_type distance_map() { return distance_map_type(this); }
+
+    predecessor_map_type predecessor_map()
+    {
+        return predecessor_map_type(this);
+    }
+
+    // Ends the running search once the vertex being examined is finished,
+    // e.g. from a visitor when the vertices of interest are settled
+    void stop() { m_stopped = true; }
+
+    // Runs Dijkstra's algorithm from the given sources; the results stay
+    // readable until the next search
+    template < typename SourceInputIter, typename WeightMap,
+        typename DijkstraVisitor >
+    void search(const Graph& g, SourceInputIter s_begin,
+        SourceInputIter s_end, WeightMap weight, DijkstraVisitor vis)
+    {
+        start();
+        distance_map_type distance(this);
+        for (SourceInputIter it = s_begin; it != s_end; ++it)
+            put(distance, *it, Distance());
+
+        search_queue Q(*this);
+        detail::dijkstra_bfs_visitor< DijkstraVisitor, search_queue, WeightMap,
+            predecessor_map_type, distance_map_type, std::plus< Distance >,
+            std::less< Distance > >
+            bfs_vis(vis, Q, weight, predecessor_map_type(this), distance,
+                std::plus< Distance >(), std::less< Distance >(), Distance());
+        breadth_first_visit(
+            g, s_begin, s_end, Q, bfs_vis, color_map_type(this));
+    }
+
+private:
+    typedef iterator_property_map< std::vector< std::size_t >::iterator,
+        VertexIndexMap >
+        index_in_heap_map;
+    // Queued vertices always belong to the current epoch, so the heap
+    // reads their distances directly
+    typedef iterator_property_map< typename std::vector< Distance >::iterator,
+        VertexIndexMap >
+        heap_distance_map;
+    typedef d_ary_heap_indirect< vertex_descriptor, 4, index_in_heap_map,
+        heap_distance_map, std::less< Distance > >
+        heap_type;
+
+    // The heap as seen by breadth_first_visit, which looks empty once the
+    // search is stopped
+    class search_queue
+    {
+    public:
+        typedef vertex_descriptor value_type;
+
+        explicit search_queue(dijkstra_workspace& ws) : m_ws(ws) {}
+
+        bool empty() const { return m_ws.m_stopped || m_ws.m_heap.empty(); }
+        vertex_descriptor& top() { return m_ws.m_heap.top(); }
+        void pop() { m_ws.m_heap.pop(); }
+        void push(const vertex_descriptor& v) { m_ws.m_heap.push(v); }
+        void update(const vertex_descriptor& v) { m_ws.m_heap.update(v); }
+
+    private:
+        dijkstra_workspace& m_ws;
+    };
+
+    bool current(std::size_t i) const { return m_stamp[i] == m_epoch; }
+
+    // Brings the entries of v into the current epoch, returning its index
+    std::size_t touch(vertex_descriptor v)
+    {
+        std::size_t i = get(m_index, v);
+        if (!current(i))
+        {
+            m_stamp[i] = m_epoch;
+            m_distance[i] = (std::numeric_limits< Distance >::max)();
+            m_predecessor[i] = v;
+            m_color[i] = white_color;
+            m_reached.push_back(v);
+        }
+        return i;
+    }
+
+    void start()
+    {
+        if (++m_epoch == 0)
+        {
+            std::fill(m_stamp.begin(), m_stamp.end(), boost::uint32_t(0));
+            m_epoch = 1;
+        }
+        m_reached.clear();
+        // A stopped search leaves vertices in the heap
+        m_heap.clear();
+        m_stopped = false;
+    }
+
+    VertexIndexMap m_index;
+    std::vector< Distance > m_distance;
+    std::vector< vertex_descriptor > m_predecessor;
+    std::vector< default_color_type > m_color;
+    std::vector< boost::uint32_t > m_stamp;
+    std::vector< std::size_t > m_index_in_heap;
+    std::vector< vertex_descriptor > m_reached;
+    boost::uint32_t m_epoch;
+    bool m_stopped;
+    heap_type m_heap;
+};
+
+// Single-source search reusing a workspace
+template < typename Graph, typename Distance, typename VertexIndexMap,
+    typename Param, typename Tag, typename Rest >
+inline void dijkstra_shortest_paths(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s,
+    dijkstra_workspace< Graph, Distance, VertexIndexMap >& ws,
+    const bgl_named_params< Param, Tag, Rest >& params)
+{
+    ws.search(g, &s, &s + 1,
+        choose_const_pmap(get_param(params, edge_weight), g, edge_weight),
+        choose_param(get_param(params, graph_visitor),
+            make_dijkstra_visitor(null_visitor())));
+}
+
+// Multiple-source search reusing a workspace
+template < typename Graph, typename SourceInputIter, typename Distance,
+    typename VertexIndexMap, typename Param, typename Tag, typename Rest >
+inline void dijkstra_shortest_paths(const Graph& g, SourceInputIter s_begin,
+    SourceInputIter s_end,
+    dijkstra_workspace< Graph, Distance, VertexIndexMap >& ws,
+    const bgl_named_params< Param, Tag, Rest >& params)
+{
+    ws.search(g, s_begin, s_end,
+        choose_const_pmap(get_param(params, edge_weight), g, edge_weight),
+        choose_param(get_param(params, graph_visitor),
+            make_dijkstra_visitor(null_visitor())));
+}
+
+namespace detail
+{
+    // Stops the search of a workspace once every target is settled
+    template < typename Workspace, typename IsTarget >
+    struct dijkstra_targets_visitor : public dijkstra_visitor<>
+    {
+        dijkstra_targets_visitor(
+            Workspace& ws, IsTarget is_target, std::size_t num_targets)
+        : m_ws(&ws), m_is_target(is_target), m_remaining(num_targets)
+        {
+        }
+
+        template < typename Vertex, typename Graph >
+        void examine_vertex(Vertex u, const Graph&)
+        {
+            if (m_is_target(u) && --m_remaining == 0)
+                m_ws->stop();
+        }
+
+        Workspace* m_ws;
+        IsTarget m_is_target;
+        std::size_t m_remaining;
+    };
+
+    template < typename VertexIndexMap > struct dijkstra_sorted_targets
+    {
+        template < typename Vertex > bool operator()(Vertex v) const
+        {
+            return std::binary_search(
+                m_indices->begin(), m_indices->end(), get(m_index, v));
+        }
+
+        const std::vector< std::size_t >* m_indices;
+        VertexIndexMap m_index;
+    };
+
+    template < typename VertexIndexMap > struct dijkstra_marked_targets
+    {
+        template < typename Vertex > bool operator()(Vertex v) const
+        {
+            return (*m_marks)[get(m_index, v)] != 0;
+        }
+
+        const std::vector< char >* m_marks;
+        VertexIndexMap m_index;
+    };
+
+    struct dijkstra_null_visitor_maker
+    {
+        template < typename Workspace >
+        dijkstra_visitor<> operator()(Workspace&) const
+        {
+            return dijkstra_visitor<>();
+        }
+    };
+
+    template < typename VertexIndexMap > struct dijkstra_targets_visitor_maker
+    {
+        template < typename Workspace >
+        dijkstra_targets_visitor< Workspace,
+            dijkstra_marked_targets< VertexIndexMap > >
+        operator()(Workspace& ws) const
+        {
+            return dijkstra_targets_visitor< Workspace,
+                dijkstra_marked_targets< VertexIndexMap > >(
+                ws, m_is_target, m_num_targets);
+        }
+
+        dijkstra_marked_targets< VertexIndexMap > m_is_target;
+        std::size_t m_num_targets;
+    };
+
+    template < typename DistanceMatrix, typename Vertex >
+    struct dijkstra_matrix_row_writer
+    {
+        template < typename Workspace >
+        void operator()(std::size_t i, const Workspace& ws) const
+        {
+            for (std::size_t j = 0; j < m_targets->size(); ++j)
+                (*m_matrix)[i][j] = ws.distance((*m_targets)[j]);
+        }
+
+        DistanceMatrix* m_matrix;
+        const std::vector< Vertex >* m_targets;
+    };
+
+    // Runs the searches from [first, last) on num_threads threads, each
+    // with its own workspace, and hands every finished search to
+    // f(t, i, workspace) on the thread t that ran it
+    template < typename Graph, typename RandomAccessIter, typename WeightMap,
+        typename VertexIndexMap, typename MakeVisitor, typename Function >
+    void dijkstra_batch_on_threads(const Graph& g, RandomAccessIter first,
+        RandomAccessIter last, WeightMap weight, VertexIndexMap index,
+        std::size_t num_threads, MakeVisitor make_visitor, Function f)
+    {
+        typedef typename property_traits< WeightMap >::value_type Distance;
+        typedef dijkstra_workspace< Graph, Distance, VertexIndexMap >
+            workspace_type;
+        const std::size_t n = std::size_t(last - first);
+        num_threads = (std::min)(
+            boost::graph::detail::resolve_num_threads(num_threads), n);
+        if (num_threads == 0)
+            return;
+        // Workspaces are created by their own threads, on first use
+        std::vector< std::unique_ptr< workspace_type > > workspaces(
+            num_threads);
+        boost::graph::detail::parallel_for_dynamic(n, std::size_t(1),
+            num_threads,
+            [&](std::size_t t, std::size_t begin, std::size_t end) {
+                if (!workspaces[t])
+                    workspaces[t].reset(new workspace_type(g, index));
+                workspace_type& ws = *workspaces[t];
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    typename graph_traits< Graph >::vertex_descriptor s
+                        = first[i];
+                    ws.search(g, &s, &s + 1, weight, make_visitor(ws));
+                    f(t, i, static_cast< const workspace_type& >(ws));
+                }
+            });
+    }
+
+    template < typename Function > struct dijkstra_batch_any_thread
+    {
+        template < typename Workspace >
+        void operator()(std::size_t, std::size_t i, const Workspace& ws)
+        {
+            m_f(i, ws);
+        }
+
+        Function m_f;
+    };
+
+    // The same, calling f(i, workspace)
+    template < typename Graph, typename RandomAccessIter, typename WeightMap,
+        typename VertexIndexMap, typename MakeVisitor, typename Function >
+    void dijkstra_batch(const Graph& g, RandomAccessIter first,
+        RandomAccessIter last, WeightMap weight, VertexIndexMap index,
+        std::size_t num_threads, MakeVisitor make_visitor, Function f)
+    {
+        dijkstra_batch_any_thread< Function > any_thread = { f };
+        dijkstra_batch_on_threads(g, first, last, weight, index, num_threads,
+            make_visitor, any_thread);
+    }
+
+    template < typename Graph, typename RandomAccessIter,
+        typename TargetInputIter, typename DistanceMatrix, typename WeightMap,
+        typename VertexIndexMap >
+    void dijkstra_many_to_many_dispatch(const Graph& g,
+        RandomAccessIter s_first, RandomAccessIter s_last,
+        TargetInputIter t_first, TargetInputIter t_last, DistanceMatrix& D,
+        WeightMap weight, VertexIndexMap index, std::size_t num_threads)
+    {
+        typedef typename graph_traits< Graph >::vertex_descriptor Vertex;
+        std::vector< Vertex > targets(t_first, t_last);
+        std::vector< char > marks(num_vertices(g), 0);
+        std::size_t num_targets = 0;
+        for (std::size_t j = 0; j < targets.size(); ++j)
+        {
+            char& mark = marks[get(index, targets[j])];
+            num_targets += mark == 0;
+            mark = 1;
+        }
+        if (num_targets == 0)
+            return;
+
+        dijkstra_targets_visitor_maker< VertexIndexMap > make_visitor
+            = { { &marks, index }, num_targets };
+        dijkstra_matrix_row_writer< DistanceMatrix, Vertex > write_row
+            = { &D, &targets };
+        dijkstra_batch(g, s_first, s_last, weight, index, num_threads,
+            make_visitor, write_row);
+    }
+} // namespace detail
+
+// One-to-many search reusing a workspace: writes the distance from s to
+// each of [t_first, t_last) to out, stopping once all of them are settled
+template < typename Graph, typename TargetInputIter, typename Distance,
+    typename VertexIndexMap, typename OutputIter, typename Param,
+    typename Tag, typename Rest >
+OutputIter dijkstra_one_to_many(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s,
+    TargetInputIter t_first, TargetInputIter t_last,
+    dijkstra_workspace< Graph, Distance, VertexIndexMap >& ws, OutputIter out,
+    const bgl_named_params< Param, Tag, Rest >& params)
+{
+    typedef dijkstra_workspace< Graph, Distance, VertexIndexMap >
+        workspace_type;
+    typedef typename graph_traits< Graph >::vertex_descriptor Vertex;
+    VertexIndexMap index = choose_const_pmap(
+        get_param(params, vertex_index), g, vertex_index);
+
+    std::vector< Vertex > targets(t_first, t_last);
+    std::vector< std::size_t > indices;
+    indices.reserve(targets.size());
+    for (std::size_t i = 0; i < targets.size(); ++i)
+        indices.push_back(get(index, targets[i]));
+    std::sort(indices.begin(), indices.end());
+    indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+    if (indices.empty())
+        return out;
+
+    detail::dijkstra_sorted_targets< VertexIndexMap > is_target
+        = { &indices, index };
+    ws.search(g, &s, &s + 1,
+        choose_const_pmap(get_param(params, edge_weight), g, edge_weight),
+        detail::dijkstra_targets_visitor< workspace_type,
+            detail::dijkstra_sorted_targets< VertexIndexMap > >(
+            ws, is_target, indices.size()));
+    for (std::size_t i = 0; i < targets.size(); ++i)
+        *out++ = ws.distance(targets[i]);
+    return out;
+}
+
+// Runs a search from each of [first, last) on several threads, each owning
+// a workspace, and calls f(i, ws) with the workspace holding the results
+// of the search from first[i].  f is called concurrently from the worker
+// threads for distinct i.
+template < typename Graph, typename RandomAccessIter, typename Function,
+    typename Param, typename Tag, typename Rest >
+void dijkstra_shortest_paths_batch(const Graph& g, RandomAccessIter first,
+    RandomAccessIter last, Function f,
+    const bgl_named_params< Param, Tag, Rest >& params)
+{
+    detail::dijkstra_batch(g, first, last,
+        choose_const_pmap(get_param(params, edge_weight), g, edge_weight),
+        choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+        choose_param(get_param(params, num_threads_t()), std::size_t(0)),
+        detail::dijkstra_null_visitor_maker(), f);
+}
+
+// Many-to-many distances on several threads: D[i][j] becomes the distance
+// from s_first[i] to t_first[j], or the largest distance value if it is
+// unreachable.  Each search stops once all targets are settled.
+template < typename Graph, typename RandomAccessIter,
+    typename TargetInputIter, typename DistanceMatrix, typename Param,
+    typename Tag, typename Rest >
+void dijkstra_many_to_many(const Graph& g, RandomAccessIter s_first,
+    RandomAccessIter s_last, TargetInputIter t_first, TargetInputIter t_last,
+    DistanceMatrix& D, const bgl_named_params< Param, Tag, Rest >& params)
+{
+    detail::dijkstra_many_to_many_dispatch(g, s_first, s_last, t_first,
+        t_last, D,
+        choose_const_pmap(get_param(params, edge_weight), g, edge_weight),
+        choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+        choose_param(get_param(params, num_threads_t()), std::size_t(0)));
+}
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_DIJKSTRA_WORKSPACE_HPP
@@ -0,0 +1,489 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// A directed compressed sparse row graph that keeps spare room after each
+// adjacency list, so that edges can be added in amortized constant time
+// while out-edges stay contiguous.
+
+#ifndef BOOST_GRAPH_DYNAMIC_CSR_GRAPH_HPP
+#define BOOST_GRAPH_DYNAMIC_CSR_GRAPH_HPP
+
+#include <boost/assert.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/detail/adj_list_edge_iterator.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/iterator/counting_iterator.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace boost
+{
+
+/** Directed CSR graph with per-vertex slack for incremental edge insertion.
+ *
+ * Each vertex owns a slot [m_rowstart[v], m_capacity_end[v]) of the column
+ * array, of which [m_rowstart[v], m_rowend[v]) holds its out-edges.  An edge
+ * is appended to the free part of its source's slot; a full slot is moved to
+ * the end of the column array with twice its capacity, so the cost of
+ * growing is amortized over the edges that filled it.  Slots that were moved
+ * away leave holes, and the whole array is repacked in vertex order once the
+ * holes take up half of it.  Adding m edges therefore costs O(m) amortized
+ * time in total, independently of the number of batches.
+ *
+ * Out-edges of a vertex are contiguous, so traversals run at the speed of
+ * compressed_sparse_row_graph.  Edge indices are slot positions: they are
+ * unique but not dense, so the graph provides no edge_index map.  Adding
+ * edges invalidates edge descriptors and iterators.
+ */
+template < typename EdgeProperty = no_property, typename Vertex = std::size_t,
+    typename EdgeIndex = Vertex >
+class dynamic_csr_graph
+{
+public:
+    // For Graph
+    typedef Vertex vertex_descriptor;
+    typedef detail::csr_edge_descriptor< Vertex, EdgeIndex > edge_descriptor;
+    typedef directed_tag directed_category;
+    typedef allow_parallel_edge_tag edge_parallel_category;
+
+    class traversal_category : public incidence_graph_tag,
+                               public adjacency_graph_tag,
+                               public vertex_list_graph_tag,
+                               public edge_list_graph_tag
+    {
+    };
+
+    static vertex_descriptor null_vertex() { return vertex_descriptor(-1); }
+
+    // For VertexListGraph
+    typedef counting_iterator< Vertex > vertex_iterator;
+    typedef Vertex vertices_size_type;
+
+    // For EdgeListGraph
+    typedef EdgeIndex edges_size_type;
+
+    // For IncidenceGraph
+    typedef detail::csr_out_edge_iterator< dynamic_csr_graph >
+        out_edge_iterator;
+    typedef EdgeIndex degree_size_type;
+
+    typedef detail::adj_list_edge_iterator< vertex_iterator, out_edge_iterator,
+        dynamic_csr_graph >
+        edge_iterator;
+
+    // For AdjacencyGraph
+    typedef const Vertex* adjacency_iterator;
+
+    // For BidirectionalGraph (not implemented)
+    typedef void in_edge_iterator;
+
+    typedef EdgeProperty edge_bundled;
+    typedef no_property vertex_property_type;
+    typedef no_property edge_property_type;
+    typedef no_property graph_property_type;
+
+    dynamic_csr_graph() : m_num_edges(0), m_abandoned(0) {}
+
+    explicit dynamic_csr_graph(vertices_size_type numverts)
+    : m_rowstart(numverts, 0)
+    , m_rowend(numverts, 0)
+    , m_capacity_end(numverts, 0)
+    , m_num_edges(0)
+    , m_abandoned(0)
+    {
+    }
+
+    //  From number of vertices and unsorted list of edges
+    template < typename MultiPassInputIterator >
+    dynamic_csr_graph(edges_are_unsorted_multi_pass_t,
+        MultiPassInputIterator edge_begin, MultiPassInputIterator edge_end,
+        vertices_size_type numverts)
+    : m_num_edges(0), m_abandoned(0)
+    {
+        detail::compressed_sparse_row_structure< EdgeProperty, Vertex,
+            EdgeIndex >
+            tmp;
+        tmp.assign_unsorted_multi_pass_edges(edge_begin, edge_end, numverts,
+            typed_identity_property_map< vertices_size_type >(),
+            keep_all());
+        repack(tmp.m_rowstart.begin(), tmp.m_rowstart.begin() + 1, numverts,
+            tmp.m_column, tmp.m_edge_properties);
+    }
+
+    //  From number of vertices and unsorted list of edges, plus edge
+    //  properties
+    template < typename MultiPassInputIterator, typename EdgePropertyIterator >
+    dynamic_csr_graph(edges_are_unsorted_multi_pass_t,
+        MultiPassInputIterator edge_begin, MultiPassInputIterator edge_end,
+        EdgePropertyIterator ep_iter, vertices_size_type numverts)
+    : m_num_edges(0), m_abandoned(0)
+    {
+        detail::compressed_sparse_row_structure< EdgeProperty, Vertex,
+            EdgeIndex >
+            tmp;
+        tmp.assign_unsorted_multi_pass_edges(edge_begin, edge_end, ep_iter,
+            numverts, typed_identity_property_map< vertices_size_type >(),
+            keep_all());
+        repack(tmp.m_rowstart.begin(), tmp.m_rowstart.begin() + 1, numverts,
+            tmp.m_column, tmp.m_edge_properties);
+    }
+
+    // Directly access an edge bundle
+    EdgeProperty& operator[](const edge_descriptor& e)
+    {
+        return m_edge_properties[e.idx];
+    }
+
+    const EdgeProperty& operator[](const edge_descriptor& e) const
+    {
+        return m_edge_properties[e.idx];
+    }
+
+    // Appends an edge to the out-edges of src
+    edge_descriptor add_edge_internal(
+        Vertex src, Vertex tgt, const EdgeProperty& p)
+    {
+        BOOST_ASSERT(src < m_rowstart.size() && tgt < m_rowstart.size());
+        if (m_rowend[src] == m_capacity_end[src])
+            grow_row(src);
+        EdgeIndex idx = m_rowend[src]++;
+        m_column[idx] = tgt;
+        if (has_edge_properties)
+            m_edge_properties[idx] = p;
+        ++m_num_edges;
+        return edge_descriptor(src, idx);
+    }
+
+    // Moves every row back into vertex order, leaving the usual slack after
+    // each one and no holes.  Invalidates edge descriptors.
+    void compact()
+    {
+        std::vector< Vertex > column;
+        std::vector< EdgeProperty > edge_properties;
+        column.swap(m_column);
+        edge_properties.swap(m_edge_properties);
+        std::vector< EdgeIndex > rowstart, rowend;
+        rowstart.swap(m_rowstart);
+        rowend.swap(m_rowend);
+        repack(rowstart.begin(), rowend.begin(), rowstart.size(), column,
+            edge_properties);
+    }
+
+    std::vector< EdgeIndex > m_rowstart;
+    std::vector< EdgeIndex > m_rowend;
+    std::vector< EdgeIndex > m_capacity_end;
+    std::vector< Vertex > m_column;
+    std::vector< EdgeProperty > m_edge_properties;
+    EdgeIndex m_num_edges;
+    EdgeIndex m_abandoned; // Column entries not owned by any vertex
+
+private:
+    static const bool has_edge_properties
+        = !is_same< EdgeProperty, no_property >::value;
+
+    // Room left after a row of the given degree when the rows are repacked
+    static EdgeIndex slack(EdgeIndex degree) { return degree / 4; }
+
+    // Lays the rows [begins[v], ends[v]) of column out in vertex order
+    template < typename BeginIter, typename EndIter >
+    void repack(BeginIter begins, EndIter ends, std::size_t numverts,
+        const std::vector< Vertex >& column,
+        const std::vector< EdgeProperty >& edge_properties)
+    {
+        m_rowstart.resize(numverts);
+        m_rowend.resize(numverts);
+        m_capacity_end.resize(numverts);
+        EdgeIndex total = 0;
+        for (std::size_t v = 0; v < numverts; ++v)
+        {
+            EdgeIndex degree = ends[v] - begins[v];
+            m_rowstart[v] = total;
+            m_rowend[v] = total + degree;
+            total += degree + slack(degree);
+            m_capacity_end[v] = total;
+        }
+        m_column.assign(total, Vertex(0));
+        if (has_edge_properties)
+            m_edge_properties.assign(total, EdgeProperty());
+        m_num_edges = 0;
+        for (std::size_t v = 0; v < numverts; ++v)
+        {
+            std::copy(column.begin() + begins[v], column.begin() + ends[v],
+                m_column.begin() + m_rowstart[v]);
+            if (has_edge_properties)
+                std::copy(edge_properties.begin() + begins[v],
+                    edge_properties.begin() + ends[v],
+                    m_edge_properties.begin() + m_rowstart[v]);
+            m_num_edges += ends[v] - begins[v];
+        }
+        m_abandoned = 0;
+    }
+
+    // Gives a full row at least one free entry
+    void grow_row(Vertex v)
+    {
+        EdgeIndex begin = m_rowstart[v];
+        EdgeIndex degree = m_rowend[v] - begin;
+        EdgeIndex capacity = (std::max)(EdgeIndex(4), EdgeIndex(2 * degree));
+        if (m_capacity_end[v] == m_column.size())
+        {
+            // Last slot in the array: extend it in place
+            resize_column(begin + capacity);
+            m_capacity_end[v] = begin + capacity;
+            return;
+        }
+        if (2 * (m_abandoned + degree) > m_column.size() + m_rowstart.size())
+        {
+            // Repacking leaves room after every row, including this one
+            compact();
+            if (m_rowend[v] != m_capacity_end[v])
+                return;
+            begin = m_rowstart[v];
+            if (m_capacity_end[v] == m_column.size())
+            {
+                resize_column(begin + capacity);
+                m_capacity_end[v] = begin + capacity;
+                return;
+            }
+        }
+        EdgeIndex new_begin = EdgeIndex(m_column.size());
+        resize_column(new_begin + capacity);
+        std::copy(m_column.begin() + begin, m_column.begin() + begin + degree,
+            m_column.begin() + new_begin);
+        if (has_edge_properties)
+            std::copy(m_edge_properties.begin() + begin,
+                m_edge_properties.begin() + begin + degree,
+                m_edge_properties.begin() + new_begin);
+        m_abandoned += m_capacity_end[v] - begin;
+        m_rowstart[v] = new_begin;
+        m_rowend[v] = new_begin + degree;
+        m_capacity_end[v] = new_begin + capacity;
+    }
+
+    void resize_column(EdgeIndex size)
+    {
+        m_column.resize(size);
+        if (has_edge_properties)
+            m_edge_properties.resize(size);
+    }
+};
+
+#define BOOST_DYNAMIC_CSR_GRAPH_TEMPLATE_PARMS \
+    typename EdgeProperty, typename Vertex, typename EdgeIndex
+#define BOOST_DYNAMIC_CSR_GRAPH_TYPE \
+    dynamic_csr_graph< EdgeProperty, Vertex, EdgeIndex >
+
+// From VertexListGraph
+template < BOOST_DYNAMIC_CSR_GRAPH_TEMPLATE_PARMS >
+inline Vertex num_vertices(const BOOST_DYNAMIC_CSR_GRAPH_TYPE& g)
+{
+    return Vertex(g.m_rowstart.size());
+}
+
+template < BOOST_DYNAMIC_CSR_GRAPH_TEMPLATE_PARMS >
+inline std::pair< counting_iterator< Vertex >, counting_iterator< Vertex > >
+vertices(const BOOST_DYNAMIC_CSR_GRAPH_TYPE& g)
+{
+    return std::make_pair(counting_iterator< Vertex >(0),
+        counting_iterator< Vertex >(num_vertices(g)));
+}
+
+template < BOOST_DYNAMIC_CSR_GRAPH_TEMPLATE_PARMS >
+inline Vertex vertex(Vertex i, const BOOST_DYNAMIC_CSR_GRAPH_TYPE&)
+{
+    return i;
+}
+
+// From IncidenceGraph
+template < BOOST_DYNAMIC_CSR_GRAPH_TEMPLATE_PARMS >
+inline Vertex source(typename BOOST_DYNAMIC_CSR_GRAPH_TYPE::edge_descriptor e,
+    const BOOST_DYNAMIC_CSR_GRAPH_TYPE&)
+{
+    return e.src;
+}
+
+template < BOOST_DYNAMIC_CSR_GRAPH_TEMPLATE_PARMS >
+inline Vertex target(typename BOOST_DYNAMIC_CSR_GRAPH_TYPE::edge_descriptor e,
+    const BOOST_DYNAMIC_CSR_GRAPH_TYPE& g)
+{
+    return g.m_column[e.idx];
+}
+
+template < BOOST_DYNAMIC_CSR_GRAPH_TEMPLATE_PARMS >
+inline std::pair< typename BOOST_DYNAMIC_CSR_GRAPH_TYPE::out_edge_iterator,
+    typename BOOST_DYNAMIC_CSR_GRAPH_TYPE::out_edge_iterator >
+out_edges(Vertex v, const BOOST_DYNAMIC_CSR_GRAPH_TYPE& g)
+{
+    typedef typename BOOST_DYNAMIC_CSR_GRAPH_TYPE::edge_descriptor ed;
+    typedef typename BOOST_DYNAMIC_CSR_GRAPH_TYPE::out_edge_iterator it;
+    return std::make_pair(
+        it(ed(v, g.m_rowstart[v])), it(ed(v, g.m_rowend[v])));
+}
+
+template < BOOST_DYNAMIC_CSR_GRAPH_TEMPLATE_PARMS >
+inline EdgeIndex out_degree(Vertex v, const BOOST_DYNAMIC_CSR_GRAPH_TYPE& g)
+{
+    return g.m_rowend[v] - g.m_rowstart[v];
+}
+
+// From AdjacencyGraph
+template < BOOST_DYNAMIC_CSR_GRAPH_TEMPLATE_PARMS >
+inline std::pair< const Vertex*, const Vertex* > adjacent_vertices(
+    Vertex v, const BOOST_DYNAMIC_CSR_GRAPH_TYPE& g)
+{
+    return std::make_pair(g.m_column.data() + g.m_rowstart[v],
+        g.m_column.data() + g.m_rowend[v]);
+}
+
+// From EdgeListGraph
+template < BOOST_DYNAMIC_CSR_GRAPH_TEMPLATE_PARMS >
+inline EdgeIndex num_edges(const BOOST_DYNAMIC_CSR_GRAPH_TYPE& g)
+{
+    return g.m_num_edges;
+}
+
+template < BOOST_DYNAMIC_CSR_GRAPH_TEMPLATE_PARMS >
+inline std::pair< typename BOOST_DYNAMIC_CSR_GRAPH_TYPE::edge_iterator,
+    typename BOOST_DYNAMIC_CSR_GRAPH_TYPE::edge_iterator >
+edges(const BOOST_DYNAMIC_CSR_GRAPH_TYPE& g)
+{
+    typedef typename BOOST_DYNAMIC_CSR_GRAPH_TYPE::edge_iterator ei;
+    typename BOOST_DYNAMIC_CSR_GRAPH_TYPE::vertex_iterator first, last;
+    boost::tie(first, last) = vertices(g);
+    return std::make_pair(ei(first, first, last, g), ei(first, last, last, g));
+}
+
+// Construction functions
+template < BOOST_DYNAMIC_CSR_GRAPH_TEMPLATE_PARMS >
+inline Vertex add_vertex(BOOST_DYNAMIC_CSR_GRAPH_TYPE& g)
+{
+    g.m_rowstart.push_back(EdgeIndex(g.m_column.size()));
+    g.m_rowend.push_back(EdgeIndex(g.m_column.size()));
+    g.m_capacity_end.push_back(EdgeIndex(g.m_column.size()));
+    return Vertex(g.m_rowstart.size() - 1);
+}
+
+template < BOOST_DYNAMIC_CSR_GRAPH_TEMPLATE_PARMS >
+inline Vertex add_vertices(
+    typename BOOST_DYNAMIC_CSR_GRAPH_TYPE::vertices_size_type count,
+    BOOST_DYNAMIC_CSR_GRAPH_TYPE& g)
+{
+    Vertex old_num_verts = num_vertices(g);
+    EdgeIndex end = EdgeIndex(g.m_column.size());
+    g.m_rowstart.resize(old_num_verts + count, end);
+    g.m_rowend.resize(old_num_verts + count, end);
+    g.m_capacity_end.resize(old_num_verts + count, end);
+    return old_num_verts;
+}
+
+template < BOOST_DYNAMIC_CSR_GRAPH_TEMPLATE_PARMS >
+inline std::pair< typename BOOST_DYNAMIC_CSR_GRAPH_TYPE::edge_descriptor, bool >
+add_edge(Vertex src, Vertex tgt, BOOST_DYNAMIC_CSR_GRAPH_TYPE& g)
+{
+    return std::make_pair(g.add_edge_internal(src, tgt, EdgeProperty()), true);
+}
+
+template < BOOST_DYNAMIC_CSR_GRAPH_TEMPLATE_PARMS >
+inline std::pair< typename BOOST_DYNAMIC_CSR_GRAPH_TYPE::edge_descriptor, bool >
+add_edge(Vertex src, Vertex tgt, const EdgeProperty& p,
+    BOOST_DYNAMIC_CSR_GRAPH_TYPE& g)
+{
+    return std::make_pair(g.add_edge_internal(src, tgt, p), true);
+}
+
+// Add edges from a range of (source, target) pairs that are unsorted
+template < BOOST_DYNAMIC_CSR_GRAPH_TEMPLATE_PARMS, typename InputIterator >
+inline void add_edges(
+    InputIterator first, InputIterator last, BOOST_DYNAMIC_CSR_GRAPH_TYPE& g)
+{
+    for (; first != last; ++first)
+        g.add_edge_internal(first->first, first->second, EdgeProperty());
+}
+
+// Add edges from a range of (source, target) pairs and edge properties that
+// are unsorted
+template < BOOST_DYNAMIC_CSR_GRAPH_TEMPLATE_PARMS, typename InputIterator,
+    typename EPIterator >
+inline void add_edges(InputIterator first, InputIterator last,
+    EPIterator ep_iter, EPIterator ep_iter_end,
+    BOOST_DYNAMIC_CSR_GRAPH_TYPE& g)
+{
+    for (; first != last && ep_iter != ep_iter_end; ++first, ++ep_iter)
+        g.add_edge_internal(first->first, first->second, *ep_iter);
+}
+
+// Property maps: the vertex index and the edge bundles
+template < BOOST_DYNAMIC_CSR_GRAPH_TEMPLATE_PARMS >
+struct property_map< BOOST_DYNAMIC_CSR_GRAPH_TYPE, vertex_index_t >
+{
+    typedef typed_identity_property_map< Vertex > type;
+    typedef type const_type;
+};
+
+template < BOOST_DYNAMIC_CSR_GRAPH_TEMPLATE_PARMS >
+struct property_map< BOOST_DYNAMIC_CSR_GRAPH_TYPE, edge_bundle_t >
+{
+    typedef iterator_property_map<
+        typename std::vector< EdgeProperty >::iterator,
+        detail::csr_edge_index_map< Vertex, EdgeIndex >, EdgeProperty,
+        EdgeProperty& >
+        type;
+    typedef iterator_property_map<
+        typename std::vector< EdgeProperty >::const_iterator,
+        detail::csr_edge_index_map< Vertex, EdgeIndex >, EdgeProperty,
+        const EdgeProperty& >
+        const_type;
+};
+
+template < BOOST_DYNAMIC_CSR_GRAPH_TEMPLATE_PARMS >
+inline typed_identity_property_map< Vertex > get(
+    vertex_index_t, const BOOST_DYNAMIC_CSR_GRAPH_TYPE&)
+{
+    return typed_identity_property_map< Vertex >();
+}
+
+template < BOOST_DYNAMIC_CSR_GRAPH_TEMPLATE_PARMS >
+inline Vertex get(
+    vertex_index_t, const BOOST_DYNAMIC_CSR_GRAPH_TYPE&, Vertex v)
+{
+    return v;
+}
+
+template < BOOST_DYNAMIC_CSR_GRAPH_TEMPLATE_PARMS >
+inline typename property_map< BOOST_DYNAMIC_CSR_GRAPH_TYPE,
+    edge_bundle_t >::type
+get(edge_bundle_t, BOOST_DYNAMIC_CSR_GRAPH_TYPE& g)
+{
+    BOOST_STATIC_ASSERT_MSG((!is_same< EdgeProperty, no_property >::value),
+        "dynamic_csr_graph has no edge bundles");
+    return typename property_map< BOOST_DYNAMIC_CSR_GRAPH_TYPE,
+        edge_bundle_t >::type(g.m_edge_properties.begin());
+}
+
+template < BOOST_DYNAMIC_CSR_GRAPH_TEMPLATE_PARMS >
+inline typename property_map< BOOST_DYNAMIC_CSR_GRAPH_TYPE,
+    edge_bundle_t >::const_type
+get(edge_bundle_t, const BOOST_DYNAMIC_CSR_GRAPH_TYPE& g)
+{
+    BOOST_STATIC_ASSERT_MSG((!is_same< EdgeProperty, no_property >::value),
+        "dynamic_csr_graph has no edge bundles");
+    return typename property_map< BOOST_DYNAMIC_CSR_GRAPH_TYPE,
+        edge_bundle_t >::const_type(g.m_edge_properties.begin());
+}
+
+#undef BOOST_DYNAMIC_CSR_GRAPH_TYPE
+#undef BOOST_DYNAMIC_CSR_GRAPH_TEMPLATE_PARMS
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_DYNAMIC_CSR_GRAPH_HPP
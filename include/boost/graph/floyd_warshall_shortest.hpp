@@ -33,7 +33,12 @@
 #include <boost/graph/named_function_params.hpp>
 #include <boost/graph/graph_concepts.hpp>
 #include <boost/graph/relax.hpp>
+#include <boost/graph/detail/parallel_for.hpp>
 #include <boost/concept/assert.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <vector>
 
 namespace boost
 {
@@ -71,6 +76,202 @@ namespace detail
                 return false;
         return true;
     }
+
+    // Edge length of the square tiles of the blocked algorithm.  Three
+    // tiles of doubles take 96 KB, which stays in a typical L2 cache.
+    const std::size_t floyd_warshall_tile = 64;
+
+    // c[j] = min(c[j], a + b[j]) for j in [0, n), skipping infinite b[j].
+    // The loop body is branch-free so that it vectorizes.
+    template < typename T >
+    inline void floyd_warshall_min_plus(
+        T* c, const T* b, std::size_t n, const T a, const T inf)
+    {
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            const T s = b[j] == inf ? c[j] : T(a + b[j]);
+            c[j] = s < c[j] ? s : c[j];
+        }
+    }
+
+    // The same for a full tile row that does not overlap b.  The fixed
+    // length and the restrict qualifiers let the compiler vectorize it
+    // without run-time alias checks.
+    template < typename T >
+    inline void floyd_warshall_min_plus_tile(T* BOOST_RESTRICT c,
+        const T* BOOST_RESTRICT b, const T a, const T inf)
+    {
+        for (std::size_t j = 0; j < floyd_warshall_tile; ++j)
+        {
+            const T s = b[j] == inf ? c[j] : T(a + b[j]);
+            c[j] = s < c[j] ? s : c[j];
+        }
+    }
+
+    // Relaxes row i of the matrix through pivot k, over the columns
+    // [jb, je).  Row k only changes itself through a negative d[k][k], and
+    // otherwise never overlaps row i.
+    template < typename T >
+    inline void floyd_warshall_relax_row(T* const* rows, std::size_t i,
+        std::size_t k, std::size_t jb, std::size_t je, const T& inf)
+    {
+        const T a = rows[i][k];
+        if (a == inf || (i == k && !(a < T(0))))
+            return;
+        if (i != k && je - jb == floyd_warshall_tile)
+            floyd_warshall_min_plus_tile(rows[i] + jb, rows[k] + jb, a, inf);
+        else
+            floyd_warshall_min_plus(
+                rows[i] + jb, rows[k] + jb, je - jb, a, inf);
+    }
+
+    // Relaxes rows [ib, ie) x columns [jb, je) of the matrix through the
+    // pivots [kb, ke) in Floyd-Warshall order, pivot by pivot.  This order
+    // is required when the tile is in the pivot row or column, because it
+    // then reads its own entries.
+    template < typename T >
+    void floyd_warshall_tile_closure(T* const* rows, std::size_t ib,
+        std::size_t ie, std::size_t jb, std::size_t je, std::size_t kb,
+        std::size_t ke, const T& inf)
+    {
+        for (std::size_t k = kb; k < ke; ++k)
+            for (std::size_t i = ib; i < ie; ++i)
+                floyd_warshall_relax_row(rows, i, k, jb, je, inf);
+    }
+
+    // The same relaxation for a tile outside the pivot row and column,
+    // whose inputs do not change: row by row, so that each row of the tile
+    // stays in the L1 cache for all the pivots.
+    template < typename T >
+    void floyd_warshall_tile_update(T* const* rows, std::size_t ib,
+        std::size_t ie, std::size_t jb, std::size_t je, std::size_t kb,
+        std::size_t ke, const T& inf)
+    {
+        for (std::size_t i = ib; i < ie; ++i)
+            for (std::size_t k = kb; k < ke; ++k)
+                floyd_warshall_relax_row(rows, i, k, jb, je, inf);
+    }
+
+    // Blocked Floyd-Warshall (Venkataraman, Sahni and Mukhopadhyaya) on an
+    // n x n matrix given by its row pointers.  For each pivot tile, the
+    // tile itself is closed first, then the other tiles of its row and
+    // column, then all remaining tiles; the tiles of the last two phases
+    // are independent and are updated in parallel.  Every entry ends up at
+    // most the value the plain triple loop computes, and is the length of
+    // some walk, so negative cycles are detected the same way.
+    template < typename T >
+    bool floyd_warshall_blocked(T* const* rows, std::size_t n, const T& inf,
+        const T& zero, std::size_t num_threads)
+    {
+        const std::size_t b = floyd_warshall_tile;
+        const std::size_t num_tiles = (n + b - 1) / b;
+        for (std::size_t kt = 0; kt < num_tiles; ++kt)
+        {
+            const std::size_t kb = kt * b, ke = (std::min)(n, kb + b);
+            floyd_warshall_tile_closure(rows, kb, ke, kb, ke, kb, ke, inf);
+
+            boost::graph::detail::parallel_for_dynamic(2 * num_tiles,
+                std::size_t(1), num_threads,
+                [&](std::size_t, std::size_t first, std::size_t last) {
+                    for (std::size_t x = first; x < last; ++x)
+                    {
+                        const std::size_t t = x / 2;
+                        if (t == kt)
+                            continue;
+                        const std::size_t tb = t * b;
+                        const std::size_t te = (std::min)(n, tb + b);
+                        if (x % 2 == 0)
+                            floyd_warshall_tile_closure(
+                                rows, kb, ke, tb, te, kb, ke, inf);
+                        else
+                            floyd_warshall_tile_closure(
+                                rows, tb, te, kb, ke, kb, ke, inf);
+                    }
+                });
+
+            boost::graph::detail::parallel_for_dynamic(num_tiles * num_tiles,
+                std::size_t(1), num_threads,
+                [&](std::size_t, std::size_t first, std::size_t last) {
+                    for (std::size_t x = first; x < last; ++x)
+                    {
+                        const std::size_t it = x / num_tiles;
+                        const std::size_t jt = x % num_tiles;
+                        if (it == kt || jt == kt)
+                            continue;
+                        const std::size_t ib = it * b, jb = jt * b;
+                        floyd_warshall_tile_update(rows, ib,
+                            (std::min)(n, ib + b), jb, (std::min)(n, jb + b),
+                            kb, ke, inf);
+                    }
+                });
+        }
+
+        for (std::size_t i = 0; i < n; ++i)
+            if (rows[i][i] < zero)
+                return false;
+        return true;
+    }
+
+    // Number of vertices if they are exactly 0, 1, ..., n - 1 in order, so
+    // that they index a dense matrix directly; otherwise -1.
+    template < typename VertexListGraph >
+    std::ptrdiff_t floyd_warshall_dense_vertices(const VertexListGraph& g)
+    {
+        std::size_t n = 0;
+        typename graph_traits< VertexListGraph >::vertex_iterator i, last;
+        for (boost::tie(i, last) = vertices(g); i != last; ++i, ++n)
+            if (std::size_t(*i) != n)
+                return -1;
+        return std::ptrdiff_t(n);
+    }
+
+    // Picks the algorithm for the matrix type.  Matrices whose rows are
+    // contiguous arrays, with the default comparison and combination, use
+    // the blocked algorithm; everything else uses the plain triple loop.
+    template < typename VertexListGraph, typename DistanceMatrix,
+        typename BinaryPredicate, typename BinaryFunction, typename Infinity,
+        typename Zero >
+    bool floyd_warshall_select(const VertexListGraph& g, DistanceMatrix& d,
+        const BinaryPredicate& compare, const BinaryFunction& combine,
+        const Infinity& inf, const Zero& zero, std::size_t)
+    {
+        return floyd_warshall_dispatch(g, d, compare, combine, inf, zero);
+    }
+
+    template < typename VertexListGraph, typename T, typename Alloc,
+        typename RowAlloc >
+    bool floyd_warshall_select(const VertexListGraph& g,
+        std::vector< std::vector< T, Alloc >, RowAlloc >& d,
+        const std::less< T >& compare, const closed_plus< T >& combine,
+        const T& inf, const T& zero, std::size_t num_threads)
+    {
+        const std::ptrdiff_t n = floyd_warshall_dense_vertices(g);
+        std::vector< T* > rows;
+        if (n >= 0 && combine.inf == inf && d.size() >= std::size_t(n))
+            for (std::ptrdiff_t i = 0; i < n && d[i].size() >= std::size_t(n);
+                 ++i)
+                rows.push_back(d[i].data());
+        if (n < 0 || rows.size() != std::size_t(n))
+            return floyd_warshall_dispatch(g, d, compare, combine, inf, zero);
+        return floyd_warshall_blocked(
+            rows.data(), rows.size(), inf, zero, num_threads);
+    }
+
+    template < typename VertexListGraph, typename T, std::size_t N,
+        std::size_t M >
+    bool floyd_warshall_select(const VertexListGraph& g, T (&d)[N][M],
+        const std::less< T >& compare, const closed_plus< T >& combine,
+        const T& inf, const T& zero, std::size_t num_threads)
+    {
+        const std::ptrdiff_t n = floyd_warshall_dense_vertices(g);
+        if (n < 0 || combine.inf != inf || std::size_t(n) > (std::min)(N, M))
+            return floyd_warshall_dispatch(g, d, compare, combine, inf, zero);
+        std::vector< T* > rows;
+        for (std::ptrdiff_t i = 0; i < n; ++i)
+            rows.push_back(d[i]);
+        return floyd_warshall_blocked(
+            rows.data(), rows.size(), inf, zero, num_threads);
+    }
 }
 
 template < typename VertexListGraph, typename DistanceMatrix,
@@ -78,11 +279,13 @@ template < typename VertexListGraph, typename DistanceMatrix,
     typename Zero >
 bool floyd_warshall_initialized_all_pairs_shortest_paths(
     const VertexListGraph& g, DistanceMatrix& d, const BinaryPredicate& compare,
-    const BinaryFunction& combine, const Infinity& inf, const Zero& zero)
+    const BinaryFunction& combine, const Infinity& inf, const Zero& zero,
+    std::size_t num_threads = 1)
 {
     BOOST_CONCEPT_ASSERT((VertexListGraphConcept< VertexListGraph >));
 
-    return detail::floyd_warshall_dispatch(g, d, compare, combine, inf, zero);
+    return detail::floyd_warshall_select(
+        g, d, compare, combine, inf, zero, num_threads);
 }
 
 template < typename VertexAndEdgeListGraph, typename DistanceMatrix,
@@ -90,7 +293,8 @@ template < typename VertexAndEdgeListGraph, typename DistanceMatrix,
     typename Infinity, typename Zero >
 bool floyd_warshall_all_pairs_shortest_paths(const VertexAndEdgeListGraph& g,
     DistanceMatrix& d, const WeightMap& w, const BinaryPredicate& compare,
-    const BinaryFunction& combine, const Infinity& inf, const Zero& zero)
+    const BinaryFunction& combine, const Infinity& inf, const Zero& zero,
+    std::size_t num_threads = 1)
 {
     BOOST_CONCEPT_ASSERT((VertexListGraphConcept< VertexAndEdgeListGraph >));
     BOOST_CONCEPT_ASSERT((EdgeListGraphConcept< VertexAndEdgeListGraph >));
@@ -136,7 +340,8 @@ bool floyd_warshall_all_pairs_shortest_paths(const VertexAndEdgeListGraph& g,
         }
     }
 
-    return detail::floyd_warshall_dispatch(g, d, compare, combine, inf, zero);
+    return detail::floyd_warshall_select(
+        g, d, compare, combine, inf, zero, num_threads);
 }
 
 namespace detail
@@ -156,7 +361,8 @@ namespace detail
                 get_param(params, distance_compare_t()), std::less< WM >()),
             choose_param(get_param(params, distance_combine_t()),
                 closed_plus< WM >(inf)),
-            inf, choose_param(get_param(params, distance_zero_t()), WM()));
+            inf, choose_param(get_param(params, distance_zero_t()), WM()),
+            choose_param(get_param(params, num_threads_t()), std::size_t(1)));
     }
 
     template < class VertexAndEdgeListGraph, class DistanceMatrix,
@@ -174,7 +380,8 @@ namespace detail
                 get_param(params, distance_compare_t()), std::less< WM >()),
             choose_param(get_param(params, distance_combine_t()),
                 closed_plus< WM >(inf)),
-            inf, choose_param(get_param(params, distance_zero_t()), WM()));
+            inf, choose_param(get_param(params, distance_zero_t()), WM()),
+            choose_param(get_param(params, num_threads_t()), std::size_t(1)));
     }
 
 } // namespace detail
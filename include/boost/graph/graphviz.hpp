@@ -798,13 +798,14 @@ namespace detail
 
         template < typename Directed, typename VertexProperty,
             typename EdgeProperty, typename GraphProperty, typename Vertex,
-            typename EdgeIndex >
+            typename EdgeIndex, typename Allocator >
         class mutate_graph_impl< compressed_sparse_row_graph< Directed,
-            VertexProperty, EdgeProperty, GraphProperty, Vertex, EdgeIndex > >
+            VertexProperty, EdgeProperty, GraphProperty, Vertex, EdgeIndex,
+            Allocator > >
         : public mutate_graph
         {
             typedef compressed_sparse_row_graph< Directed, VertexProperty,
-                EdgeProperty, GraphProperty, Vertex, EdgeIndex >
+                EdgeProperty, GraphProperty, Vertex, EdgeIndex, Allocator >
                 CSRGraph;
             typedef typename graph_traits< CSRGraph >::vertices_size_type
                 bgl_vertex_t;
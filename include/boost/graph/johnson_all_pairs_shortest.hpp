@@ -17,6 +17,14 @@
     (VertexAndEdgeListGraph& g,
      DistanceMatrix& D,
      const bgl_named_params<P, T, R>& params)
+
+  and its parallel, row-streaming counterpart
+
+  template <class Graph, class RowFunction, class P, class T, class R>
+  bool
+  parallel_johnson_all_pairs_shortest_paths
+    (const Graph& g, RowFunction f,
+     const bgl_named_params<P, T, R>& params)
  */
 
 #ifndef BOOST_GRAPH_JOHNSON_HPP
@@ -27,9 +35,14 @@
 #include <boost/property_map/shared_array_property_map.hpp>
 #include <boost/graph/bellman_ford_shortest_paths.hpp>
 #include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/graph/dijkstra_workspace.hpp>
+#include <boost/graph/spfa_shortest_paths.hpp>
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/type_traits/same_traits.hpp>
 #include <boost/concept/assert.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <vector>
 
 namespace boost
 {
@@ -193,6 +206,205 @@ bool johnson_all_pairs_shortest_paths(
         g, D, params, get(edge_weight, g), get(vertex_index, g));
 }
 
+namespace detail
+{
+    // The reweighted edge lengths w(u, v) + h(u) - h(v), non-negative for
+    // the potentials h found by Bellman-Ford
+    template < typename Graph, typename WeightMap, typename PotentialMap >
+    class johnson_reweighted_map
+    {
+    public:
+        typedef typename graph_traits< Graph >::edge_descriptor key_type;
+        typedef typename property_traits< WeightMap >::value_type value_type;
+        typedef value_type reference;
+        typedef readable_property_map_tag category;
+
+        johnson_reweighted_map(
+            const Graph& g, WeightMap weight, PotentialMap h)
+        : m_g(&g), m_weight(weight), m_h(h)
+        {
+        }
+
+        friend value_type get(
+            const johnson_reweighted_map& m, const key_type& e)
+        {
+            return value_type(get(m.m_weight, e)
+                + get(m.m_h, source(e, *m.m_g))
+                - get(m.m_h, target(e, *m.m_g)));
+        }
+
+    private:
+        const Graph* m_g;
+        WeightMap m_weight;
+        PotentialMap m_h;
+    };
+
+    // Converts each finished search back to the original lengths, in a row
+    // owned by the thread that ran it, and passes the row to f.  Only the
+    // entries of reached vertices are written, and they are reset to
+    // infinity afterwards, so a row costs O(reached) on top of f.
+    template < typename Vertex, typename Distance, typename VertexIndexMap,
+        typename RowFunction >
+    struct johnson_row_emitter
+    {
+        template < typename Workspace >
+        void operator()(std::size_t t, std::size_t i, const Workspace& ws)
+        {
+            const Distance inf = (std::numeric_limits< Distance >::max)();
+            std::vector< Distance >& row = (*m_rows)[t];
+            if (row.empty())
+                row.assign(m_h->size(), inf);
+            const Vertex s = (*m_vertices)[i];
+            const Distance hs = (*m_h)[get(m_index, s)];
+            const std::vector< Vertex >& reached = ws.reached_vertices();
+            for (std::size_t k = 0; k < reached.size(); ++k)
+            {
+                std::size_t j = get(m_index, reached[k]);
+                row[j] = Distance(ws.distance(reached[k]) - hs + (*m_h)[j]);
+            }
+            (*m_f)(s, static_cast< const std::vector< Distance >& >(row));
+            for (std::size_t k = 0; k < reached.size(); ++k)
+                row[get(m_index, reached[k])] = inf;
+        }
+
+        const std::vector< Vertex >* m_vertices;
+        const std::vector< Distance >* m_h;
+        std::vector< std::vector< Distance > >* m_rows;
+        VertexIndexMap m_index;
+        RowFunction* m_f;
+    };
+
+    template < typename Graph, typename WeightMap, typename VertexIndexMap,
+        typename RowFunction >
+    bool parallel_johnson_impl(const Graph& g, WeightMap weight,
+        VertexIndexMap index, std::size_t num_threads, RowFunction& f)
+    {
+        BOOST_CONCEPT_ASSERT((IncidenceGraphConcept< Graph >));
+        BOOST_CONCEPT_ASSERT((VertexListGraphConcept< Graph >));
+        typedef typename graph_traits< Graph >::vertex_descriptor Vertex;
+        typedef typename property_traits< WeightMap >::value_type Distance;
+        typedef iterator_property_map<
+            typename std::vector< Distance >::iterator, VertexIndexMap >
+            PotentialMap;
+        num_threads = boost::graph::detail::resolve_num_threads(num_threads);
+
+        std::vector< Vertex > vertex_list;
+        bool negative = false;
+        typename graph_traits< Graph >::vertex_iterator vi, vi_end;
+        for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+        {
+            vertex_list.push_back(*vi);
+            typename graph_traits< Graph >::out_edge_iterator ei, ei_end;
+            for (boost::tie(ei, ei_end) = out_edges(*vi, g);
+                 ei != ei_end && !negative; ++ei)
+                negative = get(weight, *ei) < Distance(0);
+        }
+
+        // The potentials are the distances from a virtual source with a
+        // zero edge to every vertex, i.e. a search from all vertices at
+        // once; without negative edges they are all zero
+        std::vector< Distance > h(vertex_list.size(), Distance(0));
+        PotentialMap potential(h.begin(), index);
+        if (negative)
+        {
+            std::vector< Vertex > cycle;
+            bool feasible = num_threads == 1
+                ? spfa_impl(g, vertex_list.begin(), vertex_list.end(),
+                    weight, potential, dummy_property_map(), index,
+                    std::back_inserter(cycle))
+                : parallel_bellman_ford_impl(g, vertex_list.begin(),
+                    vertex_list.end(), weight, potential,
+                    dummy_property_map(), index, std::back_inserter(cycle),
+                    num_threads);
+            if (!feasible)
+                return false;
+        }
+
+        std::vector< std::vector< Distance > > rows(num_threads);
+        johnson_row_emitter< Vertex, Distance, VertexIndexMap, RowFunction >
+            emit = { &vertex_list, &h, &rows, index, &f };
+        if (negative)
+            dijkstra_batch_on_threads(g, vertex_list.begin(),
+                vertex_list.end(),
+                johnson_reweighted_map< Graph, WeightMap, PotentialMap >(
+                    g, weight, potential),
+                index, num_threads, dijkstra_null_visitor_maker(), emit);
+        else
+            dijkstra_batch_on_threads(g, vertex_list.begin(),
+                vertex_list.end(), weight, index, num_threads,
+                dijkstra_null_visitor_maker(), emit);
+        return true;
+    }
+} // namespace detail
+
+// All-pairs shortest paths without a distance matrix: runs Johnson's
+// algorithm with one Dijkstra search per source on num_threads threads (0
+// for one per hardware thread), each reusing its own workspace, and calls
+// f(s, row) as soon as the search from s finishes.  row[get(index, v)] is
+// the distance from s to v, or the largest distance value if v is not
+// reachable; the row is only valid during the call.  f is called
+// concurrently for distinct sources.  Returns false, without calling f,
+// if the graph has a negative cycle.
+template < typename Graph, typename RowFunction, typename WeightMap,
+    typename VertexIndexMap >
+bool parallel_johnson_all_pairs_shortest_paths(const Graph& g,
+    RowFunction f, WeightMap weight, VertexIndexMap index,
+    std::size_t num_threads = 0)
+{
+    return detail::parallel_johnson_impl(g, weight, index, num_threads, f);
+}
+
+// Named parameter version: weight_map, vertex_index_map and num_threads
+template < typename Graph, typename RowFunction, typename P, typename T,
+    typename R >
+bool parallel_johnson_all_pairs_shortest_paths(const Graph& g,
+    RowFunction f, const bgl_named_params< P, T, R >& params)
+{
+    return detail::parallel_johnson_impl(g,
+        choose_const_pmap(get_param(params, edge_weight), g, edge_weight),
+        choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+        choose_param(get_param(params, num_threads_t()), std::size_t(0)), f);
+}
+
+template < typename Graph, typename RowFunction >
+bool parallel_johnson_all_pairs_shortest_paths(const Graph& g, RowFunction f)
+{
+    return detail::parallel_johnson_impl(g, get(edge_weight, g),
+        get(vertex_index, g), std::size_t(0), f);
+}
+
+// A row function for parallel_johnson_all_pairs_shortest_paths that copies
+// the row of s to base + get(index, s) * n, filling a row-major n x n
+// array.  The array may be a writable memory mapping of a file, which
+// lets the operating system page the matrix out as it is written.
+template < typename Distance, typename VertexIndexMap >
+class distance_row_writer
+{
+public:
+    distance_row_writer(Distance* base, VertexIndexMap index)
+    : m_base(base), m_index(index)
+    {
+    }
+
+    template < typename Vertex >
+    void operator()(Vertex s, const std::vector< Distance >& row) const
+    {
+        std::copy(
+            row.begin(), row.end(), m_base + get(m_index, s) * row.size());
+    }
+
+private:
+    Distance* m_base;
+    VertexIndexMap m_index;
+};
+
+template < typename Distance, typename VertexIndexMap >
+distance_row_writer< Distance, VertexIndexMap > make_distance_row_writer(
+    Distance* base, VertexIndexMap index)
+{
+    return distance_row_writer< Distance, VertexIndexMap >(base, index);
+}
+
 } // namespace boost
 
 #endif // BOOST_GRAPH_JOHNSON_HPP
@@ -13,6 +13,7 @@
 #include <boost/graph/graph_concepts.hpp>
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/louvain_quality_functions.hpp>
+#include <boost/graph/detail/parallel_for.hpp>
 
 #include <boost/property_map/property_map.hpp>
 #include <boost/property_map/vector_property_map.hpp>
@@ -27,7 +28,11 @@
 #include <boost/unordered/unordered_flat_set.hpp>
 #include <boost/container_hash/hash.hpp>
 #include <algorithm>
+#include <limits>
+#include <numeric>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace boost
 {
@@ -493,6 +498,394 @@ local_optimization(
     return local_optimization_impl(g, communities, w, std::forward<URBG>(gen), f, min_improvement_inner, is_incremental{});
 }
 
+/// @brief Undirected graph in compressed sparse row form, used by the parallel mode.
+/// @note Each edge is stored at both endpoints. Self-loops are kept apart: self_loops[v]
+///       sums their weights as out_edges lists them, i.e. twice per self-loop.
+template <typename WeightType>
+struct csr_graph
+{
+    std::vector<std::size_t> offsets; // size() + 1 entries
+    std::vector<std::size_t> targets;
+    std::vector<WeightType> weights;
+    std::vector<WeightType> self_loops;
+
+    std::size_t size() const { return self_loops.size(); }
+};
+
+// Vertices (or communities) handed to a worker at a time
+constexpr std::size_t parallel_grain = 1024;
+
+/// @brief Copy an undirected graph into a csr_graph, vertices numbered by index_map.
+template <typename Graph, typename WeightMap, typename IndexMap>
+csr_graph<typename property_traits<WeightMap>::value_type>
+to_csr(const Graph& g, const WeightMap& weight, const IndexMap& index_map, std::size_t num_threads)
+{
+    using weight_type = typename property_traits<WeightMap>::value_type;
+    using vertex_descriptor = typename graph_traits<Graph>::vertex_descriptor;
+    using vertex_iterator = typename graph_traits<Graph>::vertex_iterator;
+    using out_edge_iterator = typename graph_traits<Graph>::out_edge_iterator;
+
+    std::size_t n = num_vertices(g);
+    std::vector<vertex_descriptor> by_index(n);
+    vertex_iterator vi, vi_end;
+    for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi) {
+        by_index[get(index_map, *vi)] = *vi;
+    }
+
+    csr_graph<weight_type> csr;
+    csr.offsets.assign(n + 1, 0);
+    csr.self_loops.assign(n, weight_type(0));
+
+    // Count the neighbours of each vertex
+    boost::graph::detail::parallel_for_dynamic(n, parallel_grain, num_threads,
+        [&](std::size_t, std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                out_edge_iterator ei, ei_end;
+                for (boost::tie(ei, ei_end) = out_edges(by_index[i], g); ei != ei_end; ++ei) {
+                    if (target(*ei, g) == by_index[i]) {
+                        csr.self_loops[i] += get(weight, *ei);
+                    } else {
+                        ++csr.offsets[i + 1];
+                    }
+                }
+            }
+        });
+    for (std::size_t i = 0; i < n; ++i) {
+        csr.offsets[i + 1] += csr.offsets[i];
+    }
+
+    csr.targets.resize(csr.offsets[n]);
+    csr.weights.resize(csr.offsets[n]);
+    boost::graph::detail::parallel_for_dynamic(n, parallel_grain, num_threads,
+        [&](std::size_t, std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                std::size_t pos = csr.offsets[i];
+                out_edge_iterator ei, ei_end;
+                for (boost::tie(ei, ei_end) = out_edges(by_index[i], g); ei != ei_end; ++ei) {
+                    if (target(*ei, g) != by_index[i]) {
+                        csr.targets[pos] = get(index_map, target(*ei, g));
+                        csr.weights[pos] = get(weight, *ei);
+                        ++pos;
+                    }
+                }
+            }
+        });
+    return csr;
+}
+
+/// @brief Collapse communities into the vertices of a coarser csr_graph, in parallel.
+/// @param community Vertex to community label in [0, g.size()). Relabelled in place
+///        to the coarse vertex of each vertex, numbered in order of first appearance.
+/// @note Each coarse vertex gathers the edges of its members, sorted by target, so the
+///       weights are summed in the same order for any number of threads.
+template <typename WeightType>
+csr_graph<WeightType> parallel_aggregate(
+    const csr_graph<WeightType>& g,
+    std::vector<std::size_t>& community,
+    std::size_t num_threads)
+{
+    using edge_type = std::pair<std::size_t, WeightType>;
+
+    std::size_t n = g.size();
+    const std::size_t none = (std::numeric_limits<std::size_t>::max)();
+    std::vector<std::size_t> label(n, none);
+    std::size_t n_communities = 0;
+    for (std::size_t v = 0; v < n; ++v) {
+        std::size_t& l = label[community[v]];
+        if (l == none) {
+            l = n_communities++;
+        }
+        community[v] = l;
+    }
+
+    // Members of each community, by counting sort
+    std::vector<std::size_t> member_offsets(n_communities + 1, 0);
+    std::vector<std::size_t> members(n);
+    for (std::size_t v = 0; v < n; ++v) {
+        ++member_offsets[community[v] + 1];
+    }
+    for (std::size_t c = 0; c < n_communities; ++c) {
+        member_offsets[c + 1] += member_offsets[c];
+    }
+    {
+        std::vector<std::size_t> next(member_offsets.begin(), member_offsets.end() - 1);
+        for (std::size_t v = 0; v < n; ++v) {
+            members[next[community[v]]++] = v;
+        }
+    }
+
+    // Each chunk of coarse vertices writes its edges to its own buffer
+    csr_graph<WeightType> coarse;
+    coarse.offsets.assign(n_communities + 1, 0);
+    coarse.self_loops.assign(n_communities, WeightType(0));
+    std::vector<std::vector<edge_type>> chunk_edges((n_communities + parallel_grain - 1) / parallel_grain);
+    std::vector<std::vector<edge_type>> scratch(boost::graph::detail::resolve_num_threads(num_threads));
+    boost::graph::detail::parallel_for_dynamic(n_communities, parallel_grain, num_threads,
+        [&](std::size_t t, std::size_t begin, std::size_t end) {
+            std::vector<edge_type>& pairs = scratch[t];
+            std::vector<edge_type>& out = chunk_edges[begin / parallel_grain];
+            for (std::size_t c = begin; c < end; ++c) {
+                pairs.clear();
+                // Edges inside the community become a self-loop, counted at both ends
+                WeightType self_loop(0);
+                for (std::size_t i = member_offsets[c]; i < member_offsets[c + 1]; ++i) {
+                    std::size_t v = members[i];
+                    self_loop += g.self_loops[v];
+                    for (std::size_t e = g.offsets[v]; e < g.offsets[v + 1]; ++e) {
+                        std::size_t d = community[g.targets[e]];
+                        if (d == c) {
+                            self_loop += g.weights[e];
+                        } else {
+                            pairs.push_back(edge_type(d, g.weights[e]));
+                        }
+                    }
+                }
+                std::sort(pairs.begin(), pairs.end());
+                std::size_t first = out.size();
+                for (const edge_type& p : pairs) {
+                    if (out.size() > first && out.back().first == p.first) {
+                        out.back().second += p.second;
+                    } else {
+                        out.push_back(p);
+                    }
+                }
+                coarse.offsets[c + 1] = out.size() - first;
+                coarse.self_loops[c] = self_loop;
+            }
+        });
+    for (std::size_t c = 0; c < n_communities; ++c) {
+        coarse.offsets[c + 1] += coarse.offsets[c];
+    }
+
+    coarse.targets.resize(coarse.offsets[n_communities]);
+    coarse.weights.resize(coarse.offsets[n_communities]);
+    boost::graph::detail::parallel_for_dynamic(chunk_edges.size(), std::size_t(1), num_threads,
+        [&](std::size_t, std::size_t begin, std::size_t end) {
+            for (std::size_t k = begin; k < end; ++k) {
+                std::size_t pos = coarse.offsets[k * parallel_grain];
+                for (const edge_type& p : chunk_edges[k]) {
+                    coarse.targets[pos] = p.first;
+                    coarse.weights[pos] = p.second;
+                    ++pos;
+                }
+            }
+        });
+    return coarse;
+}
+
+/// @brief Community totals as seen by a vertex taken out of its own community.
+template <typename TotMap, typename WeightType>
+struct tot_without_vertex
+{
+    using key_type = std::size_t;
+    using value_type = WeightType;
+    using reference = WeightType;
+    using category = readable_property_map_tag;
+
+    TotMap tot;
+    std::size_t c_old;
+    WeightType k_v;
+
+    friend WeightType get(const tot_without_vertex& m, std::size_t c)
+    {
+        return c == m.c_old ? get(m.tot, c) - m.k_v : get(m.tot, c);
+    }
+};
+
+/// @brief Sum the weights of edges inside communities into in[c], counted at both ends.
+template <typename WeightType>
+void community_internal_weights(
+    const csr_graph<WeightType>& g,
+    const std::vector<std::size_t>& community,
+    std::vector<WeightType>& in,
+    std::vector<WeightType>& internal,
+    std::size_t num_threads)
+{
+    std::size_t n = g.size();
+    boost::graph::detail::parallel_for_dynamic(n, parallel_grain, num_threads,
+        [&](std::size_t, std::size_t begin, std::size_t end) {
+            for (std::size_t v = begin; v < end; ++v) {
+                WeightType sum = g.self_loops[v];
+                for (std::size_t e = g.offsets[v]; e < g.offsets[v + 1]; ++e) {
+                    if (community[g.targets[e]] == community[v]) {
+                        sum += g.weights[e];
+                    }
+                }
+                internal[v] = sum;
+            }
+        });
+    std::fill(in.begin(), in.end(), WeightType(0));
+    for (std::size_t v = 0; v < n; ++v) {
+        in[community[v]] += internal[v];
+    }
+}
+
+/// @brief Parallel local moving phase on a csr_graph, for incremental quality functions.
+/// @param community Vertex to community label in [0, g.size())
+/// @note Each pass takes the vertices in a shuffled order, in batches. The moves of a
+///       batch are chosen in parallel against the communities as they were at the start
+///       of the batch, then applied in order, so the result does not depend on the number
+///       of threads. A vertex alone in its community does not join another lone vertex
+///       with a larger label, so that such pairs cannot swap forever (Lu, Halappanavar
+///       and Kalyanaraman, 2015). Moves chosen together can lower the quality; a pass
+///       that does not raise it is undone, and ends the phase. Each thread sums the
+///       weights to neighbouring communities in its own array of g.size() entries.
+template <typename QualityFunction, typename WeightType, typename URBG>
+WeightType parallel_local_optimization(
+    const csr_graph<WeightType>& g,
+    std::vector<std::size_t>& community,
+    URBG&& gen,
+    QualityFunction f,
+    WeightType min_improvement_inner,
+    std::size_t num_threads)
+{
+    using index_map = boost::typed_identity_property_map<std::size_t>;
+
+    std::size_t n = g.size();
+    std::vector<WeightType> k(n), in(n), tot(n, WeightType(0)), internal(n);
+    std::vector<std::size_t> size(n, 0);
+    boost::graph::detail::parallel_for_dynamic(n, parallel_grain, num_threads,
+        [&](std::size_t, std::size_t begin, std::size_t end) {
+            for (std::size_t v = begin; v < end; ++v) {
+                WeightType sum = g.self_loops[v];
+                for (std::size_t e = g.offsets[v]; e < g.offsets[v + 1]; ++e) {
+                    sum += g.weights[e];
+                }
+                k[v] = sum;
+            }
+        });
+    WeightType m(0);
+    for (std::size_t v = 0; v < n; ++v) {
+        m += k[v];
+        tot[community[v]] += k[v];
+        ++size[community[v]];
+    }
+    m /= WeightType(2);
+    community_internal_weights(g, community, in, internal, num_threads);
+
+    auto in_idx = make_iterator_property_map(in.begin(), index_map());
+    auto tot_idx = make_iterator_property_map(tot.begin(), index_map());
+    WeightType Q = f.quality(in_idx, tot_idx, m, n);
+    WeightType Q_new = Q;
+    std::size_t num_moves = 0;
+
+    std::vector<std::size_t> vertex_order(n);
+    std::iota(vertex_order.begin(), vertex_order.end(), std::size_t(0));
+    std::shuffle(vertex_order.begin(), vertex_order.end(), gen);
+
+    const std::size_t batch_size = (std::max)((n + 15) / 16, std::size_t(1));
+    std::vector<std::size_t> best(batch_size);
+    std::vector<WeightType> k_in_old(batch_size), k_in_best(batch_size);
+    // Per-thread neighbour buffers, allocated by the thread that uses them
+    std::vector<std::vector<WeightType>> neigh_weight(boost::graph::detail::resolve_num_threads(num_threads));
+    std::vector<std::vector<std::size_t>> neigh_comms(neigh_weight.size());
+
+    std::vector<std::size_t> saved_community, saved_size;
+    std::vector<WeightType> saved_tot;
+
+    do
+    {
+        Q = Q_new;
+        num_moves = 0;
+        saved_community = community;
+        saved_size = size;
+        saved_tot = tot;
+
+        for (std::size_t start = 0; start < n; start += batch_size) {
+            std::size_t len = (std::min)(batch_size, n - start);
+
+            boost::graph::detail::parallel_for_dynamic(len, std::size_t(256), num_threads,
+                [&](std::size_t t, std::size_t begin, std::size_t end) {
+                    QualityFunction local_f = f;
+                    std::vector<WeightType>& weight_to = neigh_weight[t];
+                    std::vector<std::size_t>& neigh_comm = neigh_comms[t];
+                    if (weight_to.size() != n) {
+                        weight_to.assign(n, WeightType(0));
+                    }
+                    for (std::size_t i = begin; i < end; ++i) {
+                        std::size_t v = vertex_order[start + i];
+                        std::size_t c_old = community[v];
+                        WeightType k_v = k[v];
+
+                        // Weight from v to each neighbouring community, in order of first appearance
+                        for (std::size_t e = g.offsets[v]; e < g.offsets[v + 1]; ++e) {
+                            std::size_t c = community[g.targets[e]];
+                            if (weight_to[c] == WeightType(0)) {
+                                neigh_comm.push_back(c);
+                            }
+                            weight_to[c] += g.weights[e];
+                        }
+
+                        tot_without_vertex<decltype(tot_idx), WeightType> tot_v{tot_idx, c_old, k_v};
+                        WeightType v_in_old = weight_to[c_old];
+
+                        // Staying wins ties
+                        std::size_t c_best = c_old;
+                        WeightType best_gain(0);
+                        WeightType v_in_best = v_in_old;
+                        if (v_in_old != WeightType(0)) {
+                            best_gain = (std::max)(best_gain, local_f.gain(tot_v, m, c_old, v_in_old, k_v));
+                        }
+                        for (std::size_t c : neigh_comm) {
+                            if (c == c_old) {
+                                continue;
+                            }
+                            WeightType gain = local_f.gain(tot_v, m, c, weight_to[c], k_v);
+                            if (gain > best_gain) {
+                                best_gain = gain;
+                                c_best = c;
+                                v_in_best = weight_to[c];
+                            }
+                        }
+                        if (c_best != c_old && size[c_old] == 1 && size[c_best] == 1 && c_best > c_old) {
+                            c_best = c_old;
+                            v_in_best = v_in_old;
+                        }
+
+                        best[i] = c_best;
+                        k_in_old[i] = v_in_old;
+                        k_in_best[i] = v_in_best;
+
+                        for (std::size_t c : neigh_comm) {
+                            weight_to[c] = WeightType(0);
+                        }
+                        neigh_comm.clear();
+                    }
+                });
+
+            for (std::size_t i = 0; i < len; ++i) {
+                std::size_t v = vertex_order[start + i];
+                std::size_t c_old = community[v];
+                if (best[i] == c_old) {
+                    continue;
+                }
+                f.remove(in_idx, tot_idx, c_old, k[v], k_in_old[i], g.self_loops[v]);
+                f.insert(in_idx, tot_idx, best[i], k[v], k_in_best[i], g.self_loops[v]);
+                community[v] = best[i];
+                --size[c_old];
+                ++size[best[i]];
+                num_moves++;
+            }
+        }
+
+        // The in values of simultaneous moves are approximate; recompute them
+        community_internal_weights(g, community, in, internal, num_threads);
+        Q_new = f.quality(in_idx, tot_idx, m, n);
+
+        if (num_moves > 0 && Q_new <= Q) {
+            community.swap(saved_community);
+            size.swap(saved_size);
+            tot.swap(saved_tot);
+            community_internal_weights(g, community, in, internal, num_threads);
+            Q_new = Q;
+            break;
+        }
+
+    } while (num_moves > 0 && (Q_new - Q) > min_improvement_inner);
+
+    return Q_new;
+}
+
 } // namespace louvain_detail
 
 /// @brief Find the best partition of the vertices of a graph conditionally to a quality function like modularity.
@@ -599,6 +992,103 @@ louvain_clustering(
     return Q;
 }
 
+
+/// @brief Parallel version of louvain_clustering for incremental quality functions.
+/// @note The graph is copied into a compressed sparse row form; the local moving phase
+///       and the aggregation of each level run on num_threads threads (0 uses one per
+///       hardware thread). For a given generator state, the partition does not depend
+///       on the number of threads.
+/// @return the quality of the partition found.
+template <typename QualityFunction = newman_and_girvan, typename Graph, typename ComponentMap, typename WeightMap, typename URBG>
+typename property_traits<WeightMap>::value_type
+parallel_louvain_clustering(
+    const Graph& g0,
+    ComponentMap components,
+    const WeightMap& w0,
+    URBG&& gen,
+    QualityFunction f = QualityFunction{},
+    typename property_traits<WeightMap>::value_type min_improvement_inner = typename property_traits<WeightMap>::value_type(0.0),
+    typename property_traits<WeightMap>::value_type min_improvement_outer = typename property_traits<WeightMap>::value_type(0.0),
+    std::size_t num_threads = 0
+){
+    // Graph concept checks
+    BOOST_CONCEPT_ASSERT((VertexListGraphConcept<Graph>));
+    BOOST_CONCEPT_ASSERT((IncidenceGraphConcept<Graph>));
+    BOOST_CONCEPT_ASSERT((GraphPartitionQualityFunctionConcept<QualityFunction, Graph, ComponentMap, WeightMap>));
+    BOOST_CONCEPT_ASSERT((ReadWritePropertyMapConcept<ComponentMap, typename graph_traits<Graph>::vertex_descriptor>));
+    BOOST_CONCEPT_ASSERT((ReadablePropertyMapConcept<WeightMap, typename graph_traits<Graph>::edge_descriptor>));
+
+    static_assert(
+        std::is_convertible<typename graph_traits<Graph>::directed_category, undirected_tag>::value,
+        "louvain_clustering requires an undirected graph"
+    );
+    static_assert(
+        louvain_detail::is_incremental_quality_function<QualityFunction, Graph, ComponentMap, WeightMap>::value,
+        "parallel_louvain_clustering requires an incremental quality function"
+    );
+
+    using weight_type = typename property_traits<WeightMap>::value_type;
+    using vertex_iterator = typename graph_traits<Graph>::vertex_iterator;
+
+    auto idx = get(vertex_index, g0);
+    std::size_t n = num_vertices(g0);
+
+    louvain_detail::csr_graph<weight_type> g = louvain_detail::to_csr(g0, w0, idx, num_threads);
+    std::vector<std::size_t> community(n);
+    std::iota(community.begin(), community.end(), std::size_t(0));
+    weight_type Q = louvain_detail::parallel_local_optimization(g, community, gen, f, min_improvement_inner, num_threads);
+
+    // Original vertex index to its vertex in the current level
+    std::vector<std::size_t> vertex_in_level(n);
+    std::iota(vertex_in_level.begin(), vertex_in_level.end(), std::size_t(0));
+
+    louvain_detail::csr_graph<weight_type> coarse = louvain_detail::parallel_aggregate(g, community, num_threads);
+    std::size_t prev_n_vertices = n;
+    while (true) {
+        // Check convergence: graph didn't get smaller (no communities merged)
+        std::size_t n_communities = coarse.size();
+        if (n_communities >= prev_n_vertices || n_communities == 1) {
+            break;
+        }
+
+        boost::graph::detail::parallel_for_blocks(n, num_threads,
+            [&](std::size_t, std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    vertex_in_level[i] = community[vertex_in_level[i]];
+                }
+            });
+        g = std::move(coarse);
+        community.resize(n_communities);
+        std::iota(community.begin(), community.end(), std::size_t(0));
+
+        weight_type Q_old = Q;
+        Q = louvain_detail::parallel_local_optimization(g, community, gen, f, min_improvement_inner, num_threads);
+
+        // Stop if quality did not improve
+        if (Q - Q_old <= min_improvement_outer) {
+            break;
+        }
+
+        prev_n_vertices = n_communities;
+        coarse = louvain_detail::parallel_aggregate(g, community, num_threads);
+    }
+
+    // Label the communities 0, 1, ... in order of first appearance
+    const std::size_t none = (std::numeric_limits<std::size_t>::max)();
+    std::vector<std::size_t> comm_label(community.size(), none);
+    std::size_t next_label = 0;
+    vertex_iterator vi, vi_end;
+    for (boost::tie(vi, vi_end) = vertices(g0); vi != vi_end; ++vi) {
+        std::size_t& label = comm_label[community[vertex_in_level[get(idx, *vi)]]];
+        if (label == none) {
+            label = next_label++;
+        }
+        put(components, *vi, label);
+    }
+
+    return Q;
+}
+
 } // namespace boost
 
 #endif
@@ -0,0 +1,207 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Selection of the narrowest vertex and edge index types that can hold a
+// given compressed_sparse_row_graph, and construction of a CSR graph using
+// them.
+
+#ifndef BOOST_GRAPH_NARROWEST_CSR_GRAPH_HPP
+#define BOOST_GRAPH_NARROWEST_CSR_GRAPH_HPP
+
+#include <boost/cstdint.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/exception.hpp>
+#include <boost/throw_exception.hpp>
+#include <iterator>
+#include <limits>
+
+namespace boost
+{
+
+// Index type combinations tried by visit_narrowest_csr_graph, from the
+// narrowest to the widest.
+enum csr_index_width
+{
+    csr_index_32_32, // uint32_t vertices and uint32_t edge indices
+    csr_index_32_64, // uint32_t vertices and uint64_t edge indices
+    csr_index_64_64 // uint64_t vertices and uint64_t edge indices
+};
+
+// True if a compressed_sparse_row_graph with the given Vertex and EdgeIndex
+// types can hold numverts vertices and numedges edges.  The largest Vertex
+// value is reserved for null_vertex().
+template < typename Vertex, typename EdgeIndex >
+bool csr_index_types_fit(boost::uintmax_t numverts, boost::uintmax_t numedges)
+{
+    return numverts < boost::uintmax_t((std::numeric_limits< Vertex >::max)())
+        && numedges
+        <= boost::uintmax_t((std::numeric_limits< EdgeIndex >::max)());
+}
+
+// The narrowest csr_index_width whose types fit numverts and numedges
+inline csr_index_width narrowest_csr_index_width(
+    boost::uintmax_t numverts, boost::uintmax_t numedges)
+{
+    if (csr_index_types_fit< boost::uint32_t, boost::uint32_t >(
+            numverts, numedges))
+        return csr_index_32_32;
+    if (csr_index_types_fit< boost::uint32_t, boost::uint64_t >(
+            numverts, numedges))
+        return csr_index_32_64;
+    if (!csr_index_types_fit< boost::uint64_t, boost::uint64_t >(
+            numverts, numedges))
+        BOOST_THROW_EXCEPTION(
+            bad_graph("graph too large for 64-bit CSR indices"));
+    return csr_index_64_64;
+}
+
+// The compressed_sparse_row_graph type for one csr_index_width
+template < csr_index_width Width, typename Directed = directedS,
+    typename VertexProperty = no_property,
+    typename EdgeProperty = no_property,
+    typename GraphProperty = no_property >
+struct csr_graph_with_index_width;
+
+template < typename Directed, typename VertexProperty, typename EdgeProperty,
+    typename GraphProperty >
+struct csr_graph_with_index_width< csr_index_32_32, Directed, VertexProperty,
+    EdgeProperty, GraphProperty >
+{
+    typedef compressed_sparse_row_graph< Directed, VertexProperty,
+        EdgeProperty, GraphProperty, boost::uint32_t, boost::uint32_t >
+        type;
+};
+
+template < typename Directed, typename VertexProperty, typename EdgeProperty,
+    typename GraphProperty >
+struct csr_graph_with_index_width< csr_index_32_64, Directed, VertexProperty,
+    EdgeProperty, GraphProperty >
+{
+    typedef compressed_sparse_row_graph< Directed, VertexProperty,
+        EdgeProperty, GraphProperty, boost::uint32_t, boost::uint64_t >
+        type;
+};
+
+template < typename Directed, typename VertexProperty, typename EdgeProperty,
+    typename GraphProperty >
+struct csr_graph_with_index_width< csr_index_64_64, Directed, VertexProperty,
+    EdgeProperty, GraphProperty >
+{
+    typedef compressed_sparse_row_graph< Directed, VertexProperty,
+        EdgeProperty, GraphProperty, boost::uint64_t, boost::uint64_t >
+        type;
+};
+
+namespace detail
+{
+    template < csr_index_width Width, typename Directed,
+        typename VertexProperty, typename EdgeProperty,
+        typename MultiPassInputIterator, typename Visitor >
+    void visit_csr_with_index_width(MultiPassInputIterator edge_begin,
+        MultiPassInputIterator edge_end, boost::uintmax_t numverts,
+        Visitor& vis)
+    {
+        typedef typename csr_graph_with_index_width< Width, Directed,
+            VertexProperty, EdgeProperty >::type Graph;
+        typedef typename Graph::vertices_size_type vertices_size_type;
+        const Graph g(edges_are_unsorted_multi_pass, edge_begin, edge_end,
+            vertices_size_type(numverts));
+        vis(g);
+    }
+
+    template < csr_index_width Width, typename Directed,
+        typename VertexProperty, typename EdgeProperty,
+        typename MultiPassInputIterator, typename EdgePropertyIterator,
+        typename Visitor >
+    void visit_csr_with_index_width(MultiPassInputIterator edge_begin,
+        MultiPassInputIterator edge_end, EdgePropertyIterator ep_iter,
+        boost::uintmax_t numverts, Visitor& vis)
+    {
+        typedef typename csr_graph_with_index_width< Width, Directed,
+            VertexProperty, EdgeProperty >::type Graph;
+        typedef typename Graph::vertices_size_type vertices_size_type;
+        const Graph g(edges_are_unsorted_multi_pass, edge_begin, edge_end,
+            ep_iter, vertices_size_type(numverts));
+        vis(g);
+    }
+} // namespace detail
+
+// Builds a compressed_sparse_row_graph from an unsorted edge list using the
+// narrowest index types that fit it, and passes it to vis(g).  Since the
+// graph type depends on the input, vis must accept every
+// csr_graph_with_index_width<...>::type (a generic lambda or a function
+// object with a templated operator()).  Returns the width that was used.
+template < typename Directed, typename VertexProperty, typename EdgeProperty,
+    typename MultiPassInputIterator, typename Visitor >
+csr_index_width visit_narrowest_csr_graph(edges_are_unsorted_multi_pass_t,
+    MultiPassInputIterator edge_begin, MultiPassInputIterator edge_end,
+    boost::uintmax_t numverts, Visitor vis)
+{
+    csr_index_width width = narrowest_csr_index_width(
+        numverts, boost::uintmax_t(std::distance(edge_begin, edge_end)));
+    switch (width)
+    {
+    case csr_index_32_32:
+        detail::visit_csr_with_index_width< csr_index_32_32, Directed,
+            VertexProperty, EdgeProperty >(edge_begin, edge_end, numverts, vis);
+        break;
+    case csr_index_32_64:
+        detail::visit_csr_with_index_width< csr_index_32_64, Directed,
+            VertexProperty, EdgeProperty >(edge_begin, edge_end, numverts, vis);
+        break;
+    default:
+        detail::visit_csr_with_index_width< csr_index_64_64, Directed,
+            VertexProperty, EdgeProperty >(edge_begin, edge_end, numverts, vis);
+        break;
+    }
+    return width;
+}
+
+template < typename MultiPassInputIterator, typename Visitor >
+csr_index_width visit_narrowest_csr_graph(edges_are_unsorted_multi_pass_t tag,
+    MultiPassInputIterator edge_begin, MultiPassInputIterator edge_end,
+    boost::uintmax_t numverts, Visitor vis)
+{
+    return visit_narrowest_csr_graph< directedS, no_property, no_property >(
+        tag, edge_begin, edge_end, numverts, vis);
+}
+
+// Same as above, also initializing edge properties from ep_iter
+template < typename Directed, typename VertexProperty, typename EdgeProperty,
+    typename MultiPassInputIterator, typename EdgePropertyIterator,
+    typename Visitor >
+csr_index_width visit_narrowest_csr_graph(edges_are_unsorted_multi_pass_t,
+    MultiPassInputIterator edge_begin, MultiPassInputIterator edge_end,
+    EdgePropertyIterator ep_iter, boost::uintmax_t numverts, Visitor vis)
+{
+    csr_index_width width = narrowest_csr_index_width(
+        numverts, boost::uintmax_t(std::distance(edge_begin, edge_end)));
+    switch (width)
+    {
+    case csr_index_32_32:
+        detail::visit_csr_with_index_width< csr_index_32_32, Directed,
+            VertexProperty, EdgeProperty >(
+            edge_begin, edge_end, ep_iter, numverts, vis);
+        break;
+    case csr_index_32_64:
+        detail::visit_csr_with_index_width< csr_index_32_64, Directed,
+            VertexProperty, EdgeProperty >(
+            edge_begin, edge_end, ep_iter, numverts, vis);
+        break;
+    default:
+        detail::visit_csr_with_index_width< csr_index_64_64, Directed,
+            VertexProperty, EdgeProperty >(
+            edge_begin, edge_end, ep_iter, numverts, vis);
+        break;
+    }
+    return width;
+}
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_NARROWEST_CSR_GRAPH_HPP
@@ -17,6 +17,12 @@
 #include <boost/graph/iteration_macros.hpp>
 #include <boost/graph/overloading.hpp>
 #include <boost/graph/detail/mpi_include.hpp>
+#include <boost/graph/detail/parallel_for.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
 #include <vector>
 
 namespace boost
@@ -38,6 +44,27 @@ namespace graph
         std::size_t n;
     };
 
+    // Stops parallel_page_rank once the ranks changed by at most tolerance
+    // in L1 norm during the last iteration, or after max_iterations
+    // iterations.
+    struct l1_residual
+    {
+        explicit l1_residual(
+            double tolerance, std::size_t max_iterations = 1000)
+        : tolerance(tolerance), max_iterations(max_iterations)
+        {
+        }
+
+        bool operator()(double residual, std::size_t iterations) const
+        {
+            return residual <= tolerance || iterations >= max_iterations;
+        }
+
+    private:
+        double tolerance;
+        std::size_t max_iterations;
+    };
+
     namespace detail
     {
         template < typename Graph, typename RankMap, typename RankMap2 >
@@ -142,6 +169,256 @@ namespace graph
         page_rank(g, rank_map, n_iterations(20));
     }
 
+    namespace detail
+    {
+        // Sums a value over the in-neighbours of a vertex, both given by
+        // vertex index.  Bidirectional graphs are read through in_edges.
+        template < typename Graph, typename VertexIndexMap,
+            bool Bidirectional = is_convertible<
+                typename graph_traits< Graph >::traversal_category,
+                bidirectional_graph_tag >::value >
+        class page_rank_in_neighbors
+        {
+            typedef typename graph_traits< Graph >::vertex_descriptor vertex;
+
+        public:
+            page_rank_in_neighbors(const Graph& g, VertexIndexMap index,
+                const std::vector< vertex >& by_index)
+            : g(g), index(index), by_index(by_index)
+            {
+            }
+
+            template < typename T > T sum(std::size_t v, const T* x) const
+            {
+                T s(0);
+                BGL_FORALL_INEDGES_T(by_index[v], e, g, Graph)
+                s += x[get(index, source(e, g))];
+                return s;
+            }
+
+        private:
+            const Graph& g;
+            VertexIndexMap index;
+            const std::vector< vertex >& by_index;
+        };
+
+        // Other graphs only list out-edges, so their transpose is built
+        // first.
+        template < typename Graph, typename VertexIndexMap >
+        class page_rank_in_neighbors< Graph, VertexIndexMap, false >
+        {
+            typedef typename graph_traits< Graph >::vertex_descriptor vertex;
+            typedef typename graph_traits< Graph >::vertices_size_type
+                vertices_size_type;
+            typedef typename graph_traits< Graph >::edges_size_type
+                edges_size_type;
+
+        public:
+            page_rank_in_neighbors(const Graph& g, VertexIndexMap index,
+                const std::vector< vertex >& by_index)
+            : offsets(by_index.size() + 1, 0)
+            {
+                BGL_FORALL_VERTICES_T(u, g, Graph)
+                BGL_FORALL_ADJ_T(u, v, g, Graph)
+                ++offsets[get(index, v) + 1];
+                for (std::size_t v = 0; v < by_index.size(); ++v)
+                    offsets[v + 1] += offsets[v];
+                sources.resize(offsets.back());
+                std::vector< edges_size_type > next(
+                    offsets.begin(), offsets.end() - 1);
+                for (std::size_t u = 0; u < by_index.size(); ++u)
+                    BGL_FORALL_ADJ_T(by_index[u], v, g, Graph)
+                    sources[next[get(index, v)]++] = vertices_size_type(u);
+            }
+
+            template < typename T > T sum(std::size_t v, const T* x) const
+            {
+                T s(0);
+                for (edges_size_type i = offsets[v]; i < offsets[v + 1]; ++i)
+                    s += x[sources[i]];
+                return s;
+            }
+
+        private:
+            std::vector< edges_size_type > offsets;
+            std::vector< vertices_size_type > sources;
+        };
+
+        // Power iteration pulling over in-edges, on arrays indexed by
+        // vertex index.  teleport holds the personalization vector, summing
+        // to 1, or is empty for the uniform one.  The ranks sum to 1, and
+        // the rank of dangling vertices is redistributed like a random
+        // jump.  The vertices are processed in chunks of a fixed size whose
+        // partial sums are added in chunk order, so the result does not
+        // depend on the number of threads.
+        template < typename Graph, typename RankMap, typename Done,
+            typename VertexIndexMap >
+        std::size_t parallel_page_rank_impl(const Graph& g, RankMap rank_map,
+            const std::vector<
+                typename property_traits< RankMap >::value_type >& teleport,
+            Done done, typename property_traits< RankMap >::value_type damping,
+            VertexIndexMap index, std::size_t num_threads)
+        {
+            typedef typename property_traits< RankMap >::value_type rank_type;
+            typedef typename graph_traits< Graph >::vertex_descriptor vertex;
+
+            const std::size_t n = num_vertices(g);
+            if (n == 0)
+                return 0;
+
+            std::vector< vertex > by_index(n);
+            std::vector< rank_type > inv_out_degree(n);
+            BGL_FORALL_VERTICES_T(v, g, Graph)
+            {
+                const std::size_t i = get(index, v);
+                const std::size_t d = out_degree(v, g);
+                by_index[i] = v;
+                inv_out_degree[i] = d == 0 ? rank_type(0) : rank_type(1) / d;
+            }
+            const page_rank_in_neighbors< Graph, VertexIndexMap > in(
+                g, index, by_index);
+
+            // rank[b][v] and contribution[b][v] = rank[b][v] / out_degree,
+            // in two buffers
+            const rank_type uniform = rank_type(1) / n;
+            const rank_type* p = teleport.empty() ? 0 : &teleport[0];
+            std::vector< rank_type > rank[2], contribution[2];
+            for (int b = 0; b < 2; ++b)
+            {
+                rank[b].resize(n);
+                contribution[b].resize(n);
+            }
+            rank_type dangling(0);
+            for (std::size_t v = 0; v < n; ++v)
+            {
+                rank[0][v] = p ? p[v] : uniform;
+                contribution[0][v] = rank[0][v] * inv_out_degree[v];
+                if (inv_out_degree[v] == 0)
+                    dangling += rank[0][v];
+            }
+
+            const std::size_t grain = 4096;
+            std::vector< rank_type > chunk_residual((n + grain - 1) / grain),
+                chunk_dangling(chunk_residual.size());
+            double residual = std::numeric_limits< double >::infinity();
+            std::size_t iterations = 0;
+            int from = 0;
+            while (!done(residual, iterations))
+            {
+                const rank_type* old_rank = &rank[from][0];
+                const rank_type* old_contribution = &contribution[from][0];
+                rank_type* new_rank = &rank[1 - from][0];
+                rank_type* new_contribution = &contribution[1 - from][0];
+                const rank_type jump = (1 - damping) + damping * dangling;
+                parallel_for_dynamic(n, grain, num_threads,
+                    [&](std::size_t, std::size_t begin, std::size_t end) {
+                        rank_type chunk_res(0), chunk_dang(0);
+                        for (std::size_t v = begin; v < end; ++v)
+                        {
+                            const rank_type r = jump * (p ? p[v] : uniform)
+                                + damping * in.sum(v, old_contribution);
+                            new_rank[v] = r;
+                            new_contribution[v] = r * inv_out_degree[v];
+                            if (inv_out_degree[v] == 0)
+                                chunk_dang += r;
+                            chunk_res += std::abs(r - old_rank[v]);
+                        }
+                        chunk_residual[begin / grain] = chunk_res;
+                        chunk_dangling[begin / grain] = chunk_dang;
+                    });
+                rank_type total_residual(0);
+                dangling = 0;
+                for (std::size_t c = 0; c < chunk_residual.size(); ++c)
+                {
+                    total_residual += chunk_residual[c];
+                    dangling += chunk_dangling[c];
+                }
+                residual = total_residual;
+                from = 1 - from;
+                ++iterations;
+            }
+
+            BGL_FORALL_VERTICES_T(v, g, Graph)
+            put(rank_map, v, rank[from][get(index, v)]);
+            return iterations;
+        }
+    } // end namespace detail
+
+    template < typename Graph, typename RankMap, typename Done,
+        typename VertexIndexMap >
+    std::size_t parallel_page_rank(const Graph& g, RankMap rank_map,
+        Done done, typename property_traits< RankMap >::value_type damping,
+        VertexIndexMap index, std::size_t num_threads)
+    {
+        return detail::parallel_page_rank_impl(g, rank_map,
+            std::vector< typename property_traits< RankMap >::value_type >(),
+            done, damping, index, num_threads);
+    }
+
+    template < typename Graph, typename RankMap, typename Done >
+    inline std::size_t parallel_page_rank(const Graph& g, RankMap rank_map,
+        Done done,
+        typename property_traits< RankMap >::value_type damping = 0.85,
+        std::size_t num_threads = 0)
+    {
+        return parallel_page_rank(
+            g, rank_map, done, damping, get(vertex_index, g), num_threads);
+    }
+
+    template < typename Graph, typename RankMap >
+    inline std::size_t parallel_page_rank(const Graph& g, RankMap rank_map)
+    {
+        return parallel_page_rank(g, rank_map, l1_residual(1e-6));
+    }
+
+    template < typename Graph, typename RankMap, typename PersonalizationMap,
+        typename Done, typename VertexIndexMap >
+    std::size_t parallel_personalized_page_rank(const Graph& g,
+        RankMap rank_map, PersonalizationMap personalization, Done done,
+        typename property_traits< RankMap >::value_type damping,
+        VertexIndexMap index, std::size_t num_threads)
+    {
+        typedef typename property_traits< RankMap >::value_type rank_type;
+
+        std::vector< rank_type > teleport(num_vertices(g));
+        rank_type total(0);
+        BGL_FORALL_VERTICES_T(v, g, Graph)
+        {
+            const rank_type x = get(personalization, v);
+            if (!(x >= 0))
+                throw std::invalid_argument(
+                    "personalization values must be non-negative.");
+            teleport[get(index, v)] = x;
+            total += x;
+        }
+        if (!teleport.empty() && !(total > 0))
+            throw std::invalid_argument(
+                "personalization values must not all be zero.");
+        for (std::size_t v = 0; v < teleport.size(); ++v)
+            teleport[v] /= total;
+        return detail::parallel_page_rank_impl(
+            g, rank_map, teleport, done, damping, index, num_threads);
+    }
+
+    template < typename Graph, typename RankMap, typename PersonalizationMap,
+        typename Done >
+    inline std::size_t parallel_personalized_page_rank(const Graph& g,
+        RankMap rank_map, PersonalizationMap personalization, Done done,
+        typename property_traits< RankMap >::value_type damping = 0.85,
+        std::size_t num_threads = 0)
+    {
+        return parallel_personalized_page_rank(g, rank_map, personalization,
+            done, damping, get(vertex_index, g), num_threads);
+    }
+
+    template < typename Graph, typename RankMap, typename PersonalizationMap >
+    inline std::size_t parallel_personalized_page_rank(
+        const Graph& g, RankMap rank_map, PersonalizationMap personalization)
+    {
+        return parallel_personalized_page_rank(
+            g, rank_map, personalization, l1_residual(1e-6));
+    }
+
     // TBD: this could be _much_ more efficient, using a queue to store
     // the vertices that should be reprocessed and keeping track of which
     // vertices are in the queue with a property map. Baah, this only
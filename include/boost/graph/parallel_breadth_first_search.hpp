@@ -0,0 +1,495 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Multi-threaded, direction-optimizing breadth-first search (Beamer,
+// Asanovic and Patterson, "Direction-Optimizing Breadth-First Search",
+// SC 2012).  Levels with a small frontier are expanded top-down from a
+// shared queue; once the frontier's out-edges outnumber a fraction of the
+// unexplored edges, every unvisited vertex instead looks for a parent in
+// the frontier bitmap, stopping at the first one found.
+
+#ifndef BOOST_GRAPH_PARALLEL_BREADTH_FIRST_SEARCH_HPP
+#define BOOST_GRAPH_PARALLEL_BREADTH_FIRST_SEARCH_HPP
+
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/graph/detail/parallel_for.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/named_function_params.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+#include <atomic>
+#endif
+
+namespace boost
+{
+
+namespace detail
+{
+    // Beamer's switching thresholds: go bottom-up once the frontier has
+    // more than 1/alpha of the unexplored edges, and back top-down once it
+    // holds fewer than 1/beta of the vertices and is shrinking
+    const std::size_t pbfs_alpha = 15;
+    const std::size_t pbfs_beta = 18;
+
+    // Vertices handed out at a time in bottom-up steps, a multiple of the
+    // bitmap word size, and the capacity of the local queue buffers
+    const std::size_t pbfs_grain = 1024;
+
+    // A bitmap with atomic bit updates
+    class pbfs_bitmap
+    {
+    public:
+        typedef boost::uint64_t word_type;
+        static const std::size_t word_bits = 64;
+
+        explicit pbfs_bitmap(std::size_t n)
+        : m_size((n + word_bits - 1) / word_bits), m_words(new word[m_size])
+        {
+            clear(0, m_size);
+        }
+        ~pbfs_bitmap() { delete[] m_words; }
+
+        std::size_t num_words() const { return m_size; }
+
+        // Clears the words [first, last)
+        void clear(std::size_t first, std::size_t last)
+        {
+            for (std::size_t w = first; w < last; ++w)
+                store(w, 0);
+        }
+
+        bool test(std::size_t i) const
+        {
+            return (load(i / word_bits) >> (i % word_bits)) & 1;
+        }
+
+        // Sets bit i and returns whether it was clear before
+        bool test_and_set(std::size_t i)
+        {
+            word_type mask = word_type(1) << (i % word_bits);
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+            return !(m_words[i / word_bits].fetch_or(
+                         mask, std::memory_order_relaxed)
+                & mask);
+#else
+            word_type old = m_words[i / word_bits];
+            m_words[i / word_bits] = old | mask;
+            return !(old & mask);
+#endif
+        }
+
+        // Word access for the thread that owns the word
+        word_type load(std::size_t w) const
+        {
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+            return m_words[w].load(std::memory_order_relaxed);
+#else
+            return m_words[w];
+#endif
+        }
+        void store(std::size_t w, word_type x)
+        {
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+            m_words[w].store(x, std::memory_order_relaxed);
+#else
+            m_words[w] = x;
+#endif
+        }
+
+        void swap(pbfs_bitmap& x)
+        {
+            std::swap(m_size, x.m_size);
+            std::swap(m_words, x.m_words);
+        }
+
+    private:
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+        typedef std::atomic< word_type > word;
+#else
+        typedef word_type word;
+#endif
+        pbfs_bitmap(const pbfs_bitmap&);
+        pbfs_bitmap& operator=(const pbfs_bitmap&);
+
+        std::size_t m_size;
+        word* m_words;
+    };
+
+    // Index of the lowest set bit of x != 0
+    inline std::size_t pbfs_ctz(boost::uint64_t x)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return std::size_t(__builtin_ctzll(x));
+#else
+        std::size_t i = 0;
+        for (; !(x & 1); x >>= 1)
+            ++i;
+        return i;
+#endif
+    }
+
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+    typedef std::atomic< std::size_t > pbfs_counter;
+    inline std::size_t pbfs_fetch_add(pbfs_counter& c, std::size_t x)
+    {
+        return c.fetch_add(x, std::memory_order_relaxed);
+    }
+#else
+    typedef std::size_t pbfs_counter;
+    inline std::size_t pbfs_fetch_add(pbfs_counter& c, std::size_t x)
+    {
+        std::size_t old = c;
+        c += x;
+        return old;
+    }
+#endif
+
+    // How a vertex finds candidate parents in bottom-up steps: through its
+    // in-edges on bidirectional graphs and its out-edges on undirected
+    // ones.  Directed graphs without in-edges are searched top-down only.
+    template < typename Graph > struct pbfs_parent_access
+    {
+        typedef typename graph_traits< Graph >::traversal_category traversal;
+        typedef std::integral_constant< int,
+            is_undirected_graph< Graph >::value
+                ? 2
+                : (std::is_convertible< traversal,
+                       bidirectional_graph_tag >::value
+                        ? 1
+                        : 0) >
+            type;
+    };
+
+    // Calls f(u) for the candidate parents u of v until f returns true
+    template < typename Graph, typename Vertex, typename Function >
+    bool pbfs_find_parent(const Graph& g, Vertex v, Function f,
+        std::integral_constant< int, 2 >)
+    {
+        typename graph_traits< Graph >::out_edge_iterator ei, ei_end;
+        for (boost::tie(ei, ei_end) = out_edges(v, g); ei != ei_end; ++ei)
+            if (f(target(*ei, g)))
+                return true;
+        return false;
+    }
+
+    template < typename Graph, typename Vertex, typename Function >
+    bool pbfs_find_parent(const Graph& g, Vertex v, Function f,
+        std::integral_constant< int, 1 >)
+    {
+        typename graph_traits< Graph >::in_edge_iterator ei, ei_end;
+        for (boost::tie(ei, ei_end) = in_edges(v, g); ei != ei_end; ++ei)
+            if (f(source(*ei, g)))
+                return true;
+        return false;
+    }
+
+    template < typename Graph, typename Vertex, typename Function >
+    bool pbfs_find_parent(
+        const Graph&, Vertex, Function, std::integral_constant< int, 0 >)
+    {
+        return false;
+    }
+
+    template < typename Graph, typename DistanceMap, typename PredecessorMap,
+        typename VertexIndexMap >
+    void parallel_bfs_impl(const Graph& g,
+        typename graph_traits< Graph >::vertex_descriptor s,
+        DistanceMap distance, PredecessorMap predecessor,
+        VertexIndexMap index, std::size_t num_threads)
+    {
+        typedef typename graph_traits< Graph >::vertex_descriptor Vertex;
+        typedef typename property_traits< DistanceMap >::value_type Distance;
+        typedef typename pbfs_parent_access< Graph >::type access;
+        using boost::graph::detail::parallel_for_blocks;
+
+        const std::size_t n = num_vertices(g);
+        num_threads = boost::graph::detail::resolve_num_threads(num_threads);
+
+        std::vector< Vertex > vertex_of(n);
+        {
+            typename graph_traits< Graph >::vertex_iterator vi, vi_end;
+            for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+                vertex_of[get(index, *vi)] = *vi;
+        }
+        parallel_for_blocks(n, num_threads,
+            [&](std::size_t, std::size_t first, std::size_t last) {
+                for (std::size_t v = first; v < last; ++v)
+                {
+                    put(distance, vertex_of[v],
+                        (std::numeric_limits< Distance >::max)());
+                    put(predecessor, vertex_of[v], vertex_of[v]);
+                }
+            });
+
+        pbfs_bitmap visited(n), front(n), next(n);
+        // Every level is appended to the queue after the previous one
+        std::vector< std::size_t > queue(n);
+        const std::size_t src = get(index, s);
+        queue[0] = src;
+        visited.test_and_set(src);
+        put(distance, s, Distance(0));
+
+        std::size_t edges_to_check = 0;
+        {
+            typename graph_traits< Graph >::vertex_iterator vi, vi_end;
+            for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+                edges_to_check += out_degree(*vi, g);
+        }
+
+        // Shared state, written only by worker 0 between barriers.  The
+        // frontier is queue[head, tail) after top-down levels and the
+        // front bitmap after bottom-up levels.
+        enum conversion
+        {
+            keep,
+            to_bitmap,
+            to_queue
+        };
+        std::size_t head = 0, tail = 1, frontier_size = 1;
+        bool bottom_up = false, done = false;
+        conversion convert = keep;
+        Distance level = 0;
+        pbfs_counter next_chunk(0), queue_tail(1), found_edges(0),
+            found_vertices(0);
+        const std::size_t bitmap_chunks = (n + pbfs_grain - 1) / pbfs_grain;
+        const std::size_t top_down_grain = 64;
+
+        typedef boost::graph::detail::thread_barrier barrier_type;
+        boost::graph::detail::run_with_barrier(num_threads, [&](std::size_t t,
+                                                  barrier_type& barrier) {
+            using boost::graph::detail::block_begin;
+            const std::size_t num_threads = barrier.num_threads();
+            // Discovered vertices are collected locally and appended to
+            // the queue a block at a time
+            std::vector< std::size_t > local;
+            local.reserve(pbfs_grain);
+            auto flush = [&]() {
+                std::size_t pos = pbfs_fetch_add(queue_tail, local.size());
+                std::copy(local.begin(), local.end(), queue.begin() + pos);
+                local.clear();
+            };
+
+            for (;;)
+            {
+                const Distance next_level = Distance(level + 1);
+                std::size_t my_edges = 0, my_vertices = 0;
+                if (!bottom_up)
+                {
+                    // Top-down: claim the unvisited out-neighbors of the
+                    // frontier
+                    for (;;)
+                    {
+                        std::size_t first = head
+                            + pbfs_fetch_add(next_chunk, top_down_grain);
+                        if (first >= tail)
+                            break;
+                        std::size_t last
+                            = (std::min)(tail, first + top_down_grain);
+                        for (std::size_t i = first; i < last; ++i)
+                        {
+                            Vertex u = vertex_of[queue[i]];
+                            typename graph_traits< Graph >::out_edge_iterator
+                                ei, ei_end;
+                            for (boost::tie(ei, ei_end) = out_edges(u, g);
+                                 ei != ei_end; ++ei)
+                            {
+                                Vertex v = target(*ei, g);
+                                std::size_t vi = get(index, v);
+                                if (visited.test(vi)
+                                    || !visited.test_and_set(vi))
+                                    continue;
+                                put(distance, v, next_level);
+                                put(predecessor, v, u);
+                                my_edges += out_degree(v, g);
+                                ++my_vertices;
+                                if (local.size() == pbfs_grain)
+                                    flush();
+                                local.push_back(vi);
+                            }
+                        }
+                    }
+                    flush();
+                }
+                else
+                {
+                    // Bottom-up: every unvisited vertex looks for a parent
+                    // in the frontier.  Chunks consist of whole words, so
+                    // the owner can store them without atomic updates.
+                    for (;;)
+                    {
+                        std::size_t chunk = pbfs_fetch_add(next_chunk, 1);
+                        if (chunk >= bitmap_chunks)
+                            break;
+                        std::size_t first = chunk * pbfs_grain;
+                        std::size_t last = (std::min)(n, first + pbfs_grain);
+                        typedef pbfs_bitmap::word_type word_type;
+                        const std::size_t bits = pbfs_bitmap::word_bits;
+                        for (std::size_t w = first / bits; w * bits < last;
+                             ++w)
+                        {
+                            word_type seen = visited.load(w);
+                            word_type found = 0;
+                            // Unvisited vertices of the word; bits past
+                            // the last vertex count as visited
+                            word_type todo = ~seen;
+                            if (last - w * bits < bits)
+                                todo &= (word_type(1) << (last - w * bits)) - 1;
+                            for (; todo; todo &= todo - 1)
+                            {
+                                std::size_t bit = pbfs_ctz(todo);
+                                Vertex v = vertex_of[w * bits + bit];
+                                if (!pbfs_find_parent(g, v,
+                                        [&](Vertex u) {
+                                            if (!front.test(get(index, u)))
+                                                return false;
+                                            put(predecessor, v, u);
+                                            return true;
+                                        },
+                                        access()))
+                                    continue;
+                                put(distance, v, next_level);
+                                found |= word_type(1) << bit;
+                                my_edges += out_degree(v, g);
+                                ++my_vertices;
+                            }
+                            visited.store(w, seen | found);
+                            next.store(w, found);
+                        }
+                    }
+                }
+                pbfs_fetch_add(found_edges, my_edges);
+                pbfs_fetch_add(found_vertices, my_vertices);
+                barrier.wait();
+
+                if (t == 0)
+                {
+                    // Choose the direction of the next level
+                    const std::size_t new_edges = found_edges;
+                    const std::size_t new_vertices = found_vertices;
+                    found_edges = 0;
+                    found_vertices = 0;
+                    next_chunk = 0;
+                    // As in Beamer's reference code, only top-down levels
+                    // count against the unexplored edges, which keeps
+                    // the search from turning bottom-up for the small
+                    // frontiers near the end
+                    if (!bottom_up)
+                        edges_to_check
+                            -= (std::min)(edges_to_check, new_edges);
+                    done = new_vertices == 0;
+                    level = next_level;
+                    convert = keep;
+                    if (!bottom_up)
+                    {
+                        head = tail;
+                        tail = queue_tail;
+                        if (access::value != 0
+                            && new_edges > edges_to_check / pbfs_alpha)
+                        {
+                            bottom_up = true;
+                            convert = to_bitmap;
+                        }
+                    }
+                    else if (new_vertices < n / pbfs_beta
+                        && new_vertices <= frontier_size)
+                    {
+                        bottom_up = false;
+                        convert = to_queue;
+                        head = queue_tail;
+                    }
+                    else
+                        front.swap(next);
+                    frontier_size = new_vertices;
+                }
+                barrier.wait();
+                if (done)
+                    break;
+
+                if (convert == to_bitmap)
+                {
+                    std::size_t words = front.num_words();
+                    front.clear(block_begin(words, num_threads, t),
+                        block_begin(words, num_threads, t + 1));
+                    barrier.wait();
+                    std::size_t size = tail - head;
+                    std::size_t last
+                        = head + block_begin(size, num_threads, t + 1);
+                    for (std::size_t i
+                         = head + block_begin(size, num_threads, t);
+                         i < last; ++i)
+                        front.test_and_set(queue[i]);
+                    barrier.wait();
+                }
+                else if (convert == to_queue)
+                {
+                    std::size_t words = next.num_words();
+                    std::size_t last = block_begin(words, num_threads, t + 1);
+                    for (std::size_t w = block_begin(words, num_threads, t);
+                         w < last; ++w)
+                        for (pbfs_bitmap::word_type x = next.load(w); x;
+                             x &= x - 1)
+                        {
+                            if (local.size() == pbfs_grain)
+                                flush();
+                            local.push_back(
+                                w * pbfs_bitmap::word_bits + pbfs_ctz(x));
+                        }
+                    flush();
+                    barrier.wait();
+                    if (t == 0)
+                        tail = queue_tail;
+                    barrier.wait();
+                }
+            }
+        });
+    }
+} // namespace detail
+
+// Sets the hop distance from s and a BFS-tree parent for every vertex
+// reached from s, using num_threads threads (0 for one per hardware
+// thread).  Unreached vertices get the largest distance value and
+// themselves as predecessor.  Both maps are written concurrently for
+// distinct vertices; the predecessor chosen among equally distant
+// parents may vary from run to run.
+template < typename Graph, typename DistanceMap, typename PredecessorMap,
+    typename VertexIndexMap >
+void parallel_breadth_first_search(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s, DistanceMap distance,
+    PredecessorMap predecessor, VertexIndexMap index,
+    std::size_t num_threads = 0)
+{
+    detail::parallel_bfs_impl(
+        g, s, distance, predecessor, index, num_threads);
+}
+
+// Named parameter version: distance_map, predecessor_map,
+// vertex_index_map and num_threads
+template < typename Graph, typename P, typename T, typename R >
+void parallel_breadth_first_search(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s,
+    const bgl_named_params< P, T, R >& params)
+{
+    detail::parallel_bfs_impl(g, s,
+        choose_param(get_param(params, vertex_distance), dummy_property_map()),
+        choose_param(
+            get_param(params, vertex_predecessor), dummy_property_map()),
+        choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+        choose_param(get_param(params, num_threads_t()), std::size_t(0)));
+}
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_PARALLEL_BREADTH_FIRST_SEARCH_HPP
@@ -0,0 +1,136 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#ifndef BOOST_GRAPH_PERSONALIZED_PAGE_RANK_HPP
+#define BOOST_GRAPH_PERSONALIZED_PAGE_RANK_HPP
+
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/iteration_macros.hpp>
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <cstddef>
+#include <deque>
+#include <stdexcept>
+
+namespace boost
+{
+namespace graph
+{
+
+    // Sparse state of the local push algorithm: the PageRank estimates and
+    // the residual mass not yet pushed, for the vertices touched by the
+    // last query only.  The hash maps and the queue keep their memory from
+    // one query to the next.
+    //
+    // A workspace is not thread-safe; use one per thread.
+    template < typename Graph, typename Value = double >
+    class personalized_page_rank_workspace
+    {
+    public:
+        typedef typename graph_traits< Graph >::vertex_descriptor
+            vertex_descriptor;
+        typedef Value value_type;
+        typedef boost::unordered_flat_map< vertex_descriptor, Value >
+            map_type;
+
+        // Results of the last query; vertices that are not in a map have
+        // the value 0
+        const map_type& estimates() const { return m_estimate; }
+        const map_type& residuals() const { return m_residual; }
+
+        Value estimate(vertex_descriptor v) const
+        {
+            return find(m_estimate, v);
+        }
+
+        Value residual(vertex_descriptor v) const
+        {
+            return find(m_residual, v);
+        }
+
+        // Runs a query from seed; the results stay readable until the next
+        // query.  Returns the number of pushes.
+        std::size_t search(const Graph& g, vertex_descriptor seed,
+            Value epsilon, Value damping)
+        {
+            m_estimate.clear();
+            m_residual.clear();
+            m_queue.clear();
+            add(g, seed, Value(1), epsilon);
+
+            std::size_t pushes = 0;
+            while (!m_queue.empty())
+            {
+                const vertex_descriptor u = m_queue.front();
+                m_queue.pop_front();
+                Value& r_u = m_residual[u];
+                const Value r = r_u;
+                r_u = 0;
+                m_estimate[u] += (1 - damping) * r;
+                ++pushes;
+
+                const std::size_t d = out_degree(u, g);
+                if (d == 0)
+                    add(g, seed, damping * r, epsilon);
+                else
+                {
+                    const Value share = damping * r / Value(d);
+                    BGL_FORALL_ADJ_T(u, v, g, Graph)
+                    add(g, v, share, epsilon);
+                }
+            }
+            return pushes;
+        }
+
+    private:
+        static Value find(const map_type& m, vertex_descriptor v)
+        {
+            typename map_type::const_iterator i = m.find(v);
+            return i == m.end() ? Value(0) : i->second;
+        }
+
+        // Adds to the residual of v, queueing v when its residual comes to
+        // exceed epsilon times its out-degree, so it is queued at most once
+        void add(const Graph& g, vertex_descriptor v, Value amount,
+            Value epsilon)
+        {
+            const std::size_t d = out_degree(v, g);
+            const Value limit = epsilon * Value(d == 0 ? 1 : d);
+            Value& r = m_residual[v];
+            const bool below = !(r > limit);
+            r += amount;
+            if (below && r > limit)
+                m_queue.push_back(v);
+        }
+
+        map_type m_estimate;
+        map_type m_residual;
+        std::deque< vertex_descriptor > m_queue;
+    };
+
+    // Approximates the PageRank personalized on seed by pushing residual
+    // mass out of the vertices that hold more than epsilon times their
+    // out-degree (Andersen, Chung and Lang).  The rank of vertices without
+    // out-edges returns to the seed, as in parallel_personalized_page_rank.
+    // Returns the number of pushes, which is at most
+    // 1 / (epsilon (1 - damping)) whatever the size of the graph.
+    template < typename Graph, typename Value >
+    inline std::size_t personalized_page_rank_push(const Graph& g,
+        typename graph_traits< Graph >::vertex_descriptor seed,
+        double epsilon, personalized_page_rank_workspace< Graph, Value >& ws,
+        double damping = 0.85)
+    {
+        if (!(epsilon > 0) || !(damping >= 0 && damping < 1))
+            throw std::invalid_argument(
+                "epsilon must be positive and damping in [0, 1).");
+        return ws.search(g, seed, Value(epsilon), Value(damping));
+    }
+
+}
+} // end namespace boost::graph
+
+#endif // BOOST_GRAPH_PERSONALIZED_PAGE_RANK_HPP
@@ -0,0 +1,280 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// An allocator that controls where the pages of large graph arrays are
+// placed: on transparent huge pages, interleaved across NUMA nodes, or
+// split into contiguous blocks bound to successive nodes.  Use it as the
+// Allocator argument of compressed_sparse_row_graph, or for the vertex
+// storage of adjacency_list through vec_with_allocatorS.
+
+#ifndef BOOST_GRAPH_PLACEMENT_ALLOCATOR_HPP
+#define BOOST_GRAPH_PLACEMENT_ALLOCATOR_HPP
+
+#include <boost/config.hpp>
+#include <cstddef>
+#include <cstdio>
+#include <limits>
+#include <new>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define BOOST_GRAPH_PLACEMENT_USE_MMAP
+#if defined(SYS_mbind)
+#define BOOST_GRAPH_PLACEMENT_USE_MBIND
+#endif
+#endif
+
+namespace boost
+{
+
+// Placement flags for placement_allocator.  They may be combined, except
+// that interleaved_placement and partitioned_placement exclude each other.
+enum memory_placement
+{
+    default_placement = 0,
+    // Back the allocation with transparent huge pages, cutting TLB misses
+    // during random neighbor access
+    huge_page_placement = 1,
+    // Spread the pages round-robin over all NUMA nodes, so that threads on
+    // every node see the same average latency and bandwidth
+    interleaved_placement = 2,
+    // Split the allocation into one contiguous block per NUMA node, in
+    // node order.  This matches first-touch placement by threads that
+    // process contiguous vertex or edge ranges and are spread over the
+    // nodes in order, without depending on which thread writes first.
+    partitioned_placement = 4
+};
+
+namespace detail
+{
+    // Allocations smaller than this come from operator new: the placement
+    // policies only pay off for arrays spanning many pages
+    const std::size_t placement_min_bytes = std::size_t(1) << 18;
+
+    const std::size_t placement_huge_page_bytes = std::size_t(1) << 21;
+
+    // Online NUMA nodes, read once from sysfs.  Empty if the information
+    // is not available, in which case no NUMA policy is applied.
+    inline const std::vector< int >& online_numa_nodes()
+    {
+        struct reader
+        {
+            static std::vector< int > read()
+            {
+                std::vector< int > nodes;
+#if defined(BOOST_GRAPH_PLACEMENT_USE_MBIND)
+                std::FILE* f
+                    = std::fopen("/sys/devices/system/node/online", "r");
+                if (!f)
+                    return nodes;
+                // Format: comma-separated ranges such as "0-3,8"
+                int first, last;
+                while (std::fscanf(f, "%d", &first) == 1)
+                {
+                    last = first;
+                    int c = std::fgetc(f);
+                    if (c == '-')
+                    {
+                        if (std::fscanf(f, "%d", &last) != 1)
+                            break;
+                        c = std::fgetc(f);
+                    }
+                    for (int n = first; n <= last; ++n)
+                        nodes.push_back(n);
+                    if (c != ',')
+                        break;
+                }
+                std::fclose(f);
+#endif
+                return nodes;
+            }
+        };
+        static const std::vector< int > nodes = reader::read();
+        return nodes;
+    }
+
+#if defined(BOOST_GRAPH_PLACEMENT_USE_MBIND)
+    // Apply an mbind(2) policy over a node set; errors are ignored since
+    // placement is only a hint
+    inline void placement_mbind(void* addr, std::size_t bytes, int mode,
+        const std::vector< int >& nodes)
+    {
+        const std::size_t bits = std::numeric_limits< unsigned long >::digits;
+        std::vector< unsigned long > mask(
+            std::size_t(nodes.back()) / bits + 1, 0);
+        for (std::size_t i = 0; i < nodes.size(); ++i)
+            mask[std::size_t(nodes[i]) / bits]
+                |= 1ul << (std::size_t(nodes[i]) % bits);
+        ::syscall(SYS_mbind, addr, bytes, mode, &mask[0],
+            mask.size() * bits + 1, 0);
+    }
+#endif
+
+    // Map bytes (rounded as by placement_mapped_size) of untouched memory
+    // and apply the placement policy before any page is faulted in
+    inline void* placement_map(std::size_t bytes, unsigned placement)
+    {
+#if defined(BOOST_GRAPH_PLACEMENT_USE_MMAP)
+        const bool huge = (placement & huge_page_placement) != 0;
+        const std::size_t align = huge ? placement_huge_page_bytes : 0;
+        void* raw = ::mmap(0, bytes + align, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw == MAP_FAILED)
+            throw std::bad_alloc();
+        char* p = static_cast< char* >(raw);
+        if (huge)
+        {
+            // Trim to a huge-page-aligned range so every page can be huge
+            std::size_t head = (placement_huge_page_bytes
+                                   - std::size_t(p) % placement_huge_page_bytes)
+                % placement_huge_page_bytes;
+            if (head)
+                ::munmap(p, head);
+            if (align - head)
+                ::munmap(p + head + bytes, align - head);
+            p += head;
+#if defined(MADV_HUGEPAGE)
+            ::madvise(p, bytes, MADV_HUGEPAGE);
+#endif
+        }
+#if defined(BOOST_GRAPH_PLACEMENT_USE_MBIND)
+        const std::vector< int >& nodes = online_numa_nodes();
+        if (nodes.size() > 1)
+        {
+            const int mpol_preferred = 1, mpol_interleave = 3;
+            if (placement & interleaved_placement)
+                placement_mbind(p, bytes, mpol_interleave, nodes);
+            else if (placement & partitioned_placement)
+            {
+                const std::size_t page = huge ? placement_huge_page_bytes
+                                              : std::size_t(::getpagesize());
+                std::size_t pages = (bytes + page - 1) / page;
+                for (std::size_t i = 0; i < nodes.size(); ++i)
+                {
+                    std::size_t begin = pages * i / nodes.size() * page;
+                    std::size_t end = i + 1 == nodes.size()
+                        ? bytes
+                        : pages * (i + 1) / nodes.size() * page;
+                    if (end > begin)
+                        placement_mbind(p + begin, end - begin,
+                            mpol_preferred, std::vector< int >(1, nodes[i]));
+                }
+            }
+        }
+#endif
+        return p;
+#else
+        (void)placement;
+        return ::operator new(bytes);
+#endif
+    }
+
+    inline void placement_unmap(void* p, std::size_t bytes)
+    {
+#if defined(BOOST_GRAPH_PLACEMENT_USE_MMAP)
+        ::munmap(p, bytes);
+#else
+        (void)bytes;
+        ::operator delete(p);
+#endif
+    }
+
+    // Size actually mapped for a request of bytes
+    inline std::size_t placement_mapped_size(
+        std::size_t bytes, unsigned placement)
+    {
+        if (!(placement & huge_page_placement))
+            return bytes;
+        return (bytes + placement_huge_page_bytes - 1)
+            / placement_huge_page_bytes * placement_huge_page_bytes;
+    }
+} // namespace detail
+
+// A stateless allocator applying the memory_placement flags in Placement
+// to every allocation of at least 256 KiB; smaller ones use operator new.
+// Large allocations are mapped directly from the operating system so that
+// the policy is in force before the first page is touched.  On systems
+// other than Linux, or with a single NUMA node, the corresponding policies
+// have no effect.
+template < typename T, unsigned Placement = default_placement >
+class placement_allocator
+{
+public:
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    template < typename U > struct rebind
+    {
+        typedef placement_allocator< U, Placement > other;
+    };
+
+    placement_allocator() BOOST_NOEXCEPT {}
+
+    template < typename U >
+    placement_allocator(const placement_allocator< U, Placement >&)
+        BOOST_NOEXCEPT
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+        if (n > max_size())
+            throw std::bad_alloc();
+        std::size_t bytes = n * sizeof(T);
+        if (Placement == default_placement
+            || bytes < detail::placement_min_bytes)
+            return static_cast< T* >(::operator new(bytes));
+        return static_cast< T* >(detail::placement_map(
+            detail::placement_mapped_size(bytes, Placement), Placement));
+    }
+
+    void deallocate(T* p, std::size_t n) BOOST_NOEXCEPT
+    {
+        std::size_t bytes = n * sizeof(T);
+        if (Placement == default_placement
+            || bytes < detail::placement_min_bytes)
+            ::operator delete(p);
+        else
+            detail::placement_unmap(
+                p, detail::placement_mapped_size(bytes, Placement));
+    }
+
+    std::size_t max_size() const BOOST_NOEXCEPT
+    {
+        return (std::numeric_limits< std::size_t >::max)() / sizeof(T) / 2;
+    }
+};
+
+template < typename T, typename U, unsigned Placement >
+bool operator==(const placement_allocator< T, Placement >&,
+    const placement_allocator< U, Placement >&) BOOST_NOEXCEPT
+{
+    return true;
+}
+
+template < typename T, typename U, unsigned Placement >
+bool operator!=(const placement_allocator< T, Placement >&,
+    const placement_allocator< U, Placement >&) BOOST_NOEXCEPT
+{
+    return false;
+}
+
+} // namespace boost
+
+#undef BOOST_GRAPH_PLACEMENT_USE_MBIND
+#undef BOOST_GRAPH_PLACEMENT_USE_MMAP
+
+#endif // BOOST_GRAPH_PLACEMENT_ALLOCATOR_HPP
@@ -0,0 +1,505 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Structure-of-arrays storage for the bundled edge properties of
+// compressed_sparse_row_graph.  Using
+//
+//   soa_edge_bundle< Road, BOOST_GRAPH_BUNDLE_MEMBER(Road, weight),
+//       BOOST_GRAPH_BUNDLE_MEMBER(Road, length) >
+//
+// as the EdgeProperty argument stores each listed member of Road in its own
+// contiguous array, so that get(&Road::weight, g) is a plain array indexed by
+// edge index and an algorithm reading only the weights streams only them.
+
+#ifndef BOOST_GRAPH_SOA_EDGE_BUNDLE_HPP
+#define BOOST_GRAPH_SOA_EDGE_BUNDLE_HPP
+
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/detail/indexed_properties.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/utility/enable_if.hpp>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace boost
+{
+
+namespace detail
+{
+    template < typename MemberPointer > struct bundle_member_pointer_traits;
+
+    template < typename T, typename Bundle >
+    struct bundle_member_pointer_traits< T Bundle::* >
+    {
+        typedef T value_type;
+        typedef Bundle bundle_type;
+    };
+} // namespace detail
+
+// A data member of a bundled property struct, named by its pointer to
+// member: bundle_member< double Road::*, &Road::weight >.
+// BOOST_GRAPH_BUNDLE_MEMBER(Road, weight) spells the same type.
+template < typename MemberPointer, MemberPointer Pointer > struct bundle_member
+{
+    typedef typename detail::bundle_member_pointer_traits<
+        MemberPointer >::value_type value_type;
+    typedef typename detail::bundle_member_pointer_traits<
+        MemberPointer >::bundle_type bundle_type;
+
+    static MemberPointer pointer() { return Pointer; }
+};
+
+#define BOOST_GRAPH_BUNDLE_MEMBER(Bundle, member)   \
+    ::boost::bundle_member< decltype(&Bundle::member), \
+        &Bundle::member >
+
+// Edge property selector for compressed_sparse_row_graph: edge bundles of
+// type Bundle whose listed Members are each stored in a separate array.
+// Members that are not listed are not stored; reading a bundle back yields a
+// default-constructed Bundle with the listed members filled in.
+template < typename Bundle, typename... Members > struct soa_edge_bundle
+{
+};
+
+namespace detail
+{
+    // Evaluates its arguments in order; used to expand over Members
+    struct soa_expand
+    {
+        template < typename... T > soa_expand(const T&...) {}
+    };
+
+    // Whether one of Members has value type T
+    template < typename T, typename... Members > struct soa_has_column_type;
+
+    template < typename T > struct soa_has_column_type< T > : std::false_type
+    {
+    };
+
+    template < typename T, typename Member, typename... Members >
+    struct soa_has_column_type< T, Member, Members... >
+    : std::integral_constant< bool,
+          is_same< typename Member::value_type, T >::value
+              || soa_has_column_type< T, Members... >::value >
+    {
+    };
+
+    template < typename Member, typename Allocator > struct soa_column
+    {
+        typedef typename Member::value_type value_type;
+        typedef std::vector< value_type,
+            typename std::allocator_traits<
+                Allocator >::template rebind_alloc< value_type > >
+            column_type;
+
+        column_type values;
+    };
+
+    // A sequence of Bundle values stored as one vector per member, with the
+    // parts of the std::vector interface used by indexed_edge_properties.
+    // Elements are accessed through proxies that read or write all columns
+    // at once.
+    template < typename Bundle, typename Allocator, typename... Members >
+    class soa_vector : private soa_column< Members, Allocator >...
+    {
+        BOOST_STATIC_ASSERT_MSG(sizeof...(Members) > 0,
+            "soa_edge_bundle needs at least one member");
+
+    public:
+        typedef Bundle value_type;
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+
+        class reference
+        {
+        public:
+            reference(soa_vector* v, std::size_t i) : m_v(v), m_i(i) {}
+
+            operator Bundle() const { return m_v->load(m_i); }
+
+            reference& operator=(const Bundle& b)
+            {
+                m_v->store(m_i, b);
+                return *this;
+            }
+
+            reference& operator=(const reference& r)
+            {
+                m_v->copy_element(*r.m_v, r.m_i, m_i);
+                return *this;
+            }
+
+        private:
+            soa_vector* m_v;
+            std::size_t m_i;
+        };
+        typedef Bundle const_reference;
+
+        class iterator
+        : public boost::iterator_facade< iterator, Bundle,
+              std::random_access_iterator_tag, reference >
+        {
+        public:
+            iterator() : m_v(0), m_i(0) {}
+            iterator(soa_vector* v, std::size_t i) : m_v(v), m_i(i) {}
+
+        private:
+            friend class boost::iterator_core_access;
+            reference dereference() const { return reference(m_v, m_i); }
+            bool equal(const iterator& x) const { return m_i == x.m_i; }
+            void increment() { ++m_i; }
+            void decrement() { --m_i; }
+            void advance(std::ptrdiff_t n) { m_i += n; }
+            std::ptrdiff_t distance_to(const iterator& x) const
+            {
+                return std::ptrdiff_t(x.m_i) - std::ptrdiff_t(m_i);
+            }
+
+            soa_vector* m_v;
+            std::size_t m_i;
+        };
+
+        class const_iterator
+        : public boost::iterator_facade< const_iterator, Bundle,
+              std::random_access_iterator_tag, Bundle >
+        {
+        public:
+            const_iterator() : m_v(0), m_i(0) {}
+            const_iterator(const soa_vector* v, std::size_t i) : m_v(v), m_i(i)
+            {
+            }
+
+        private:
+            friend class boost::iterator_core_access;
+            Bundle dereference() const { return m_v->load(m_i); }
+            bool equal(const const_iterator& x) const { return m_i == x.m_i; }
+            void increment() { ++m_i; }
+            void decrement() { --m_i; }
+            void advance(std::ptrdiff_t n) { m_i += n; }
+            std::ptrdiff_t distance_to(const const_iterator& x) const
+            {
+                return std::ptrdiff_t(x.m_i) - std::ptrdiff_t(m_i);
+            }
+
+            const soa_vector* m_v;
+            std::size_t m_i;
+        };
+
+        soa_vector() : m_size(0) {}
+        explicit soa_vector(std::size_t n) : m_size(0) { resize(n); }
+
+        std::size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+
+        void clear()
+        {
+            soa_expand { (column< Members >().clear(), 0)... };
+            m_size = 0;
+        }
+
+        void resize(std::size_t n) { resize(n, Bundle()); }
+
+        void resize(std::size_t n, const Bundle& b)
+        {
+            soa_expand { (column< Members >().resize(
+                              n, b.*Members::pointer()),
+                0)... };
+            m_size = n;
+        }
+
+        void reserve(std::size_t n)
+        {
+            soa_expand { (column< Members >().reserve(n), 0)... };
+        }
+
+        void push_back(const Bundle& b)
+        {
+            soa_expand { (column< Members >().push_back(
+                              b.*Members::pointer()),
+                0)... };
+            ++m_size;
+        }
+
+        template < typename InputIterator >
+        void assign(InputIterator first, InputIterator last)
+        {
+            clear();
+            for (; first != last; ++first)
+                push_back(*first);
+        }
+
+        void swap(soa_vector& x)
+        {
+            soa_expand { (column< Members >().swap(
+                              x.template column< Members >()),
+                0)... };
+            std::swap(m_size, x.m_size);
+        }
+
+        reference operator[](std::size_t i) { return reference(this, i); }
+        const_reference operator[](std::size_t i) const { return load(i); }
+
+        iterator begin() { return iterator(this, 0); }
+        iterator end() { return iterator(this, m_size); }
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, m_size); }
+
+        // The array holding member p of every element.  A member whose type
+        // no column has is rejected at compile time; one that shares the
+        // type of a column without being stored throws invalid_argument.
+        template < typename T > T* column_data(T Bundle::*p)
+        {
+            BOOST_STATIC_ASSERT_MSG(
+                (soa_has_column_type< T, Members... >::value),
+                "soa_edge_bundle: the member is not one of the stored "
+                "members");
+            T* result = 0;
+            bool found = false;
+            soa_expand { (find_column< Members >(p, result, found), 0)... };
+            if (!found)
+                BOOST_THROW_EXCEPTION(std::invalid_argument(
+                    "soa_edge_bundle: the member is not one of the stored "
+                    "members"));
+            return result;
+        }
+
+        template < typename T > const T* column_data(T Bundle::*p) const
+        {
+            return const_cast< soa_vector* >(this)->column_data(p);
+        }
+
+        template < typename Member >
+        typename soa_column< Member, Allocator >::column_type& column()
+        {
+            return static_cast< soa_column< Member, Allocator >& >(*this)
+                .values;
+        }
+
+        template < typename Member >
+        const typename soa_column< Member, Allocator >::column_type&
+        column() const
+        {
+            return static_cast< const soa_column< Member, Allocator >& >(*this)
+                .values;
+        }
+
+    private:
+        Bundle load(std::size_t i) const
+        {
+            Bundle b = Bundle();
+            soa_expand { (b.*Members::pointer() = column< Members >()[i],
+                0)... };
+            return b;
+        }
+
+        void store(std::size_t i, const Bundle& b)
+        {
+            soa_expand { (column< Members >()[i] = b.*Members::pointer(),
+                0)... };
+        }
+
+        // Copies element from of src, which may be *this, to element to
+        void copy_element(
+            const soa_vector& src, std::size_t from, std::size_t to)
+        {
+            soa_expand { (column< Members >()[to]
+                             = src.template column< Members >()[from],
+                0)... };
+        }
+
+        template < typename Member, typename T >
+        typename enable_if< is_same< typename Member::value_type, T > >::type
+        find_column(T Bundle::*p, T*& result, bool& found)
+        {
+            if (!found && Member::pointer() == p)
+            {
+                result = column< Member >().data();
+                found = true;
+            }
+        }
+
+        template < typename Member, typename T >
+        typename disable_if< is_same< typename Member::value_type, T > >::type
+        find_column(T Bundle::*, T*&, bool&)
+        {
+        }
+
+        std::size_t m_size;
+    };
+
+    template < typename Bundle, typename Allocator, typename... Members >
+    void swap(soa_vector< Bundle, Allocator, Members... >& a,
+        soa_vector< Bundle, Allocator, Members... >& b)
+    {
+        a.swap(b);
+    }
+
+    // Used when the in-place CSR constructors hand over their sorted vector
+    // of edge bundles
+    template < typename Bundle, typename Allocator, typename... Members,
+        typename SrcAlloc >
+    void csr_take_vector(soa_vector< Bundle, Allocator, Members... >& dest,
+        std::vector< Bundle, SrcAlloc >& src)
+    {
+        dest.assign(src.begin(), src.end());
+        std::vector< Bundle, SrcAlloc >().swap(src);
+    }
+
+    template < typename Bundle, typename... Members, typename Allocator >
+    struct indexed_edge_property_storage<
+        soa_edge_bundle< Bundle, Members... >, Allocator >
+    {
+        typedef Bundle value_type;
+        typedef soa_vector< Bundle, Allocator, Members... > type;
+    };
+} // namespace detail
+
+#define BOOST_SOA_CSR_GRAPH_TYPE                                          \
+    compressed_sparse_row_graph< Directed, VertexProperty,                \
+        soa_edge_bundle< Bundle, Members... >, GraphProperty, Vertex, \
+        EdgeIndex, Allocator >
+
+// get(&Bundle::member, g) is a property map over the member's own array
+template < typename Directed, typename VertexProperty, typename Bundle,
+    typename GraphProperty, typename Vertex, typename EdgeIndex,
+    typename Allocator, typename T, typename... Members >
+struct csr_property_map_helper< BOOST_SOA_CSR_GRAPH_TYPE, T Bundle::*,
+    edge_property_tag >
+{
+    typedef edge_all_t all_tag;
+    typedef detail::csr_edge_descriptor< Vertex, EdgeIndex > key_type;
+    typedef iterator_property_map< T*,
+        detail::csr_edge_index_map< Vertex, EdgeIndex >, T, T& >
+        type;
+    typedef iterator_property_map< const T*,
+        detail::csr_edge_index_map< Vertex, EdgeIndex >, T, const T& >
+        const_type;
+};
+
+// get(edge_bundle, g) reads and writes whole bundles through the columns
+template < typename Directed, typename VertexProperty, typename Bundle,
+    typename GraphProperty, typename Vertex, typename EdgeIndex,
+    typename Allocator, typename... Members >
+struct csr_property_map_helper< BOOST_SOA_CSR_GRAPH_TYPE, edge_bundle_t,
+    edge_property_tag >
+{
+    typedef edge_all_t all_tag;
+    typedef detail::csr_edge_descriptor< Vertex, EdgeIndex > key_type;
+    typedef typename property_map< BOOST_SOA_CSR_GRAPH_TYPE, edge_all_t >::type
+        type;
+    typedef typename property_map< BOOST_SOA_CSR_GRAPH_TYPE,
+        edge_all_t >::const_type const_type;
+};
+
+template < typename Directed, typename VertexProperty, typename Bundle,
+    typename GraphProperty, typename Vertex, typename EdgeIndex,
+    typename Allocator, typename T, typename... Members >
+typename property_map< BOOST_SOA_CSR_GRAPH_TYPE, T Bundle::* >::type get(
+    T Bundle::*p, BOOST_SOA_CSR_GRAPH_TYPE& g)
+{
+    T* column = g.m_forward.m_edge_properties.column_data(p);
+    return typename property_map< BOOST_SOA_CSR_GRAPH_TYPE, T Bundle::* >::type(
+        column, get(edge_index, g));
+}
+
+template < typename Directed, typename VertexProperty, typename Bundle,
+    typename GraphProperty, typename Vertex, typename EdgeIndex,
+    typename Allocator, typename T, typename... Members >
+typename property_map< BOOST_SOA_CSR_GRAPH_TYPE, T Bundle::* >::const_type get(
+    T Bundle::*p, const BOOST_SOA_CSR_GRAPH_TYPE& g)
+{
+    const T* column = g.m_forward.m_edge_properties.column_data(p);
+    return typename property_map< BOOST_SOA_CSR_GRAPH_TYPE,
+        T Bundle::* >::const_type(column, get(edge_index, g));
+}
+
+template < typename Directed, typename VertexProperty, typename Bundle,
+    typename GraphProperty, typename Vertex, typename EdgeIndex,
+    typename Allocator, typename T, typename... Members >
+T& get(T Bundle::*p, BOOST_SOA_CSR_GRAPH_TYPE& g,
+    typename BOOST_SOA_CSR_GRAPH_TYPE::edge_descriptor e)
+{
+    return get(p, g)[e];
+}
+
+template < typename Directed, typename VertexProperty, typename Bundle,
+    typename GraphProperty, typename Vertex, typename EdgeIndex,
+    typename Allocator, typename T, typename... Members >
+const T& get(T Bundle::*p, const BOOST_SOA_CSR_GRAPH_TYPE& g,
+    typename BOOST_SOA_CSR_GRAPH_TYPE::edge_descriptor e)
+{
+    return get(p, g)[e];
+}
+
+template < typename Directed, typename VertexProperty, typename Bundle,
+    typename GraphProperty, typename Vertex, typename EdgeIndex,
+    typename Allocator, typename T, typename... Members >
+void put(T Bundle::*p, BOOST_SOA_CSR_GRAPH_TYPE& g,
+    typename BOOST_SOA_CSR_GRAPH_TYPE::edge_descriptor e, const T& value)
+{
+    get(p, g)[e] = value;
+}
+
+template < typename Directed, typename VertexProperty, typename Bundle,
+    typename GraphProperty, typename Vertex, typename EdgeIndex,
+    typename Allocator, typename... Members >
+typename property_map< BOOST_SOA_CSR_GRAPH_TYPE, edge_bundle_t >::type get(
+    edge_bundle_t, BOOST_SOA_CSR_GRAPH_TYPE& g)
+{
+    return get(edge_all, g);
+}
+
+template < typename Directed, typename VertexProperty, typename Bundle,
+    typename GraphProperty, typename Vertex, typename EdgeIndex,
+    typename Allocator, typename... Members >
+typename property_map< BOOST_SOA_CSR_GRAPH_TYPE, edge_bundle_t >::const_type
+get(edge_bundle_t, const BOOST_SOA_CSR_GRAPH_TYPE& g)
+{
+    return get(edge_all, g);
+}
+
+template < typename Directed, typename VertexProperty, typename Bundle,
+    typename GraphProperty, typename Vertex, typename EdgeIndex,
+    typename Allocator, typename... Members >
+Bundle get(edge_bundle_t, BOOST_SOA_CSR_GRAPH_TYPE& g,
+    typename BOOST_SOA_CSR_GRAPH_TYPE::edge_descriptor e)
+{
+    return g[e];
+}
+
+template < typename Directed, typename VertexProperty, typename Bundle,
+    typename GraphProperty, typename Vertex, typename EdgeIndex,
+    typename Allocator, typename... Members >
+Bundle get(edge_bundle_t, const BOOST_SOA_CSR_GRAPH_TYPE& g,
+    typename BOOST_SOA_CSR_GRAPH_TYPE::edge_descriptor e)
+{
+    return g[e];
+}
+
+template < typename Directed, typename VertexProperty, typename Bundle,
+    typename GraphProperty, typename Vertex, typename EdgeIndex,
+    typename Allocator, typename... Members >
+void put(edge_bundle_t, BOOST_SOA_CSR_GRAPH_TYPE& g,
+    typename BOOST_SOA_CSR_GRAPH_TYPE::edge_descriptor e, const Bundle& value)
+{
+    g[e] = value;
+}
+
+#undef BOOST_SOA_CSR_GRAPH_TYPE
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_SOA_EDGE_BUNDLE_HPP
@@ -0,0 +1,528 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Single-source shortest paths with negative edge weights by worklist
+// Bellman-Ford.  spfa_shortest_paths (Bellman-Ford-Moore, the "shortest
+// path faster algorithm") keeps a FIFO queue of the vertices whose
+// distance dropped and scans only their out-edges;
+// parallel_bellman_ford_shortest_paths relaxes the out-edges of each
+// round's changed vertices on several threads.  Both stop as soon as no
+// distance changes.
+//
+// Negative cycles are found by walking the predecessor graph after every
+// n relaxations (Cherkassky and Goldberg, "Negative-cycle detection
+// algorithms", Math. Programming 85, 1999): any cycle there has negative
+// weight, and once a reachable negative cycle has pushed some distance
+// below the weight of every simple path one must be there, so the search
+// always terminates, at an amortized O(1) cost per relaxation.
+
+#ifndef BOOST_GRAPH_SPFA_SHORTEST_PATHS_HPP
+#define BOOST_GRAPH_SPFA_SHORTEST_PATHS_HPP
+
+#include <boost/config.hpp>
+#include <boost/graph/detail/parallel_for.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/named_function_params.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/concept/assert.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+#include <atomic>
+#endif
+
+namespace boost
+{
+
+namespace detail
+{
+    // Changed vertices handed out at a time in a parallel round
+    const std::size_t spfa_grain = 256;
+
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+    template < typename T > class spfa_atomic
+    {
+    public:
+        spfa_atomic() : m_value() {}
+        T load() const { return m_value.load(std::memory_order_relaxed); }
+        void store(T x) { m_value.store(x, std::memory_order_relaxed); }
+        T exchange(T x)
+        {
+            return m_value.exchange(x, std::memory_order_relaxed);
+        }
+        T fetch_add(T x)
+        {
+            return m_value.fetch_add(x, std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic< T > m_value;
+    };
+
+    // Guards the distance and predecessor of one vertex
+    class spfa_lock
+    {
+    public:
+        spfa_lock() { m_flag.clear(); }
+        void lock()
+        {
+            while (m_flag.test_and_set(std::memory_order_acquire))
+            {
+            }
+        }
+        void unlock() { m_flag.clear(std::memory_order_release); }
+
+    private:
+        std::atomic_flag m_flag;
+    };
+#else
+    template < typename T > class spfa_atomic
+    {
+    public:
+        spfa_atomic() : m_value() {}
+        T load() const { return m_value; }
+        void store(T x) { m_value = x; }
+        T exchange(T x)
+        {
+            T old = m_value;
+            m_value = x;
+            return old;
+        }
+        T fetch_add(T x)
+        {
+            T old = m_value;
+            m_value += x;
+            return old;
+        }
+
+    private:
+        T m_value;
+    };
+
+    class spfa_lock
+    {
+    public:
+        void lock() {}
+        void unlock() {}
+    };
+#endif
+
+    // Looks for a cycle in the predecessor graph, where roots are their
+    // own predecessors.  On success, cycle holds its vertices in the order
+    // of its edges.
+    inline bool spfa_find_cycle(const std::vector< std::size_t >& pred,
+        std::vector< std::size_t >& walk, std::vector< std::size_t >& cycle)
+    {
+        const std::size_t n = pred.size();
+        walk.assign(n, 0);
+        for (std::size_t v = 0; v < n; ++v)
+        {
+            std::size_t x = v;
+            while (walk[x] == 0)
+            {
+                walk[x] = v + 1;
+                if (pred[x] == x)
+                    break;
+                x = pred[x];
+            }
+            if (walk[x] == v + 1 && pred[x] != x)
+            {
+                cycle.clear();
+                std::size_t y = x;
+                do
+                {
+                    cycle.push_back(y);
+                    y = pred[y];
+                } while (y != x);
+                std::reverse(cycle.begin(), cycle.end());
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template < typename T > inline T spfa_value(const T& x) { return x; }
+
+    template < typename T > inline T spfa_value(const spfa_atomic< T >& x)
+    {
+        return x.load();
+    }
+
+    // Writes the results to the caller's maps and the cycle, if any, to
+    // negative_cycle; returns true if there is none
+    template < typename Graph, typename DistanceMap, typename PredecessorMap,
+        typename DistanceVector, typename OutputIterator >
+    bool spfa_finish(const Graph& g,
+        const std::vector< typename graph_traits< Graph >::vertex_descriptor >&
+            vertex_of,
+        const DistanceVector& dist, const std::vector< std::size_t >& pred,
+        const std::vector< std::size_t >& cycle, DistanceMap distance,
+        PredecessorMap predecessor, OutputIterator negative_cycle)
+    {
+        for (std::size_t v = 0; v < num_vertices(g); ++v)
+        {
+            put(distance, vertex_of[v], spfa_value(dist[v]));
+            put(predecessor, vertex_of[v], vertex_of[pred[v]]);
+        }
+        for (std::size_t i = 0; i < cycle.size(); ++i)
+            *negative_cycle++ = vertex_of[cycle[i]];
+        return cycle.empty();
+    }
+
+    template < typename Graph, typename VertexIndexMap >
+    std::vector< typename graph_traits< Graph >::vertex_descriptor >
+    spfa_vertices(const Graph& g, VertexIndexMap index)
+    {
+        std::vector< typename graph_traits< Graph >::vertex_descriptor >
+            vertex_of(num_vertices(g));
+        typename graph_traits< Graph >::vertex_iterator vi, vi_end;
+        for (boost::tie(vi, vi_end) = vertices(g); vi != vi_end; ++vi)
+            vertex_of[get(index, *vi)] = *vi;
+        return vertex_of;
+    }
+
+    // The searches start from every vertex of [s_begin, s_end) at distance
+    // zero, as if from a virtual source with zero edges to each of them
+    template < typename Graph, typename SourceInputIter, typename WeightMap,
+        typename DistanceMap, typename PredecessorMap,
+        typename VertexIndexMap, typename OutputIterator >
+    bool spfa_impl(const Graph& g, SourceInputIter s_begin,
+        SourceInputIter s_end, WeightMap weight, DistanceMap distance,
+        PredecessorMap predecessor, VertexIndexMap index,
+        OutputIterator negative_cycle)
+    {
+        BOOST_CONCEPT_ASSERT((IncidenceGraphConcept< Graph >));
+        BOOST_CONCEPT_ASSERT((VertexListGraphConcept< Graph >));
+        typedef typename property_traits< DistanceMap >::value_type Distance;
+        const std::size_t n = num_vertices(g);
+        const Distance inf = (std::numeric_limits< Distance >::max)();
+
+        std::vector< typename graph_traits< Graph >::vertex_descriptor >
+            vertex_of = spfa_vertices(g, index);
+        std::vector< Distance > dist(n, inf);
+        std::vector< std::size_t > pred(n), walk, cycle;
+        for (std::size_t v = 0; v < n; ++v)
+            pred[v] = v;
+        // A circular FIFO queue holds each vertex at most once
+        std::vector< std::size_t > queue(n + 1);
+        std::vector< char > queued(n, 0);
+        std::size_t head = 0, tail = 0, relaxed = 0;
+        for (; s_begin != s_end; ++s_begin)
+        {
+            const std::size_t src = get(index, *s_begin);
+            dist[src] = Distance(0);
+            if (!queued[src])
+            {
+                queue[tail++] = src;
+                queued[src] = 1;
+            }
+        }
+
+        while (head != tail)
+        {
+            std::size_t u = queue[head];
+            head = head == n ? 0 : head + 1;
+            queued[u] = 0;
+            const Distance du = dist[u];
+            typename graph_traits< Graph >::out_edge_iterator ei, ei_end;
+            for (boost::tie(ei, ei_end) = out_edges(vertex_of[u], g);
+                 ei != ei_end; ++ei)
+            {
+                std::size_t v = get(index, target(*ei, g));
+                Distance d = Distance(du + get(weight, *ei));
+                if (!(d < dist[v]))
+                    continue;
+                if (v == u)
+                {
+                    // A negative self-loop
+                    cycle.assign(1, u);
+                    return spfa_finish(g, vertex_of, dist, pred, cycle,
+                        distance, predecessor, negative_cycle);
+                }
+                dist[v] = d;
+                pred[v] = u;
+                if (!queued[v])
+                {
+                    queue[tail] = v;
+                    tail = tail == n ? 0 : tail + 1;
+                    queued[v] = 1;
+                }
+                if (++relaxed == n)
+                {
+                    relaxed = 0;
+                    if (spfa_find_cycle(pred, walk, cycle))
+                        return spfa_finish(g, vertex_of, dist, pred, cycle,
+                            distance, predecessor, negative_cycle);
+                }
+            }
+        }
+        return spfa_finish(g, vertex_of, dist, pred, cycle, distance,
+            predecessor, negative_cycle);
+    }
+
+    template < typename Graph, typename SourceInputIter, typename WeightMap,
+        typename DistanceMap, typename PredecessorMap,
+        typename VertexIndexMap, typename OutputIterator >
+    bool parallel_bellman_ford_impl(const Graph& g, SourceInputIter s_begin,
+        SourceInputIter s_end, WeightMap weight, DistanceMap distance,
+        PredecessorMap predecessor, VertexIndexMap index,
+        OutputIterator negative_cycle, std::size_t num_threads)
+    {
+        BOOST_CONCEPT_ASSERT((IncidenceGraphConcept< Graph >));
+        BOOST_CONCEPT_ASSERT((VertexListGraphConcept< Graph >));
+        typedef typename property_traits< DistanceMap >::value_type Distance;
+        typedef typename graph_traits< Graph >::out_edge_iterator OutEdgeIter;
+        using boost::graph::detail::parallel_for_blocks;
+        const std::size_t n = num_vertices(g);
+        const Distance inf = (std::numeric_limits< Distance >::max)();
+        num_threads = boost::graph::detail::resolve_num_threads(num_threads);
+
+        std::vector< typename graph_traits< Graph >::vertex_descriptor >
+            vertex_of = spfa_vertices(g, index);
+        std::vector< spfa_atomic< Distance > > dist(n);
+        std::vector< spfa_lock > locks(n);
+        std::vector< std::size_t > pred(n), walk, cycle;
+        // The round in which each vertex last joined the next frontier
+        std::vector< spfa_atomic< std::size_t > > joined(n);
+        parallel_for_blocks(n, num_threads,
+            [&](std::size_t, std::size_t first, std::size_t last) {
+                for (std::size_t v = first; v < last; ++v)
+                {
+                    dist[v].store(inf);
+                    pred[v] = v;
+                    joined[v].store(std::size_t(-1));
+                }
+            });
+        // Shared state, written by worker 0 between barriers
+        std::vector< std::size_t > frontier;
+        for (; s_begin != s_end; ++s_begin)
+        {
+            const std::size_t src = get(index, *s_begin);
+            if (dist[src].load() != Distance(0))
+                frontier.push_back(src);
+            dist[src].store(Distance(0));
+        }
+        std::vector< std::vector< std::size_t > > next(num_threads);
+        std::vector< std::size_t > relaxed(num_threads, 0);
+        std::vector< std::size_t > self_loop(num_threads, n);
+        spfa_atomic< std::size_t > next_chunk;
+        std::size_t since_check = 0;
+        bool done = false;
+
+        typedef boost::graph::detail::thread_barrier barrier_type;
+        boost::graph::detail::run_with_barrier(num_threads, [&](std::size_t t,
+                                                  barrier_type& barrier) {
+            for (std::size_t round = 0;; ++round)
+            {
+                // Relax the out-edges of the vertices changed last round,
+                // collecting those changed now
+                const std::size_t size = frontier.size();
+                for (;;)
+                {
+                    std::size_t first = next_chunk.fetch_add(spfa_grain);
+                    if (first >= size)
+                        break;
+                    std::size_t last = (std::min)(size, first + spfa_grain);
+                    for (std::size_t i = first; i < last; ++i)
+                    {
+                        std::size_t u = frontier[i];
+                        Distance du = dist[u].load();
+                        OutEdgeIter ei, ei_end;
+                        for (boost::tie(ei, ei_end)
+                             = out_edges(vertex_of[u], g);
+                             ei != ei_end; ++ei)
+                        {
+                            std::size_t v = get(index, target(*ei, g));
+                            Distance d = Distance(du + get(weight, *ei));
+                            if (!(d < dist[v].load()))
+                                continue;
+                            if (v == u)
+                            {
+                                self_loop[t] = u;
+                                continue;
+                            }
+                            locks[v].lock();
+                            bool better = d < dist[v].load();
+                            if (better)
+                            {
+                                dist[v].store(d);
+                                pred[v] = u;
+                            }
+                            locks[v].unlock();
+                            if (better)
+                            {
+                                ++relaxed[t];
+                                if (joined[v].exchange(round) != round)
+                                    next[t].push_back(v);
+                            }
+                        }
+                    }
+                }
+                barrier.wait();
+                if (t == 0)
+                {
+                    frontier.clear();
+                    for (std::size_t k = 0; k < num_threads; ++k)
+                    {
+                        frontier.insert(
+                            frontier.end(), next[k].begin(), next[k].end());
+                        next[k].clear();
+                        since_check += relaxed[k];
+                        relaxed[k] = 0;
+                        if (self_loop[k] != n && !done)
+                        {
+                            cycle.assign(1, self_loop[k]);
+                            done = true;
+                        }
+                    }
+                    if (!done && since_check >= n)
+                    {
+                        since_check = 0;
+                        done = spfa_find_cycle(pred, walk, cycle);
+                    }
+                    done = done || frontier.empty();
+                    next_chunk.store(0);
+                }
+                barrier.wait();
+                if (done)
+                    break;
+            }
+        });
+        return spfa_finish(g, vertex_of, dist, pred, cycle, distance,
+            predecessor, negative_cycle);
+    }
+
+    template < typename Graph, typename WeightMap, typename DistanceMap,
+        typename OutputIterator, typename P, typename T, typename R >
+    bool spfa_dispatch(const Graph& g,
+        typename graph_traits< Graph >::vertex_descriptor s, WeightMap weight,
+        DistanceMap distance, OutputIterator negative_cycle, bool parallel,
+        const bgl_named_params< P, T, R >& params)
+    {
+        if (parallel)
+            return parallel_bellman_ford_impl(g, &s, &s + 1, weight, distance,
+                choose_param(get_param(params, vertex_predecessor),
+                    dummy_property_map()),
+                choose_const_pmap(
+                    get_param(params, vertex_index), g, vertex_index),
+                negative_cycle,
+                choose_param(
+                    get_param(params, num_threads_t()), std::size_t(0)));
+        return spfa_impl(g, &s, &s + 1, weight, distance,
+            choose_param(
+                get_param(params, vertex_predecessor), dummy_property_map()),
+            choose_const_pmap(get_param(params, vertex_index), g, vertex_index),
+            negative_cycle);
+    }
+
+    template < typename Graph, typename WeightMap, typename OutputIterator,
+        typename P, typename T, typename R >
+    bool spfa_dispatch(const Graph& g,
+        typename graph_traits< Graph >::vertex_descriptor s, WeightMap weight,
+        param_not_found, OutputIterator negative_cycle, bool parallel,
+        const bgl_named_params< P, T, R >& params)
+    {
+        typedef typename property_traits< WeightMap >::value_type Weight;
+        std::vector< Weight > distance(num_vertices(g));
+        return spfa_dispatch(g, s, weight,
+            make_iterator_property_map(distance.begin(),
+                choose_const_pmap(
+                    get_param(params, vertex_index), g, vertex_index)),
+            negative_cycle, parallel, params);
+    }
+} // namespace detail
+
+// Computes shortest-path distances from s and a shortest-path tree for edge
+// weights of any sign, by a FIFO worklist.  Returns true on success; if a
+// negative cycle is reachable from s, writes its vertices to
+// negative_cycle in the order of its edges (the last leading back to the
+// first) and returns false, leaving the distances and predecessors in an
+// intermediate state.  Unreached vertices get the largest distance value
+// and themselves as predecessor.
+template < typename Graph, typename WeightMap, typename DistanceMap,
+    typename PredecessorMap, typename VertexIndexMap,
+    typename OutputIterator >
+bool spfa_shortest_paths(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s, WeightMap weight,
+    DistanceMap distance, PredecessorMap predecessor, VertexIndexMap index,
+    OutputIterator negative_cycle)
+{
+    return detail::spfa_impl(
+        g, &s, &s + 1, weight, distance, predecessor, index, negative_cycle);
+}
+
+// Named parameter version: weight_map, distance_map, predecessor_map and
+// vertex_index_map
+template < typename Graph, typename OutputIterator, typename P, typename T,
+    typename R >
+bool spfa_shortest_paths(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s,
+    OutputIterator negative_cycle, const bgl_named_params< P, T, R >& params)
+{
+    return detail::spfa_dispatch(g, s,
+        choose_const_pmap(get_param(params, edge_weight), g, edge_weight),
+        get_param(params, vertex_distance), negative_cycle, false, params);
+}
+
+template < typename Graph, typename P, typename T, typename R >
+bool spfa_shortest_paths(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s,
+    const bgl_named_params< P, T, R >& params)
+{
+    std::vector< typename graph_traits< Graph >::vertex_descriptor > cycle;
+    return spfa_shortest_paths(g, s, std::back_inserter(cycle), params);
+}
+
+// Like spfa_shortest_paths, but in rounds: each round relaxes the
+// out-edges of the vertices whose distance dropped in the previous one, on
+// num_threads threads (0 for one per hardware thread).  The round count is
+// at most the number of edges on the longest shortest path.
+template < typename Graph, typename WeightMap, typename DistanceMap,
+    typename PredecessorMap, typename VertexIndexMap,
+    typename OutputIterator >
+bool parallel_bellman_ford_shortest_paths(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s, WeightMap weight,
+    DistanceMap distance, PredecessorMap predecessor, VertexIndexMap index,
+    OutputIterator negative_cycle, std::size_t num_threads = 0)
+{
+    return detail::parallel_bellman_ford_impl(g, &s, &s + 1, weight,
+        distance, predecessor, index, negative_cycle, num_threads);
+}
+
+// Named parameter version: weight_map, distance_map, predecessor_map,
+// vertex_index_map and num_threads
+template < typename Graph, typename OutputIterator, typename P, typename T,
+    typename R >
+bool parallel_bellman_ford_shortest_paths(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s,
+    OutputIterator negative_cycle, const bgl_named_params< P, T, R >& params)
+{
+    return detail::spfa_dispatch(g, s,
+        choose_const_pmap(get_param(params, edge_weight), g, edge_weight),
+        get_param(params, vertex_distance), negative_cycle, true, params);
+}
+
+template < typename Graph, typename P, typename T, typename R >
+bool parallel_bellman_ford_shortest_paths(const Graph& g,
+    typename graph_traits< Graph >::vertex_descriptor s,
+    const bgl_named_params< P, T, R >& params)
+{
+    std::vector< typename graph_traits< Graph >::vertex_descriptor > cycle;
+    return parallel_bellman_ford_shortest_paths(
+        g, s, std::back_inserter(cycle), params);
+}
+
+} // namespace boost
+
+#endif // BOOST_GRAPH_SPFA_SHORTEST_PATHS_HPP
@@ -0,0 +1,240 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#include <boost/graph/alt_heuristic.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/astar_search.hpp>
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/graph/iteration_macros.hpp>
+#include <boost/graph/reverse_graph.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+typedef boost::adjacency_list< boost::vecS, boost::vecS,
+    boost::bidirectionalS, boost::no_property,
+    boost::property< boost::edge_weight_t, unsigned > >
+    Graph;
+typedef boost::graph_traits< Graph >::vertex_descriptor Vertex;
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::undirectedS,
+    boost::no_property, boost::property< boost::edge_weight_t, unsigned > >
+    UGraph;
+
+const unsigned inf = (std::numeric_limits< unsigned >::max)();
+
+// A grid of two-way streets with different lengths in each direction, and
+// a few vertices that nothing leads to
+Graph make_grid(std::size_t side, int seed)
+{
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_int_distribution< unsigned > wdist(1, 9);
+    Graph g(side * side + 3);
+    for (std::size_t v = 0; v < side * side; ++v)
+    {
+        if (v % side + 1 < side)
+        {
+            add_edge(v, v + 1, wdist(gen), g);
+            add_edge(v + 1, v, wdist(gen), g);
+        }
+        if (v + side < side * side)
+        {
+            add_edge(v, v + side, wdist(gen), g);
+            add_edge(v + side, v, wdist(gen), g);
+        }
+    }
+    for (std::size_t i = 0; i < 3; ++i)
+        add_edge(side * side + i, i * side, 1, g);
+    return g;
+}
+
+template < typename G >
+std::vector< unsigned > distances_from(const G& g, Vertex s)
+{
+    std::vector< unsigned > d(num_vertices(g));
+    boost::dijkstra_shortest_paths(g, s,
+        boost::distance_map(boost::make_iterator_property_map(
+            d.begin(), get(boost::vertex_index, g))));
+    return d;
+}
+
+// The tables match plain Dijkstra runs from and to each landmark
+template < typename G >
+void check_tables(const G& g, const boost::alt_landmarks< unsigned >& lm)
+{
+    for (std::size_t i = 0; i < lm.num_landmarks(); ++i)
+    {
+        std::vector< unsigned > from = distances_from(g, lm.landmark(i));
+        std::vector< unsigned > to
+            = distances_from(boost::make_reverse_graph(g), lm.landmark(i));
+        for (std::size_t v = 0; v < num_vertices(g); ++v)
+        {
+            BOOST_TEST_EQ(lm.distance_from_landmark(i, v), from[v]);
+            BOOST_TEST_EQ(lm.distance_to_landmark(i, v), to[v]);
+        }
+    }
+}
+
+struct found_goal
+{
+};
+
+// Counts the examined vertices and stops at the goal
+struct goal_visitor : public boost::default_astar_visitor
+{
+    goal_visitor(Vertex goal, std::size_t& examined)
+    : m_goal(goal), m_examined(&examined)
+    {
+    }
+
+    void examine_vertex(Vertex u, const Graph&)
+    {
+        ++*m_examined;
+        if (u == m_goal)
+            throw found_goal();
+    }
+
+    Vertex m_goal;
+    std::size_t* m_examined;
+};
+
+template < typename Heuristic >
+unsigned astar_distance(
+    const Graph& g, Vertex s, Vertex t, Heuristic h, std::size_t& examined)
+{
+    std::vector< unsigned > d(num_vertices(g));
+    try
+    {
+        boost::astar_search(g, s, h,
+            boost::distance_map(boost::make_iterator_property_map(
+                                    d.begin(), get(boost::vertex_index, g)))
+                .visitor(goal_visitor(t, examined)));
+    }
+    catch (found_goal&)
+    {
+    }
+    return d[t];
+}
+
+void test_selection(boost::landmark_selection selection)
+{
+    Graph g = make_grid(40, 3);
+    boost::alt_landmarks< unsigned > lm(g, 6, selection,
+        get(boost::edge_weight, g), get(boost::vertex_index, g));
+    BOOST_TEST_EQ(lm.num_landmarks(), 6u);
+    std::vector< std::size_t > chosen;
+    for (std::size_t i = 0; i < lm.num_landmarks(); ++i)
+        chosen.push_back(lm.landmark(i));
+    std::sort(chosen.begin(), chosen.end());
+    BOOST_TEST(std::unique(chosen.begin(), chosen.end()) == chosen.end());
+    check_tables(g, lm);
+
+    // Admissible and consistent along every edge
+    boost::minstd_rand gen(7);
+    boost::random::uniform_int_distribution< std::size_t > vdist(
+        0, num_vertices(g) - 1);
+    for (int q = 0; q < 20; ++q)
+    {
+        Vertex t = vdist(gen);
+        std::vector< unsigned > to_t
+            = distances_from(boost::make_reverse_graph(g), t);
+        boost::alt_heuristic< Graph, unsigned > h
+            = boost::make_alt_heuristic(g, lm, t);
+        BOOST_TEST_EQ(h(t), 0u);
+        BGL_FORALL_EDGES(e, g, Graph)
+        {
+            Vertex u = source(e, g), v = target(e, g);
+            BOOST_TEST(h(u) <= get(boost::edge_weight, g, e) + h(v));
+            if (to_t[u] != inf)
+                BOOST_TEST(h(u) <= to_t[u]);
+        }
+    }
+}
+
+void test_astar()
+{
+    Graph g = make_grid(60, 5);
+    boost::alt_landmarks< unsigned > lm(g, 8, boost::avoid_landmarks,
+        get(boost::edge_weight, g), get(boost::vertex_index, g), 2);
+    std::size_t plain = 0, alt = 0, active = 0;
+    for (std::size_t q = 0; q < 20; ++q)
+    {
+        Vertex s = (q * 733) % 3600, t = (q * 1291 + 1800) % 3600;
+        unsigned expected = distances_from(g, s)[t];
+        BOOST_TEST_EQ(astar_distance(g, s, t,
+                          boost::astar_heuristic< Graph, unsigned >(), plain),
+            expected);
+        BOOST_TEST_EQ(
+            astar_distance(g, s, t, boost::make_alt_heuristic(g, lm, t), alt),
+            expected);
+        BOOST_TEST_EQ(astar_distance(g, s, t,
+                          boost::make_alt_heuristic(g, lm, s, t, 2), active),
+            expected);
+    }
+    // Landmarks shrink the search space severalfold
+    BOOST_TEST(alt * 5 < plain);
+    BOOST_TEST(active < plain);
+}
+
+void test_given_landmarks()
+{
+    Graph g = make_grid(20, 9);
+    std::vector< Vertex > landmarks;
+    landmarks.push_back(0);
+    landmarks.push_back(399);
+    landmarks.push_back(400);
+    boost::alt_landmarks< unsigned > lm(g, landmarks.begin(), landmarks.end(),
+        get(boost::edge_weight, g), get(boost::vertex_index, g), 3);
+    BOOST_TEST_EQ(lm.num_landmarks(), 3u);
+    BOOST_TEST_EQ(lm.landmark(1), 399u);
+    check_tables(g, lm);
+    // Nothing leads to vertex 400, so its table says little
+    BOOST_TEST_EQ(lm.distance_to_landmark(2, 0), inf);
+    BOOST_TEST_EQ(lm.lower_bound(5, 5), 0u);
+}
+
+void test_undirected()
+{
+    boost::minstd_rand gen(11);
+    boost::random::uniform_int_distribution< std::size_t > vdist(0, 299);
+    boost::random::uniform_int_distribution< unsigned > wdist(1, 50);
+    UGraph g(300);
+    for (int i = 0; i < 600; ++i)
+        add_edge(vdist(gen), vdist(gen), wdist(gen), g);
+    boost::alt_landmarks< unsigned > lm(g, 4, boost::farthest_landmarks,
+        get(boost::edge_weight, g), get(boost::vertex_index, g));
+    check_tables(g, lm);
+    for (std::size_t s = 0; s < 300; s += 13)
+    {
+        std::vector< unsigned > d = distances_from(g, s);
+        for (std::size_t t = 0; t < 300; t += 7)
+            if (d[t] != inf)
+                BOOST_TEST(lm.lower_bound(s, t) <= d[t]);
+    }
+
+    // More landmarks than vertices
+    UGraph tiny(2);
+    add_edge(0, 1, 4, tiny);
+    boost::alt_landmarks< unsigned > all(tiny, 5, boost::avoid_landmarks,
+        get(boost::edge_weight, tiny), get(boost::vertex_index, tiny));
+    BOOST_TEST_EQ(all.num_landmarks(), 2u);
+    BOOST_TEST_EQ(all.lower_bound(0, 1), 4u);
+}
+
+int main()
+{
+    test_selection(boost::farthest_landmarks);
+    test_selection(boost::avoid_landmarks);
+    test_astar();
+    test_given_landmarks();
+    test_undirected();
+    return boost::report_errors();
+}
@@ -0,0 +1,193 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#include <boost/graph/betweenness_centrality.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::directedS,
+    boost::no_property, boost::property< boost::edge_weight_t, int > >
+    Graph;
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::undirectedS,
+    boost::no_property, boost::property< boost::edge_weight_t, int > >
+    UGraph;
+
+template < typename G > G make_graph(std::size_t n, std::size_t m, int seed)
+{
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_int_distribution< std::size_t > vdist(0, n - 1);
+    boost::random::uniform_int_distribution< int > wdist(1, 3);
+    G g(n);
+    for (std::size_t i = 0; i < m; ++i)
+        add_edge(vdist(gen), vdist(gen), wdist(gen), g);
+    return g;
+}
+
+// The largest difference of relative betweenness
+template < typename G >
+double relative_error(const G& g, std::vector< double > estimate,
+    std::vector< double > exact)
+{
+    boost::relative_betweenness_centrality(g, estimate.data());
+    boost::relative_betweenness_centrality(g, exact.data());
+    double error = 0;
+    for (std::size_t i = 0; i < exact.size(); ++i)
+        error = (std::max)(error, std::abs(estimate[i] - exact[i]));
+    return error;
+}
+
+void test_unweighted()
+{
+    Graph g = make_graph< Graph >(2000, 8000, 1);
+    std::vector< double > exact(2000);
+    boost::brandes_betweenness_centrality(g, exact.data());
+
+    boost::mt19937 gen(42);
+    std::vector< double > uniform(2000), adaptive(2000);
+    boost::approximate_betweenness_result u
+        = boost::approximate_betweenness_centrality(g, uniform.data(), 0.2,
+            0.1, gen, boost::uniform_sampling, 0, get(boost::vertex_index, g),
+            2);
+    BOOST_TEST(u.samples > 0 && u.samples < 2000);
+    BOOST_TEST(u.epsilon <= 0.2);
+    BOOST_TEST_EQ(u.delta, 0.1);
+    BOOST_TEST(relative_error(g, uniform, exact) <= u.epsilon);
+
+    // The centralities vary little, so the adaptive bound is met early
+    boost::approximate_betweenness_result a
+        = boost::approximate_betweenness_centrality(
+            g, adaptive.data(), 0.2, 0.1, gen);
+    BOOST_TEST(a.epsilon <= 0.2);
+    BOOST_TEST(a.samples < u.samples);
+    BOOST_TEST(relative_error(g, adaptive, exact) <= a.epsilon);
+
+    // A cap below the required sample size gives a weaker guarantee
+    std::vector< double > capped(2000);
+    boost::approximate_betweenness_result c
+        = boost::approximate_betweenness_centrality(g, capped.data(), 0.02,
+            0.1, gen, boost::adaptive_sampling, 300,
+            get(boost::vertex_index, g), 3);
+    BOOST_TEST_EQ(c.samples, 300u);
+    BOOST_TEST(c.epsilon > 0.02);
+    BOOST_TEST(relative_error(g, capped, exact) <= c.epsilon);
+
+    // More samples than sources: every source once instead
+    std::vector< double > all(2000);
+    boost::approximate_betweenness_result e
+        = boost::approximate_betweenness_centrality(g, all.data(), 0.001,
+            0.1, gen, boost::uniform_sampling, 0, get(boost::vertex_index, g),
+            2);
+    BOOST_TEST_EQ(e.samples, 2000u);
+    BOOST_TEST_EQ(e.epsilon, 0.0);
+    BOOST_TEST(relative_error(g, all, exact) < 1e-12);
+}
+
+void test_weighted_undirected()
+{
+    UGraph g = make_graph< UGraph >(1500, 3000, 2);
+    std::vector< double > exact(1500), estimate(1500);
+    boost::brandes_betweenness_centrality(g,
+        boost::centrality_map(exact.data())
+            .weight_map(get(boost::edge_weight, g)));
+
+    boost::mt19937 gen(7);
+    boost::approximate_betweenness_result r
+        = boost::approximate_betweenness_centrality(g, estimate.data(), 0.08,
+            0.05, gen,
+            boost::weight_map(get(boost::edge_weight, g)).num_threads(2));
+    BOOST_TEST(r.samples < 1500);
+    BOOST_TEST(r.epsilon <= 0.08);
+    BOOST_TEST(relative_error(g, estimate, exact) <= r.epsilon);
+
+    // The same through the positional version
+    r = boost::approximate_betweenness_centrality(g, estimate.data(), 0.08,
+        0.05, gen, boost::uniform_sampling, 0, get(boost::vertex_index, g),
+        get(boost::edge_weight, g), 1);
+    BOOST_TEST(r.samples < 1500);
+    BOOST_TEST(relative_error(g, estimate, exact) <= 0.08);
+}
+
+// Relative betweenness is 2 / ((n - 1)(n - 2)) times the absolute one on
+// directed graphs too, where each sample lies in [0, 2n / (n - 1)]
+void test_directed_bound()
+{
+    // Sources before the hub depend on it for every later vertex, those
+    // after it for none, so that the samples vary as much as they can
+    const std::size_t m = 150, n = 2 * m + 1;
+    Graph g(n);
+    for (std::size_t i = 0; i < m; ++i)
+    {
+        add_edge(i, m, 1, g);
+        add_edge(m, m + 1 + i, 1, g);
+    }
+    std::vector< double > exact(n);
+    boost::brandes_betweenness_centrality(g, exact.data());
+
+    const double epsilon = 0.5, delta = 0.1;
+    const double nd = double(n), range = 2 * nd / (nd - 1);
+    const double hoeffding_log = std::log(2 * nd / delta);
+    boost::mt19937 gen(3);
+    for (int run = 0; run < 20; ++run)
+    {
+        std::vector< double > estimate(n);
+        boost::approximate_betweenness_result r
+            = boost::approximate_betweenness_centrality(g, estimate.data(),
+                epsilon, delta, gen, boost::uniform_sampling, 0,
+                get(boost::vertex_index, g), 1);
+        BOOST_TEST_EQ(r.samples,
+            std::size_t(std::ceil(range * range * hoeffding_log
+                / (2 * epsilon * epsilon))));
+        BOOST_TEST(std::abs(r.epsilon
+                       - range * std::sqrt(hoeffding_log / (2 * r.samples)))
+            < 1e-12);
+        BOOST_TEST(r.epsilon <= epsilon);
+        BOOST_TEST(relative_error(g, estimate, exact) <= r.epsilon);
+
+        // With a cap the bound is looser, but must still hold
+        r = boost::approximate_betweenness_centrality(g, estimate.data(),
+            epsilon, delta, gen, boost::adaptive_sampling, 8,
+            get(boost::vertex_index, g), 1);
+        BOOST_TEST_EQ(r.samples, 8u);
+        BOOST_TEST(relative_error(g, estimate, exact) <= r.epsilon);
+    }
+}
+
+void test_small_and_invalid()
+{
+    Graph g(2);
+    add_edge(0, 1, 1, g);
+    std::vector< double > c(2, -1);
+    boost::mt19937 gen;
+    boost::approximate_betweenness_result r
+        = boost::approximate_betweenness_centrality(g, c.data(), 0.1, 0.1, gen);
+    BOOST_TEST_EQ(r.samples, 0u);
+    BOOST_TEST_EQ(c[0], 0.0);
+    BOOST_TEST_EQ(c[1], 0.0);
+
+    BOOST_TEST_THROWS(boost::approximate_betweenness_centrality(
+                          g, c.data(), 0.0, 0.1, gen),
+        std::invalid_argument);
+    BOOST_TEST_THROWS(boost::approximate_betweenness_centrality(
+                          g, c.data(), 0.1, 1.0, gen),
+        std::invalid_argument);
+}
+
+int main()
+{
+    test_unweighted();
+    test_weighted_undirected();
+    test_directed_bound();
+    test_small_and_invalid();
+    return boost::report_errors();
+}
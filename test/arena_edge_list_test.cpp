@@ -0,0 +1,255 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#include <boost/graph/arena_edge_list.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/iteration_macros.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+typedef boost::property< boost::edge_weight_t, int > Weight;
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::directedS,
+    boost::no_property, Weight >
+    VecGraph;
+typedef boost::adjacency_list< boost::arenaS<>, boost::vecS,
+    boost::directedS, boost::no_property, Weight >
+    ArenaGraph;
+typedef boost::adjacency_list< boost::arenaS< 2 >, boost::vecS,
+    boost::bidirectionalS, boost::no_property, Weight >
+    BidirArenaGraph;
+typedef boost::adjacency_list< boost::arenaS< 3 >, boost::listS,
+    boost::undirectedS >
+    UndirArenaGraph;
+
+void test_small_edge_vector()
+{
+    typedef boost::detail::small_edge_vector< std::string, 3 > Vec;
+    Vec v;
+    BOOST_TEST(v.empty());
+    BOOST_TEST_EQ(v.capacity(), 3u);
+    std::vector< std::string > expected;
+    for (int i = 0; i < 100; ++i)
+    {
+        v.push_back(std::string(i % 7 + 20, char('a' + i % 26)));
+        expected.push_back(v.back());
+        if (i == 2)
+            BOOST_TEST_EQ(v.capacity(), 3u);
+    }
+    BOOST_TEST(std::equal(v.begin(), v.end(), expected.begin()));
+    BOOST_TEST(v.capacity() >= 100u);
+
+    // Pushing an element of the vector itself while it grows
+    Vec w;
+    for (int i = 0; i < 3; ++i)
+        w.push_back("x");
+    w.push_back(w[0]);
+    BOOST_TEST_EQ(w.size(), 4u);
+    BOOST_TEST_EQ(w[3], "x");
+
+    // Copies and moves of inline and arena-backed vectors
+    Vec copy(v);
+    BOOST_TEST(copy == v);
+    Vec moved(std::move(copy));
+    BOOST_TEST(moved == v);
+    BOOST_TEST(copy.empty());
+    BOOST_TEST_EQ(copy.capacity(), 3u);
+    Vec small;
+    small.push_back("s");
+    Vec small_moved(std::move(small));
+    BOOST_TEST_EQ(small_moved.size(), 1u);
+    BOOST_TEST_EQ(small_moved[0], "s");
+    swap(small_moved, moved);
+    BOOST_TEST_EQ(moved.size(), 1u);
+    BOOST_TEST(small_moved == v);
+
+    // Erasing, then returning the remaining elements inline
+    v.erase(v.begin() + 1, v.end() - 2);
+    BOOST_TEST_EQ(v.size(), 3u);
+    BOOST_TEST_EQ(v[0], expected[0]);
+    BOOST_TEST_EQ(v[1], expected[98]);
+    BOOST_TEST_EQ(v[2], expected[99]);
+    v.shrink_to_fit();
+    BOOST_TEST_EQ(v.capacity(), 3u);
+    BOOST_TEST_EQ(v[2], expected[99]);
+    v.erase(v.begin());
+    BOOST_TEST_EQ(v[0], expected[98]);
+    v.clear();
+    BOOST_TEST(v.empty());
+}
+
+template < typename Graph >
+std::vector< std::pair< int, int > > sorted_edges(const Graph& g)
+{
+    std::vector< std::pair< int, int > > result;
+    BGL_FORALL_EDGES_T(e, g, Graph)
+    result.push_back(std::make_pair(int(source(e, g)), int(target(e, g))));
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+void test_against_vecS()
+{
+    const int n = 500;
+    boost::minstd_rand gen(17);
+    boost::random::uniform_int_distribution< int > vdist(0, n - 1);
+    boost::random::uniform_int_distribution< int > wdist(1, 20);
+    VecGraph vg(n);
+    ArenaGraph ag(n);
+    for (int i = 0; i < 3000; ++i)
+    {
+        int u = vdist(gen), v = vdist(gen), w = wdist(gen);
+        // A few hubs push their lists past the largest arena block
+        if (i % 4 == 0)
+            u = i % 8 / 4;
+        add_edge(u, v, Weight(w), vg);
+        add_edge(u, v, Weight(w), ag);
+    }
+    BOOST_TEST(sorted_edges(vg) == sorted_edges(ag));
+    BGL_FORALL_VERTICES(v, ag, ArenaGraph)
+    {
+        BOOST_TEST_EQ(out_degree(v, ag), out_degree(v, vg));
+        // Short lists stay inside the vertex
+        if (out_degree(v, ag) <= 4)
+            BOOST_TEST_EQ(ag.out_edge_list(v).capacity(), 4u);
+    }
+
+    std::vector< int > d1(n), d2(n);
+    boost::dijkstra_shortest_paths(vg, 0, boost::distance_map(&d1[0]));
+    boost::dijkstra_shortest_paths(ag, 0, boost::distance_map(&d2[0]));
+    BOOST_TEST(d1 == d2);
+
+    // Removal through every interface
+    for (int u = 0; u < n; u += 7)
+    {
+        int v = vdist(gen);
+        remove_edge(u, v, vg);
+        remove_edge(u, v, ag);
+    }
+    remove_out_edge_if(std::size_t(1),
+        [&](ArenaGraph::edge_descriptor e) {
+            return get(boost::edge_weight, ag, e) > 10;
+        },
+        ag);
+    remove_out_edge_if(std::size_t(1),
+        [&](VecGraph::edge_descriptor e) {
+            return get(boost::edge_weight, vg, e) > 10;
+        },
+        vg);
+    remove_edge(*out_edges(2, ag).first, ag);
+    remove_edge(*out_edges(2, vg).first, vg);
+    clear_vertex(5, ag);
+    clear_vertex(5, vg);
+    remove_vertex(9, ag);
+    remove_vertex(9, vg);
+    BOOST_TEST(sorted_edges(vg) == sorted_edges(ag));
+    int wsum = 0, vwsum = 0;
+    BGL_FORALL_EDGES(e, ag, ArenaGraph) wsum += get(boost::edge_weight, ag, e);
+    BGL_FORALL_EDGES(e, vg, VecGraph) vwsum += get(boost::edge_weight, vg, e);
+    BOOST_TEST_EQ(wsum, vwsum);
+
+    // Copies, and vertices added after the lists were filled
+    ArenaGraph copy(ag);
+    BOOST_TEST(sorted_edges(copy) == sorted_edges(ag));
+    for (int i = 0; i < 100; ++i)
+        add_vertex(ag);
+    BOOST_TEST(sorted_edges(copy) == sorted_edges(ag));
+}
+
+void test_bidirectional_and_undirected()
+{
+    BidirArenaGraph g(6);
+    for (int i = 0; i < 6; ++i)
+        for (int j = 0; j < 6; ++j)
+            if (i != j && (i + j) % 2 == 0)
+                add_edge(i, j, Weight(i * 10 + j), g);
+    add_edge(0, 1, Weight(1), g);
+    add_edge(0, 1, Weight(2), g);
+    BOOST_TEST_EQ(out_degree(0, g), 4u);
+    BOOST_TEST_EQ(in_degree(1, g), 4u);
+    BGL_FORALL_INEDGES(std::size_t(4), e, g, BidirArenaGraph)
+    BOOST_TEST_EQ(get(boost::edge_weight, g, e), int(source(e, g)) * 10 + 4);
+    remove_edge(0, 1, g);
+    BOOST_TEST_EQ(out_degree(0, g), 2u);
+    BOOST_TEST_EQ(in_degree(1, g), 2u);
+    clear_vertex(2, g);
+    BOOST_TEST_EQ(in_degree(0, g), 1u);
+    BOOST_TEST_EQ(in_degree(4, g), 1u);
+
+    UndirArenaGraph u;
+    std::vector< UndirArenaGraph::vertex_descriptor > vs;
+    for (int i = 0; i < 50; ++i)
+        vs.push_back(add_vertex(u));
+    for (int i = 0; i < 50; ++i)
+    {
+        add_edge(vs[i], vs[(i + 1) % 50], u);
+        add_edge(vs[0], vs[i], u);
+    }
+    // The self-loop at vs[0] counts twice
+    BOOST_TEST_EQ(degree(vs[0], u), 53u);
+    clear_vertex(vs[25], u);
+    remove_vertex(vs[25], u);
+    BOOST_TEST_EQ(num_edges(u), 97u);
+    BOOST_TEST_EQ(degree(vs[0], u), 52u);
+    BOOST_TEST_EQ(degree(vs[24], u), 2u);
+}
+
+// Each thread allocates from its own arena, and lists may outlive the
+// thread that grew them or be destroyed by another one
+void test_threads()
+{
+    typedef boost::detail::edge_list_arena Arena;
+    Arena* main_arena = &Arena::current();
+    Arena* worker_arena = 0;
+    ArenaGraph* built = 0;
+    std::thread worker([&] {
+        worker_arena = &Arena::current();
+        built = new ArenaGraph(100);
+        for (int i = 0; i < 100; ++i)
+            for (int j = 0; j < 20; ++j)
+                add_edge(i, (i + j) % 100, Weight(j), *built);
+    });
+    worker.join();
+    BOOST_TEST(worker_arena != main_arena);
+    BOOST_TEST_EQ(num_edges(*built), 2000u);
+    // Grows lists from the main thread's arena while older blocks still
+    // belong to the exited worker's arena
+    add_edge(0, 1, Weight(5), *built);
+    ArenaGraph copy(*built);
+    delete built;
+    BOOST_TEST_EQ(num_edges(copy), 2001u);
+
+    std::thread destroyer([&] {
+        ArenaGraph local(copy);
+        copy.clear();
+        BOOST_TEST_EQ(num_edges(local), 2001u);
+    });
+    destroyer.join();
+    BOOST_TEST_EQ(num_edges(copy), 0u);
+}
+
+int main()
+{
+    BOOST_CONCEPT_ASSERT((boost::MutableIncidenceGraphConcept< ArenaGraph >));
+    BOOST_CONCEPT_ASSERT((boost::VertexListGraphConcept< ArenaGraph >));
+    BOOST_CONCEPT_ASSERT((boost::BidirectionalGraphConcept< BidirArenaGraph >));
+    BOOST_CONCEPT_ASSERT((boost::MutableGraphConcept< UndirArenaGraph >));
+
+    test_small_edge_vector();
+    test_against_vecS();
+    test_bidirectional_and_undirected();
+    test_threads();
+    return boost::report_errors();
+}
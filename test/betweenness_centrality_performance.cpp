@@ -0,0 +1,93 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Compares brandes_betweenness_centrality with
+// parallel_brandes_betweenness_centrality on one thread and on several,
+// for a random directed graph without weights.
+//
+// Usage: betweenness_centrality_performance [num_vertices [average_degree
+//        [threads]]]
+
+#include <boost/graph/betweenness_centrality.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+typedef boost::compressed_sparse_row_graph< boost::directedS > Graph;
+
+bool close(const std::vector< double >& x, const std::vector< double >& y)
+{
+    for (std::size_t i = 0; i < x.size(); ++i)
+        if (std::abs(x[i] - y[i]) > 1e-9 * (1 + std::abs(y[i])))
+            return false;
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    std::size_t n = 5000;
+    std::size_t degree = 8;
+    std::size_t threads = 0;
+    if (argc > 1)
+        n = boost::lexical_cast< std::size_t >(argv[1]);
+    if (argc > 2)
+        degree = boost::lexical_cast< std::size_t >(argv[2]);
+    if (argc > 3)
+        threads = boost::lexical_cast< std::size_t >(argv[3]);
+    threads = boost::graph::detail::resolve_num_threads(threads);
+
+    boost::minstd_rand gen(5);
+    boost::random::uniform_int_distribution< std::size_t > vdist(0, n - 1);
+    std::vector< std::pair< std::size_t, std::size_t > > edge_list;
+    for (std::size_t i = 0; i < n * degree; ++i)
+        edge_list.push_back(std::make_pair(vdist(gen), vdist(gen)));
+    Graph g(boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), n);
+
+    typedef std::chrono::steady_clock clock;
+    std::vector< double > serial(n), one(n), many(n);
+    clock::time_point start = clock::now();
+    boost::brandes_betweenness_centrality(g, serial.data());
+    const double serial_seconds
+        = std::chrono::duration< double >(clock::now() - start).count();
+
+    start = clock::now();
+    boost::parallel_brandes_betweenness_centrality(
+        g, boost::centrality_map(one.data()).num_threads(1));
+    const double one_seconds
+        = std::chrono::duration< double >(clock::now() - start).count();
+    BOOST_TEST(close(one, serial));
+
+    start = clock::now();
+    boost::parallel_brandes_betweenness_centrality(
+        g, boost::centrality_map(many.data()).num_threads(threads));
+    const double many_seconds
+        = std::chrono::duration< double >(clock::now() - start).count();
+    BOOST_TEST(close(many, serial));
+
+    std::cout << n << " vertices, " << num_edges(g) << " edges\n"
+              << std::setprecision(3) << std::left << std::setw(32)
+              << "brandes" << std::right << std::setw(10) << serial_seconds
+              << " s\n"
+              << std::left << std::setw(32) << "parallel, num_threads(1)"
+              << std::right << std::setw(10) << one_seconds << " s\n"
+              << std::left << std::setw(32)
+              << "parallel, num_threads("
+            + boost::lexical_cast< std::string >(threads) + ")"
+              << std::right << std::setw(10) << many_seconds << " s\n";
+    return boost::report_errors();
+}
@@ -0,0 +1,279 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#include <boost/graph/bidirectional_dijkstra_shortest_path.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/graph/exception.hpp>
+#include <boost/graph/reverse_graph.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cmath>
+#include <cstdlib>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+typedef boost::adjacency_list< boost::vecS, boost::vecS,
+    boost::bidirectionalS, boost::no_property,
+    boost::property< boost::edge_weight_t, unsigned > >
+    Graph;
+typedef boost::graph_traits< Graph >::vertex_descriptor Vertex;
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::undirectedS,
+    boost::no_property, boost::property< boost::edge_weight_t, double > >
+    UGraph;
+
+const unsigned inf = (std::numeric_limits< unsigned >::max)();
+
+Graph make_graph(std::size_t n, std::size_t m, unsigned max_weight)
+{
+    boost::minstd_rand gen(5);
+    boost::random::uniform_int_distribution< std::size_t > vdist(0, n - 1);
+    boost::random::uniform_int_distribution< unsigned > wdist(0, max_weight);
+    Graph g(n);
+    for (std::size_t i = 0; i < m; ++i)
+        add_edge(vdist(gen), vdist(gen), wdist(gen), g);
+    return g;
+}
+
+template < typename G >
+std::vector< typename boost::property_traits< typename boost::property_map<
+    G, boost::edge_weight_t >::type >::value_type >
+reference_distances(
+    const G& g, typename boost::graph_traits< G >::vertex_descriptor s)
+{
+    typedef typename boost::property_traits< typename boost::property_map< G,
+        boost::edge_weight_t >::type >::value_type D;
+    std::vector< D > d(num_vertices(g));
+    boost::dijkstra_shortest_paths(g, s,
+        boost::distance_map(boost::make_iterator_property_map(
+            d.begin(), get(boost::vertex_index, g))));
+    return d;
+}
+
+// The path runs from s to t along edges whose weights add up to length
+template < typename G, typename D >
+bool valid_path(const G& g, const std::vector< std::size_t >& path,
+    std::size_t s, std::size_t t, D length)
+{
+    if (path.empty() || path.front() != s || path.back() != t)
+        return false;
+    D total = 0;
+    for (std::size_t i = 0; i + 1 < path.size(); ++i)
+    {
+        bool found = false;
+        D best = 0;
+        typename boost::graph_traits< G >::out_edge_iterator ei, ei_end;
+        for (boost::tie(ei, ei_end) = out_edges(path[i], g); ei != ei_end;
+             ++ei)
+            if (target(*ei, g) == path[i + 1]
+                && (!found || get(boost::edge_weight, g, *ei) < best))
+            {
+                best = get(boost::edge_weight, g, *ei);
+                found = true;
+            }
+        if (!found)
+            return false;
+        total += best;
+    }
+    return total == length;
+}
+
+void test_directed()
+{
+    Graph g = make_graph(400, 1200, 30);
+    boost::minstd_rand gen(9);
+    boost::random::uniform_int_distribution< std::size_t > vdist(0, 399);
+    std::size_t unreachable = 0;
+    for (int q = 0; q < 200; ++q)
+    {
+        std::size_t s = vdist(gen), t = q % 10 == 0 ? s : vdist(gen);
+        std::vector< unsigned > expected = reference_distances(g, s);
+        std::vector< std::size_t > path;
+        unsigned d = boost::bidirectional_dijkstra_shortest_path(
+            g, s, t, std::back_inserter(path), boost::vertex_index_map(
+                get(boost::vertex_index, g)));
+        BOOST_TEST_EQ(d, expected[t]);
+        if (d == inf)
+        {
+            BOOST_TEST(path.empty());
+            ++unreachable;
+        }
+        else
+            BOOST_TEST(valid_path(g, path, s, t, d));
+
+        // Searching the reversed graph from t to s gives the same length
+        path.clear();
+        boost::reverse_graph< Graph > r(g);
+        d = boost::bidirectional_dijkstra_shortest_path(r, t, s,
+            get(boost::edge_weight, r), get(boost::vertex_index, r),
+            std::back_inserter(path));
+        BOOST_TEST_EQ(d, expected[t]);
+        if (d != inf)
+            BOOST_TEST(valid_path(r, path, t, s, d));
+    }
+    BOOST_TEST(unreachable > 0);
+}
+
+void test_undirected()
+{
+    boost::minstd_rand gen(2);
+    boost::random::uniform_int_distribution< std::size_t > vdist(0, 299);
+    boost::random::uniform_int_distribution< int > wdist(1, 1000);
+    UGraph g(300);
+    for (int i = 0; i < 700; ++i)
+        add_edge(vdist(gen), vdist(gen), wdist(gen) / 100.0, g);
+    for (int q = 0; q < 100; ++q)
+    {
+        std::size_t s = vdist(gen), t = vdist(gen);
+        std::vector< double > expected = reference_distances(g, s);
+        std::vector< std::size_t > path;
+        double d = boost::bidirectional_dijkstra_shortest_path(
+            g, s, t, std::back_inserter(path), boost::weight_map(
+                get(boost::edge_weight, g)));
+        // The two searches may add the weights up in a different order
+        BOOST_TEST(std::abs(d - expected[t]) <= 1e-9 * (1 + expected[t])
+            || d == expected[t]);
+    }
+}
+
+// Counts the edges whose weight is read
+struct counting_weight_map
+{
+    typedef boost::graph_traits< Graph >::edge_descriptor key_type;
+    typedef unsigned value_type;
+    typedef unsigned reference;
+    typedef boost::readable_property_map_tag category;
+
+    friend unsigned get(const counting_weight_map& m, key_type e)
+    {
+        ++*m.count;
+        return get(boost::edge_weight, *m.g, e);
+    }
+
+    const Graph* g;
+    std::size_t* count;
+};
+
+// Manhattan distance on the grid, with unit minimum weight
+struct grid_heuristic
+{
+    unsigned operator()(Vertex v) const
+    {
+        long dx = long(v % side) - long(goal % side);
+        long dy = long(v / side) - long(goal / side);
+        return unsigned(std::labs(dx) + std::labs(dy));
+    }
+
+    std::size_t side;
+    Vertex goal;
+};
+
+void test_astar()
+{
+    const std::size_t side = 60;
+    boost::minstd_rand gen(4);
+    boost::random::uniform_int_distribution< unsigned > wdist(1, 4);
+    Graph g(side * side);
+    for (std::size_t v = 0; v < side * side; ++v)
+    {
+        if (v % side + 1 < side)
+        {
+            unsigned w = wdist(gen);
+            add_edge(v, v + 1, w, g);
+            add_edge(v + 1, v, w, g);
+        }
+        if (v + side < side * side)
+        {
+            unsigned w = wdist(gen);
+            add_edge(v, v + side, w, g);
+            add_edge(v + side, v, w, g);
+        }
+    }
+    std::size_t bidijkstra = 0, biastar = 0, dijkstra = 0;
+    for (std::size_t q = 0; q < 20; ++q)
+    {
+        Vertex s = (q * 131) % (side * side);
+        Vertex t = (q * 977 + 1234) % (side * side);
+        std::vector< unsigned > expected = reference_distances(g, s);
+        for (Vertex v = 0; v < num_vertices(g); ++v)
+            dijkstra += out_degree(v, g) * (expected[v] < expected[t]);
+
+        counting_weight_map w1 = { &g, &bidijkstra };
+        std::vector< std::size_t > path;
+        unsigned d = boost::bidirectional_dijkstra_shortest_path(g, s, t,
+            w1, get(boost::vertex_index, g), std::back_inserter(path));
+        BOOST_TEST_EQ(d, expected[t]);
+
+        counting_weight_map w2 = { &g, &biastar };
+        grid_heuristic to_t = { side, t }, to_s = { side, s };
+        path.clear();
+        d = boost::bidirectional_astar_shortest_path(g, s, t, to_t, to_s, w2,
+            get(boost::vertex_index, g), std::back_inserter(path));
+        BOOST_TEST_EQ(d, expected[t]);
+        BOOST_TEST(valid_path(g, path, s, t, d));
+
+        path.clear();
+        d = boost::bidirectional_astar_shortest_path(g, t, t, to_t, to_t,
+            std::back_inserter(path),
+            boost::weight_map(get(boost::edge_weight, g)));
+        BOOST_TEST_EQ(d, 0u);
+        BOOST_TEST_EQ(path.size(), 1u);
+    }
+    // Both searches stop well before covering the ball around s
+    BOOST_TEST(bidijkstra < dijkstra);
+    BOOST_TEST(biastar < bidijkstra);
+}
+
+void test_negative_edge()
+{
+    typedef boost::adjacency_list< boost::vecS, boost::vecS,
+        boost::bidirectionalS, boost::no_property,
+        boost::property< boost::edge_weight_t, int > >
+        IGraph;
+    IGraph g(3);
+    add_edge(0, 1, 1, g);
+    add_edge(1, 2, -3, g);
+    std::vector< std::size_t > path;
+    BOOST_TEST_THROWS(boost::bidirectional_dijkstra_shortest_path(g, 0, 2,
+                          std::back_inserter(path),
+                          boost::weight_map(get(boost::edge_weight, g))),
+        boost::negative_edge);
+}
+
+void test_long_paths()
+{
+    // The first path found, 0-1-4 of length 13 u, is longer than half the
+    // range of unsigned; the stopping test must still continue to find
+    // 0-2-3-4 of length 11 u
+    const unsigned u = inf / 20;
+    Graph g(5);
+    add_edge(0, 1, 8 * u, g);
+    add_edge(1, 4, 5 * u, g);
+    add_edge(0, 2, 3 * u, g);
+    add_edge(2, 3, 3 * u, g);
+    add_edge(3, 4, 5 * u, g);
+    std::vector< Vertex > path;
+    BOOST_TEST_EQ(boost::bidirectional_dijkstra_shortest_path(g, 0, 4,
+                      std::back_inserter(path),
+                      boost::weight_map(get(boost::edge_weight, g))),
+        11 * u);
+    BOOST_TEST_EQ(path.size(), 4u);
+}
+
+int main()
+{
+    test_directed();
+    test_undirected();
+    test_astar();
+    test_negative_edge();
+    test_long_paths();
+    return boost::report_errors();
+}
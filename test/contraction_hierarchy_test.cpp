@@ -0,0 +1,288 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#include <boost/graph/contraction_hierarchy.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/graph/exception.hpp>
+#include <boost/graph/iteration_macros.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+struct Road
+{
+    unsigned length;
+};
+typedef boost::compressed_sparse_row_graph< boost::directedS,
+    boost::no_property, Road >
+    CSRGraph;
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::undirectedS,
+    boost::no_property, boost::property< boost::edge_weight_t, double > >
+    UGraph;
+
+typedef boost::contraction_hierarchy< unsigned >::overlay_type Overlay;
+
+const unsigned inf = (std::numeric_limits< unsigned >::max)();
+
+// A grid with one-way streets of different lengths in each direction, some
+// missing blocks and a few long-distance roads
+CSRGraph make_road_graph(std::size_t side, int seed)
+{
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_int_distribution< unsigned > wdist(1, 20);
+    boost::random::uniform_int_distribution< int > keep(0, 7);
+    boost::random::uniform_int_distribution< std::size_t > vdist(
+        0, side * side - 1);
+    std::vector< std::pair< std::size_t, std::size_t > > edges;
+    std::vector< Road > roads;
+    const std::size_t n = side * side;
+    for (std::size_t v = 0; v < n; ++v)
+    {
+        std::size_t next[] = { v % side + 1 < side ? v + 1 : v,
+            v + side < n ? v + side : v };
+        for (int i = 0; i < 2; ++i)
+        {
+            if (next[i] == v || keep(gen) == 0)
+                continue;
+            Road there = { wdist(gen) }, back = { wdist(gen) };
+            edges.push_back(std::make_pair(v, next[i]));
+            roads.push_back(there);
+            if (keep(gen) != 0)
+            {
+                edges.push_back(std::make_pair(next[i], v));
+                roads.push_back(back);
+            }
+        }
+    }
+    for (std::size_t i = 0; i < n / 50; ++i)
+    {
+        Road r = { 60 * wdist(gen) };
+        edges.push_back(std::make_pair(vdist(gen), vdist(gen)));
+        roads.push_back(r);
+    }
+    return CSRGraph(boost::edges_are_unsorted_multi_pass, edges.begin(),
+        edges.end(), roads.begin(), n);
+}
+
+// The path runs from s to t along edges whose weights add up to length
+bool valid_path(const CSRGraph& g, const std::vector< std::size_t >& path,
+    std::size_t s, std::size_t t, unsigned length)
+{
+    if (path.empty() || path.front() != s || path.back() != t)
+        return false;
+    unsigned total = 0;
+    for (std::size_t i = 0; i + 1 < path.size(); ++i)
+    {
+        unsigned best = inf;
+        boost::graph_traits< CSRGraph >::out_edge_iterator ei, ei_end;
+        for (boost::tie(ei, ei_end) = out_edges(path[i], g); ei != ei_end;
+             ++ei)
+            if (target(*ei, g) == path[i + 1])
+                best = (std::min)(best, g[*ei].length);
+        if (best == inf)
+            return false;
+        total += best;
+    }
+    return total == length;
+}
+
+void check_queries(const CSRGraph& g,
+    const boost::contraction_hierarchy< unsigned >& ch, int seed)
+{
+    const std::size_t n = num_vertices(g);
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_int_distribution< std::size_t > vdist(0, n - 1);
+    boost::contraction_hierarchy_query< unsigned > query(ch);
+    std::size_t unreachable = 0;
+    for (int q = 0; q < 40; ++q)
+    {
+        std::size_t s = vdist(gen);
+        std::vector< unsigned > d(n);
+        boost::dijkstra_shortest_paths(g, s,
+            boost::weight_map(get(&Road::length, g))
+                .distance_map(boost::make_iterator_property_map(
+                    d.begin(), get(boost::vertex_index, g))));
+        for (int k = 0; k < 10; ++k)
+        {
+            std::size_t t = k == 0 ? s : vdist(gen);
+            BOOST_TEST_EQ(query.distance(s, t), d[t]);
+            std::vector< std::size_t > path;
+            unsigned length
+                = query.shortest_path(s, t, std::back_inserter(path));
+            BOOST_TEST_EQ(length, d[t]);
+            if (d[t] == inf)
+            {
+                BOOST_TEST(path.empty());
+                ++unreachable;
+            }
+            else
+                BOOST_TEST(valid_path(g, path, s, t, length));
+        }
+    }
+    BOOST_TEST(unreachable > 0);
+}
+
+void test_road_graph()
+{
+    CSRGraph g = make_road_graph(30, 1);
+    boost::contraction_hierarchy< unsigned > ch(
+        g, get(&Road::length, g), get(boost::vertex_index, g));
+    BOOST_TEST_EQ(ch.num_vertices(), num_vertices(g));
+
+    // The ranks are a permutation, and both overlays lead to higher ranks
+    std::vector< char > seen(num_vertices(g), 0);
+    for (std::size_t v = 0; v < num_vertices(g); ++v)
+        seen[ch.rank(v)] = 1;
+    BOOST_TEST(std::find(seen.begin(), seen.end(), 0) == seen.end());
+    const Overlay* overlays[] = { &ch.upward_graph(), &ch.downward_graph() };
+    for (std::size_t k = 0; k < 2; ++k)
+    {
+        BGL_FORALL_EDGES(e, *overlays[k], Overlay)
+        {
+            BOOST_TEST(ch.rank(source(e, *overlays[k]))
+                < ch.rank(target(e, *overlays[k])));
+        }
+    }
+    check_queries(g, ch, 2);
+
+    // A tiny witness limit only adds shortcuts
+    boost::contraction_hierarchy< unsigned > coarse(
+        g, get(&Road::length, g), get(boost::vertex_index, g), 1);
+    BOOST_TEST(num_edges(coarse.upward_graph())
+            + num_edges(coarse.downward_graph())
+        >= num_edges(ch.upward_graph()) + num_edges(ch.downward_graph()));
+    check_queries(g, coarse, 3);
+}
+
+void test_serialization()
+{
+    CSRGraph g = make_road_graph(20, 4);
+    boost::contraction_hierarchy< unsigned > ch(
+        g, get(&Road::length, g), get(boost::vertex_index, g));
+    std::stringstream ss;
+    boost::write_contraction_hierarchy(ss, ch);
+    boost::contraction_hierarchy< unsigned > loaded;
+    boost::read_contraction_hierarchy(ss, loaded);
+    BOOST_TEST_EQ(loaded.num_vertices(), ch.num_vertices());
+    BOOST_TEST_EQ(
+        num_edges(loaded.upward_graph()), num_edges(ch.upward_graph()));
+    check_queries(g, loaded, 5);
+
+    std::stringstream again;
+    boost::write_contraction_hierarchy(again, loaded);
+    std::stringstream first;
+    boost::write_contraction_hierarchy(first, ch);
+    BOOST_TEST(again.str() == first.str());
+
+    std::istringstream bad("contraction_hierarchy 1\n2 1 0\n0 1\n0 7 3 -1\n");
+    BOOST_TEST_THROWS(
+        boost::read_contraction_hierarchy(bad, loaded), boost::bad_graph);
+    std::istringstream wrong("something else");
+    BOOST_TEST_THROWS(
+        boost::read_contraction_hierarchy(wrong, loaded), boost::bad_graph);
+}
+
+void test_corrupted_input()
+{
+    // Vertex 0 is ranked lowest; the shortcut 1 -> 2 goes through it and
+    // replaces the down arc 1 -> 0 (stored as 0 1) and the up arc 0 -> 2
+    const std::string header = "contraction_hierarchy 1\n3 3 1\n";
+    std::istringstream good(header + "0 1 2\n0 1 1 -1\n0 2 2 -1\n1 2 3 0\n"
+        + "0 1 1 -1\n");
+    boost::contraction_hierarchy< unsigned > ch;
+    boost::read_contraction_hierarchy(good, ch);
+    boost::contraction_hierarchy_query< unsigned > query(ch);
+    BOOST_TEST_EQ(query.distance(1, 2), 3u);
+
+    const char* corrupted[] = {
+        // Ranks that are not a permutation
+        "0 1 1\n0 1 1 -1\n0 2 2 -1\n1 2 3 0\n0 1 1 -1\n",
+        // An up arc that descends
+        "0 1 2\n1 0 1 -1\n0 2 2 -1\n1 2 3 0\n0 1 1 -1\n",
+        // A stored down arc that descends
+        "0 1 2\n0 1 1 -1\n0 2 2 -1\n1 2 3 0\n1 0 1 -1\n",
+        // A shortcut whose first half is missing
+        "0 1 2\n0 1 1 -1\n0 2 2 -1\n1 2 3 0\n0 2 1 -1\n",
+        // A shortcut whose second half is missing
+        "0 1 2\n0 1 1 -1\n1 2 2 -1\n1 2 3 0\n0 1 1 -1\n",
+        // A shortcut through a vertex ranked above an end, and through
+        // itself, which would unpack forever
+        "0 1 2\n0 1 1 -1\n0 2 2 -1\n1 2 3 2\n0 1 1 -1\n",
+        "0 1 2\n0 1 1 -1\n0 2 2 -1\n1 2 3 1\n0 1 1 -1\n",
+    };
+    for (std::size_t i = 0; i < sizeof(corrupted) / sizeof(corrupted[0]);
+         ++i)
+    {
+        std::istringstream in(header + corrupted[i]);
+        BOOST_TEST_THROWS(
+            boost::read_contraction_hierarchy(in, ch), boost::bad_graph);
+        // A failed read leaves the hierarchy as it was
+        BOOST_TEST_EQ(ch.num_vertices(), 3u);
+        BOOST_TEST_EQ(num_edges(ch.upward_graph()), 3u);
+    }
+}
+
+void test_undirected()
+{
+    boost::minstd_rand gen(8);
+    boost::random::uniform_int_distribution< std::size_t > vdist(0, 199);
+    boost::random::uniform_int_distribution< int > wdist(1, 100);
+    UGraph g(200);
+    for (int i = 0; i < 500; ++i)
+        add_edge(vdist(gen), vdist(gen), wdist(gen) / 4.0, g);
+    boost::contraction_hierarchy< double > ch(
+        g, get(boost::edge_weight, g), get(boost::vertex_index, g));
+    boost::contraction_hierarchy_query< double > query(ch);
+    for (std::size_t s = 0; s < 200; s += 9)
+    {
+        std::vector< double > d(200);
+        boost::dijkstra_shortest_paths(g, s,
+            boost::distance_map(boost::make_iterator_property_map(
+                d.begin(), get(boost::vertex_index, g))));
+        for (std::size_t t = 0; t < 200; t += 7)
+        {
+            // Quarters add up exactly
+            BOOST_TEST_EQ(query.distance(s, t), d[t]);
+            BOOST_TEST_EQ(query.distance(t, s), d[t]);
+        }
+    }
+}
+
+void test_negative_edge()
+{
+    typedef boost::adjacency_list< boost::vecS, boost::vecS,
+        boost::directedS, boost::no_property,
+        boost::property< boost::edge_weight_t, int > >
+        IGraph;
+    IGraph g(2);
+    add_edge(0, 1, -1, g);
+    typedef boost::contraction_hierarchy< int > CH;
+    BOOST_TEST_THROWS(
+        CH(g, get(boost::edge_weight, g), get(boost::vertex_index, g)),
+        boost::negative_edge);
+}
+
+int main()
+{
+    test_road_graph();
+    test_serialization();
+    test_corrupted_input();
+    test_undirected();
+    test_negative_edge();
+    return boost::report_errors();
+}
@@ -0,0 +1,145 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Compares BFS and Dijkstra throughput on compressed_sparse_row_graph with
+// 64-bit and 32-bit vertex and edge index types.
+//
+// Usage: csr_index_width_performance [num_vertices [average_degree]]
+
+#include <boost/graph/narrowest_csr_graph.hpp>
+#include <boost/graph/breadth_first_search.hpp>
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/cstdint.hpp>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+typedef std::vector< std::pair< std::size_t, std::size_t > > EdgeList;
+
+struct benchmark_results
+{
+    double bfs_seconds;
+    double dijkstra_seconds;
+    std::size_t index_bytes;
+    double checksum;
+};
+
+template < typename Graph >
+benchmark_results run_benchmark(const Graph& g, int repeats)
+{
+    typedef typename Graph::vertex_descriptor Vertex;
+    typedef typename Graph::edges_size_type EdgeIndex;
+    typedef std::chrono::steady_clock clock;
+    benchmark_results r;
+    r.index_bytes = (num_vertices(g) + 1) * sizeof(EdgeIndex)
+        + num_edges(g) * sizeof(Vertex);
+
+    std::vector< Vertex > hops(num_vertices(g));
+    clock::time_point start = clock::now();
+    for (int i = 0; i < repeats; ++i)
+        boost::breadth_first_search(g, vertex(i, g),
+            boost::visitor(boost::make_bfs_visitor(boost::record_distances(
+                boost::make_iterator_property_map(
+                    hops.begin(), get(boost::vertex_index, g)),
+                boost::on_tree_edge()))));
+    r.bfs_seconds
+        = std::chrono::duration< double >(clock::now() - start).count();
+
+    std::vector< double > distances(num_vertices(g));
+    start = clock::now();
+    for (int i = 0; i < repeats; ++i)
+        boost::dijkstra_shortest_paths(g, vertex(i, g),
+            boost::weight_map(get(boost::edge_bundle, g))
+                .distance_map(boost::make_iterator_property_map(
+                    distances.begin(), get(boost::vertex_index, g))));
+    r.dijkstra_seconds
+        = std::chrono::duration< double >(clock::now() - start).count();
+
+    r.checksum = 0;
+    for (std::size_t v = 0; v < distances.size(); ++v)
+        r.checksum += distances[v] + double(hops[v]);
+    return r;
+}
+
+template < typename Vertex, typename EdgeIndex >
+benchmark_results build_and_run(std::size_t n, const EdgeList& edge_list,
+    const std::vector< float >& weights, int repeats)
+{
+    typedef boost::compressed_sparse_row_graph< boost::directedS,
+        boost::no_property, float, boost::no_property, Vertex, EdgeIndex >
+        Graph;
+    Graph g(boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), weights.begin(), Vertex(n));
+    return run_benchmark(g, repeats);
+}
+
+void report(const char* name, const benchmark_results& r, std::size_t m,
+    int repeats)
+{
+    std::cout << std::left << std::setw(24) << name << std::right
+              << std::setw(10) << r.index_bytes / (1024 * 1024) << " MiB"
+              << std::setw(12) << std::setprecision(3)
+              << m * repeats / r.bfs_seconds / 1e6 << std::setw(15)
+              << m * repeats / r.dijkstra_seconds / 1e6 << "\n";
+}
+
+int main(int argc, char* argv[])
+{
+    std::size_t n = 1000000;
+    std::size_t degree = 16;
+    if (argc > 1)
+        n = boost::lexical_cast< std::size_t >(argv[1]);
+    if (argc > 2)
+        degree = boost::lexical_cast< std::size_t >(argv[2]);
+    const int repeats = 3;
+
+    boost::minstd_rand gen(1);
+    boost::random::uniform_int_distribution< std::size_t > vdist(0, n - 1);
+    boost::random::uniform_int_distribution< int > wdist(1, 1000);
+    EdgeList edge_list;
+    std::vector< float > weights;
+    for (std::size_t i = 0; i < n * degree; ++i)
+    {
+        edge_list.push_back(std::make_pair(i % n, vdist(gen)));
+        weights.push_back(float(wdist(gen)));
+    }
+    const std::size_t m = edge_list.size();
+
+    std::cout << n << " vertices, " << m << " edges, " << repeats
+              << " sources\n"
+              << std::left << std::setw(24) << "Vertex/EdgeIndex"
+              << std::right << std::setw(14) << "indices" << std::setw(12)
+              << "BFS Me/s" << std::setw(15) << "Dijkstra Me/s" << "\n";
+
+    benchmark_results wide
+        = build_and_run< std::size_t, std::size_t >(n, edge_list, weights,
+            repeats);
+    report("size_t/size_t", wide, m, repeats);
+
+    benchmark_results mixed
+        = build_and_run< boost::uint32_t, boost::uint64_t >(n, edge_list,
+            weights, repeats);
+    report("uint32_t/uint64_t", mixed, m, repeats);
+    BOOST_TEST_EQ(wide.checksum, mixed.checksum);
+
+    if (boost::narrowest_csr_index_width(n, m) == boost::csr_index_32_32)
+    {
+        benchmark_results narrow
+            = build_and_run< boost::uint32_t, boost::uint32_t >(n, edge_list,
+                weights, repeats);
+        report("uint32_t/uint32_t", narrow, m, repeats);
+        BOOST_TEST_EQ(wide.checksum, narrow.checksum);
+    }
+    return boost::report_errors();
+}
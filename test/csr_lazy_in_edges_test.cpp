@@ -0,0 +1,222 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/iteration_macros.hpp>
+#include <boost/graph/page_rank.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <utility>
+#include <vector>
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+#include <thread>
+#endif
+
+struct VertexData
+{
+    int label;
+};
+
+typedef boost::compressed_sparse_row_graph< boost::bidirectionalS,
+    VertexData, int >
+    BidirCSR;
+typedef std::vector< std::pair< std::size_t, std::size_t > > EdgeList;
+
+void make_random_edges(
+    std::size_t n, std::size_t m, EdgeList& edges, std::vector< int >& props)
+{
+    boost::minstd_rand gen(29);
+    boost::random::uniform_int_distribution< std::size_t > vdist(0, n - 1);
+    for (std::size_t i = 0; i < m; ++i)
+    {
+        edges.push_back(std::make_pair(vdist(gen), vdist(gen)));
+        props.push_back(int(i));
+    }
+}
+
+// The in-edges of every vertex, in order, must be the edges targeting it in
+// increasing edge index order
+void check_in_edges(const BidirCSR& g)
+{
+    std::vector< std::vector< std::size_t > > expected(num_vertices(g));
+    BGL_FORALL_EDGES(e, g, BidirCSR)
+    expected[target(e, g)].push_back(get(boost::edge_index, g, e));
+    BGL_FORALL_VERTICES(v, g, BidirCSR)
+    {
+        BOOST_TEST_EQ(in_degree(v, g), expected[v].size());
+        std::vector< std::size_t > found;
+        BGL_FORALL_INEDGES(v, e, g, BidirCSR)
+        {
+            BOOST_TEST_EQ(target(e, g), v);
+            found.push_back(get(boost::edge_index, g, e));
+        }
+        BOOST_TEST(found == expected[v]);
+    }
+}
+
+void test_eager_matches_reference()
+{
+    EdgeList edge_list;
+    std::vector< int > props;
+    make_random_edges(300, 5000, edge_list, props);
+    BidirCSR g(boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), props.begin(), 300);
+    BOOST_TEST(g.in_edge_index_built());
+    check_in_edges(g);
+
+    const std::size_t thread_counts[] = { 0, 2, 3, 8 };
+    for (std::size_t i = 0; i < sizeof(thread_counts) / sizeof(std::size_t);
+         ++i)
+    {
+        BidirCSR pg(boost::edges_are_unsorted_parallel_t(thread_counts[i]),
+            edge_list.begin(), edge_list.end(), props.begin(), 300);
+        BOOST_TEST(pg.m_backward.m_rowstart == g.m_backward.m_rowstart);
+        BOOST_TEST(pg.m_backward.m_column == g.m_backward.m_column);
+        BOOST_TEST(pg.m_backward.m_edge_properties
+            == g.m_backward.m_edge_properties);
+    }
+}
+
+void test_on_demand()
+{
+    EdgeList edge_list;
+    std::vector< int > props;
+    make_random_edges(300, 5000, edge_list, props);
+    BidirCSR eager(boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), props.begin(), 300);
+
+    BidirCSR g(boost::in_edges_on_demand_t(3),
+        boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), props.begin(), 300);
+    BOOST_TEST(!g.in_edge_index_built());
+    BOOST_TEST_EQ(num_vertices(g), 300u);
+    BOOST_TEST_EQ(num_edges(g), 5000u);
+    BOOST_TEST(g.m_forward.m_column == eager.m_forward.m_column);
+    BOOST_TEST(g.m_forward.m_edge_properties
+        == eager.m_forward.m_edge_properties);
+    BOOST_TEST(!g.in_edge_index_built());
+
+    in_degree(std::size_t(7), g);
+    BOOST_TEST(g.in_edge_index_built());
+    BOOST_TEST(g.m_backward.m_rowstart == eager.m_backward.m_rowstart);
+    BOOST_TEST(g.m_backward.m_column == eager.m_backward.m_column);
+    BOOST_TEST(g.m_backward.m_edge_properties
+        == eager.m_backward.m_edge_properties);
+    check_in_edges(g);
+
+    // Vertex bundles and graph properties are taken from the arguments
+    BidirCSR h(boost::in_edges_on_demand, std::size_t(10));
+    h[std::size_t(4)].label = 42;
+    BOOST_TEST_EQ(num_vertices(h), 10u);
+    BOOST_TEST_EQ(h[std::size_t(4)].label, 42);
+    build_in_edge_index(h);
+    BOOST_TEST(h.in_edge_index_built());
+    BOOST_TEST_EQ(in_degree(std::size_t(9), h), 0u);
+}
+
+void test_copy_add_vertex_and_permute()
+{
+    EdgeList edge_list;
+    std::vector< int > props;
+    make_random_edges(50, 400, edge_list, props);
+    BidirCSR g(boost::in_edges_on_demand, boost::edges_are_unsorted_multi_pass,
+        edge_list.begin(), edge_list.end(), props.begin(), 50);
+
+    // A copy of an unbuilt graph builds its own index
+    BidirCSR copy(g);
+    BOOST_TEST(!copy.in_edge_index_built());
+    check_in_edges(copy);
+    BOOST_TEST(!g.in_edge_index_built());
+
+    // Vertices added before the build are covered by it
+    add_vertex(g);
+    BOOST_TEST_EQ(num_vertices(g), 51u);
+    check_in_edges(g);
+    add_vertex(g);
+    BOOST_TEST_EQ(in_degree(std::size_t(51), g), 0u);
+
+    // Permuting a graph with an on-demand index drops the index
+    std::vector< std::size_t > perm(num_vertices(g));
+    for (std::size_t v = 0; v < perm.size(); ++v)
+        perm[v] = perm.size() - 1 - v;
+    permute_graph(g,
+        boost::make_iterator_property_map(
+            perm.begin(), get(boost::vertex_index, g)));
+    BOOST_TEST(!g.in_edge_index_built());
+    check_in_edges(g);
+}
+
+void test_concurrent_first_use()
+{
+    EdgeList edge_list;
+    std::vector< int > props;
+    make_random_edges(2000, 40000, edge_list, props);
+    BidirCSR eager(boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), props.begin(), 2000);
+    BidirCSR g(boost::in_edges_on_demand_t(2),
+        boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), props.begin(), 2000);
+
+    std::vector< std::size_t > sums(4, 0);
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+    std::vector< std::thread > threads;
+    for (std::size_t t = 0; t < sums.size(); ++t)
+        threads.push_back(std::thread([&g, &sums, t]() {
+            for (std::size_t v = t; v < num_vertices(g); v += 4)
+                sums[t] += in_degree(v, g);
+        }));
+    for (std::size_t t = 0; t < threads.size(); ++t)
+        threads[t].join();
+#else
+    for (std::size_t t = 0; t < sums.size(); ++t)
+        for (std::size_t v = t; v < num_vertices(g); v += 4)
+            sums[t] += in_degree(v, g);
+#endif
+    BOOST_TEST_EQ(sums[0] + sums[1] + sums[2] + sums[3], num_edges(g));
+    BOOST_TEST(g.m_backward.m_column == eager.m_backward.m_column);
+    BOOST_TEST(g.m_backward.m_edge_properties
+        == eager.m_backward.m_edge_properties);
+}
+
+void test_page_rank()
+{
+    // page_rank pulls over in-edges on bidirectional graphs, so the index
+    // is built when it starts
+    EdgeList edge_list;
+    std::vector< int > props;
+    make_random_edges(100, 800, edge_list, props);
+    BidirCSR eager(boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), props.begin(), 100);
+    BidirCSR g(boost::in_edges_on_demand, boost::edges_are_unsorted_multi_pass,
+        edge_list.begin(), edge_list.end(), props.begin(), 100);
+    std::vector< double > r1(100), r2(100);
+    boost::graph::page_rank(eager,
+        boost::make_iterator_property_map(
+            r1.begin(), get(boost::vertex_index, eager)));
+    BOOST_TEST(!g.in_edge_index_built());
+    boost::graph::page_rank(g,
+        boost::make_iterator_property_map(
+            r2.begin(), get(boost::vertex_index, g)));
+    BOOST_TEST(g.in_edge_index_built());
+    BOOST_TEST(r1 == r2);
+}
+
+int main()
+{
+    BOOST_CONCEPT_ASSERT((boost::IncidenceGraphConcept< BidirCSR >));
+    BOOST_CONCEPT_ASSERT((boost::VertexListGraphConcept< BidirCSR >));
+
+    test_eager_matches_reference();
+    test_on_demand();
+    test_copy_add_vertex_and_permute();
+    test_concurrent_first_use();
+    test_page_rank();
+    return boost::report_errors();
+}
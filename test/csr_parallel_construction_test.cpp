@@ -0,0 +1,137 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/iteration_macros.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <utility>
+#include <vector>
+
+typedef boost::compressed_sparse_row_graph< boost::directedS,
+    boost::no_property, int >
+    DirectedCSR;
+typedef boost::compressed_sparse_row_graph< boost::bidirectionalS,
+    boost::no_property, int >
+    BidirCSR;
+typedef std::vector< std::pair< std::size_t, std::size_t > > EdgeList;
+
+void make_random_edges(
+    std::size_t n, std::size_t m, EdgeList& edges, std::vector< int >& props)
+{
+    boost::minstd_rand gen(17);
+    boost::random::uniform_int_distribution< std::size_t > vdist(0, n - 1);
+    for (std::size_t i = 0; i < m; ++i)
+    {
+        edges.push_back(std::make_pair(vdist(gen), vdist(gen)));
+        props.push_back(int(i));
+    }
+}
+
+// Both graphs must have the same edges in the same order, including the order
+// of parallel edges within each row
+template < typename Graph >
+void check_identical(const Graph& g1, const Graph& g2)
+{
+    BOOST_TEST_EQ(num_vertices(g1), num_vertices(g2));
+    BOOST_TEST_EQ(num_edges(g1), num_edges(g2));
+    BOOST_TEST(g1.m_forward.m_rowstart == g2.m_forward.m_rowstart);
+    BOOST_TEST(g1.m_forward.m_column == g2.m_forward.m_column);
+    BOOST_TEST(g1.m_forward.m_edge_properties
+        == g2.m_forward.m_edge_properties);
+}
+
+template < typename Graph > void test_random(std::size_t n, std::size_t m)
+{
+    EdgeList edge_list;
+    std::vector< int > props;
+    make_random_edges(n, m, edge_list, props);
+
+    Graph reference(boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), props.begin(), n);
+    const std::size_t thread_counts[] = { 0, 1, 2, 3, 8 };
+    for (std::size_t i = 0; i < sizeof(thread_counts) / sizeof(std::size_t);
+         ++i)
+    {
+        Graph g(boost::edges_are_unsorted_parallel_t(thread_counts[i]),
+            edge_list.begin(), edge_list.end(), props.begin(), n);
+        check_identical(reference, g);
+
+        Graph g_no_props(
+            boost::edges_are_unsorted_parallel_t(thread_counts[i]),
+            edge_list.begin(), edge_list.end(), n);
+        BOOST_TEST(
+            reference.m_forward.m_rowstart == g_no_props.m_forward.m_rowstart);
+        BOOST_TEST(
+            reference.m_forward.m_column == g_no_props.m_forward.m_column);
+    }
+}
+
+void test_bidirectional()
+{
+    const std::size_t n = 200;
+    EdgeList edge_list;
+    std::vector< int > props;
+    make_random_edges(n, 3000, edge_list, props);
+
+    BidirCSR reference(boost::edges_are_unsorted_multi_pass,
+        edge_list.begin(), edge_list.end(), props.begin(), n);
+    BidirCSR g(boost::edges_are_unsorted_parallel_t(4), edge_list.begin(),
+        edge_list.end(), props.begin(), n);
+    check_identical(reference, g);
+
+    // The in-edges point back to the same edge properties
+    BGL_FORALL_VERTICES(v, g, BidirCSR)
+    {
+        BOOST_TEST_EQ(in_degree(v, g), in_degree(v, reference));
+        BGL_FORALL_INEDGES(v, e, g, BidirCSR)
+        {
+            BOOST_TEST_EQ(target(e, g), v);
+            BOOST_TEST(edge_list[g[e]].first == source(e, g));
+            BOOST_TEST(edge_list[g[e]].second == v);
+        }
+    }
+}
+
+void test_small()
+{
+    // Empty edge list
+    EdgeList edge_list;
+    DirectedCSR g1(boost::edges_are_unsorted_parallel, edge_list.begin(),
+        edge_list.end(), 5);
+    BOOST_TEST_EQ(num_vertices(g1), 5u);
+    BOOST_TEST_EQ(num_edges(g1), 0u);
+
+    // Empty graph
+    DirectedCSR g2(boost::edges_are_unsorted_parallel_t(3), edge_list.begin(),
+        edge_list.end(), 0);
+    BOOST_TEST_EQ(num_vertices(g2), 0u);
+
+    // Fewer edges than threads
+    edge_list.push_back(std::make_pair(2u, 0u));
+    edge_list.push_back(std::make_pair(0u, 1u));
+    DirectedCSR g3(boost::edges_are_unsorted_parallel_t(8), edge_list.begin(),
+        edge_list.end(), 3);
+    BOOST_TEST_EQ(num_edges(g3), 2u);
+    BOOST_TEST_EQ(out_degree(std::size_t(0), g3), 1u);
+    BOOST_TEST_EQ(out_degree(std::size_t(1), g3), 0u);
+    BOOST_TEST_EQ(out_degree(std::size_t(2), g3), 1u);
+}
+
+int main()
+{
+    // Many edges per vertex, so every thread gets its own block
+    test_random< DirectedCSR >(50, 5000);
+    // More vertices than edges, so the number of blocks is reduced
+    test_random< DirectedCSR >(1000, 300);
+    test_random< BidirCSR >(100, 2000);
+    test_bidirectional();
+    test_small();
+    return boost::report_errors();
+}
@@ -0,0 +1,396 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#include <boost/graph/csr_snapshot.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/placement_allocator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/cstdint.hpp>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <utility>
+#include <vector>
+
+typedef boost::compressed_sparse_row_graph< boost::directedS,
+    boost::no_property, double >
+    WeightedCSR;
+typedef boost::mapped_csr_graph< double > MappedWeightedCSR;
+
+typedef boost::compressed_sparse_row_graph< boost::directedS,
+    boost::no_property, boost::no_property, boost::no_property,
+    boost::uint32_t, boost::uint64_t >
+    NarrowCSR;
+typedef boost::mapped_csr_graph< boost::no_property, boost::uint32_t,
+    boost::uint64_t >
+    MappedNarrowCSR;
+
+typedef boost::compressed_sparse_row_graph< boost::directedS,
+    boost::no_property, double, boost::no_property, std::size_t, std::size_t,
+    boost::placement_allocator< bool, boost::huge_page_placement > >
+    PlacedWeightedCSR;
+
+struct Road
+{
+    double length;
+    int lanes;
+};
+typedef boost::compressed_sparse_row_graph< boost::directedS,
+    boost::no_property, Road >
+    RoadCSR;
+typedef boost::mapped_csr_graph< Road > MappedRoadCSR;
+
+static const char* const snapshot_file = "csr_snapshot_test.bin";
+
+template < typename G1, typename G2 >
+void check_same_structure(const G1& g1, const G2& g2)
+{
+    BOOST_TEST_EQ(num_vertices(g1), num_vertices(g2));
+    BOOST_TEST_EQ(num_edges(g1), num_edges(g2));
+    typedef typename boost::graph_traits< G1 >::vertex_descriptor Vertex;
+    for (Vertex v = 0; v < num_vertices(g1); ++v)
+    {
+        BOOST_TEST_EQ(out_degree(v, g1), out_degree(v, g2));
+        typename boost::graph_traits< G1 >::adjacency_iterator a1, a1_end;
+        typename boost::graph_traits< G2 >::adjacency_iterator a2, a2_end;
+        boost::tie(a1, a1_end) = adjacent_vertices(v, g1);
+        boost::tie(a2, a2_end) = adjacent_vertices(v, g2);
+        for (; a1 != a1_end && a2 != a2_end; ++a1, ++a2)
+            BOOST_TEST_EQ(*a1, *a2);
+    }
+}
+
+void make_random_edges(std::size_t n, std::size_t m,
+    std::vector< std::pair< std::size_t, std::size_t > >& edges,
+    std::vector< double >& weights)
+{
+    boost::minstd_rand gen(42);
+    boost::random::uniform_int_distribution< std::size_t > vdist(0, n - 1);
+    boost::random::uniform_int_distribution< int > wdist(1, 100);
+    for (std::size_t i = 0; i < m; ++i)
+    {
+        edges.push_back(std::make_pair(vdist(gen), vdist(gen)));
+        weights.push_back(wdist(gen));
+    }
+}
+
+void test_mapped_round_trip()
+{
+    const std::size_t n = 500;
+    std::vector< std::pair< std::size_t, std::size_t > > edge_list;
+    std::vector< double > weights;
+    make_random_edges(n, 4000, edge_list, weights);
+    WeightedCSR g(boost::edges_are_unsorted, edge_list.begin(),
+        edge_list.end(), weights.begin(), n);
+
+    boost::write_csr_snapshot(snapshot_file, g);
+    MappedWeightedCSR mg(snapshot_file);
+    check_same_structure(g, mg);
+
+    // Edge bundles come through unchanged and in the same edge order
+    BGL_FORALL_EDGES(e, g, WeightedCSR)
+    {
+        boost::graph_traits< MappedWeightedCSR >::edge_descriptor me
+            = boost::edge_from_index(get(boost::edge_index, g, e), mg);
+        BOOST_TEST_EQ(source(e, g), source(me, mg));
+        BOOST_TEST_EQ(target(e, g), target(me, mg));
+        BOOST_TEST_EQ(g[e], mg[me]);
+    }
+    std::size_t edge_count = 0;
+    BGL_FORALL_EDGES(e, mg, MappedWeightedCSR)
+    {
+        BOOST_TEST_EQ(get(boost::edge_index, mg, e), edge_count);
+        ++edge_count;
+    }
+    BOOST_TEST_EQ(edge_count, num_edges(mg));
+
+    // Algorithms run directly on the mapped view
+    std::vector< double > d1(n), d2(n);
+    boost::dijkstra_shortest_paths(g, 0,
+        boost::weight_map(get(boost::edge_bundle, g))
+            .distance_map(boost::make_iterator_property_map(
+                d1.begin(), get(boost::vertex_index, g))));
+    boost::dijkstra_shortest_paths(mg, 0,
+        boost::weight_map(get(boost::edge_bundle, mg))
+            .distance_map(boost::make_iterator_property_map(
+                d2.begin(), get(boost::vertex_index, mg))));
+    for (std::size_t v = 0; v < n; ++v)
+        BOOST_TEST_EQ(d1[v], d2[v]);
+
+    // Copies share the mapping and stay valid after the original goes away
+    MappedWeightedCSR copy;
+    {
+        MappedWeightedCSR tmp(snapshot_file);
+        copy = tmp;
+    }
+    check_same_structure(g, copy);
+}
+
+void test_bundled_members()
+{
+    // get(&Road::length, g) works on the mapped view as on the CSR graph
+    const std::size_t n = 300;
+    std::vector< std::pair< std::size_t, std::size_t > > edge_list;
+    std::vector< double > weights;
+    make_random_edges(n, 1500, edge_list, weights);
+    std::vector< Road > roads;
+    for (std::size_t i = 0; i < weights.size(); ++i)
+    {
+        Road r = { weights[i], int(i % 4) + 1 };
+        roads.push_back(r);
+    }
+    RoadCSR g(boost::edges_are_unsorted, edge_list.begin(), edge_list.end(),
+        roads.begin(), n);
+    boost::write_csr_snapshot(snapshot_file, g);
+    MappedRoadCSR mg(snapshot_file);
+
+    BGL_FORALL_EDGES(e, mg, MappedRoadCSR)
+    {
+        BOOST_TEST_EQ(get(&Road::lanes, mg, e), mg[e].lanes);
+        BOOST_TEST_EQ(get(get(&Road::length, mg), e), mg[e].length);
+    }
+
+    std::vector< double > d1(n), d2(n);
+    boost::dijkstra_shortest_paths(g, 0,
+        boost::weight_map(get(&Road::length, g))
+            .distance_map(boost::make_iterator_property_map(
+                d1.begin(), get(boost::vertex_index, g))));
+    boost::dijkstra_shortest_paths(mg, 0,
+        boost::weight_map(get(&Road::length, mg))
+            .distance_map(boost::make_iterator_property_map(
+                d2.begin(), get(boost::vertex_index, mg))));
+    for (std::size_t v = 0; v < n; ++v)
+        BOOST_TEST_EQ(d1[v], d2[v]);
+}
+
+void test_read_into_csr()
+{
+    const std::size_t n = 300;
+    std::vector< std::pair< std::size_t, std::size_t > > edge_list;
+    std::vector< double > weights;
+    make_random_edges(n, 1000, edge_list, weights);
+    WeightedCSR g(boost::edges_are_unsorted, edge_list.begin(),
+        edge_list.end(), weights.begin(), n);
+
+    std::stringstream buf;
+    boost::write_csr_snapshot(buf, g);
+    WeightedCSR g2;
+    boost::read_csr_snapshot(buf, g2);
+    check_same_structure(g, g2);
+    BGL_FORALL_EDGES(e, g, WeightedCSR)
+    {
+        BOOST_TEST_EQ(g[e], g2[e]);
+    }
+}
+
+void test_allocator()
+{
+    // Graphs with any allocator write and read the same snapshots
+    const std::size_t n = 300;
+    std::vector< std::pair< std::size_t, std::size_t > > edge_list;
+    std::vector< double > weights;
+    make_random_edges(n, 1000, edge_list, weights);
+    PlacedWeightedCSR g(boost::edges_are_unsorted, edge_list.begin(),
+        edge_list.end(), weights.begin(), n);
+    std::stringstream buf;
+    boost::write_csr_snapshot(buf, g);
+    WeightedCSR plain;
+    boost::read_csr_snapshot(buf, plain);
+    check_same_structure(g, plain);
+
+    boost::write_csr_snapshot(snapshot_file, plain);
+    PlacedWeightedCSR placed;
+    boost::read_csr_snapshot(snapshot_file, placed);
+    check_same_structure(g, placed);
+    BGL_FORALL_EDGES(e, g, PlacedWeightedCSR)
+    {
+        BOOST_TEST_EQ(g[e], placed[e]);
+    }
+}
+
+void test_narrow_and_empty()
+{
+    std::vector< std::pair< boost::uint32_t, boost::uint32_t > > edge_list;
+    edge_list.push_back(std::make_pair(3u, 1u));
+    edge_list.push_back(std::make_pair(0u, 2u));
+    edge_list.push_back(std::make_pair(3u, 0u));
+    NarrowCSR g(boost::edges_are_unsorted, edge_list.begin(), edge_list.end(),
+        5);
+    boost::write_csr_snapshot(snapshot_file, g);
+    MappedNarrowCSR mg(snapshot_file);
+    check_same_structure(g, mg);
+
+    NarrowCSR empty;
+    boost::write_csr_snapshot(snapshot_file, empty);
+    MappedNarrowCSR mempty(snapshot_file);
+    BOOST_TEST_EQ(num_vertices(mempty), 0u);
+    BOOST_TEST_EQ(num_edges(mempty), 0u);
+    BOOST_TEST(edges(mempty).first == edges(mempty).second);
+}
+
+template < typename MappedGraph >
+std::size_t open_snapshot(const char* filename)
+{
+    MappedGraph g(filename);
+    return num_vertices(g);
+}
+
+void test_rejects_bad_files()
+{
+    NarrowCSR g(boost::uint32_t(10));
+    boost::write_csr_snapshot(snapshot_file, g);
+    // Width mismatch
+    BOOST_TEST_THROWS(open_snapshot< MappedWeightedCSR >(snapshot_file),
+        boost::csr_snapshot_error);
+    // Missing file
+    BOOST_TEST_THROWS(
+        open_snapshot< MappedNarrowCSR >("csr_snapshot_test.missing"),
+        boost::csr_snapshot_error);
+    // Truncated file
+    {
+        std::ofstream out(snapshot_file, std::ios::binary | std::ios::trunc);
+        out << "BGL-CSR";
+    }
+    BOOST_TEST_THROWS(open_snapshot< MappedNarrowCSR >(snapshot_file),
+        boost::csr_snapshot_error);
+}
+
+// A stream buffer over a string that cannot seek, like a pipe or socket
+class unseekable_buf : public std::streambuf
+{
+public:
+    explicit unseekable_buf(const std::string& data) : m_data(data)
+    {
+        char* p = &m_data[0];
+        setg(p, p, p + m_data.size());
+    }
+
+private:
+    std::string m_data;
+};
+
+template < typename T >
+void patch(std::string& data, std::size_t offset, T value)
+{
+    std::memcpy(&data[offset], &value, sizeof(T));
+}
+
+// Reads a snapshot from data, from both a seekable and an unseekable
+// stream, and checks that g is left as it was when reading fails
+bool read_fails(const std::string& data)
+{
+    bool failed = true;
+    for (int seekable = 0; seekable < 2; ++seekable)
+    {
+        const std::pair< std::size_t, std::size_t > edge(0, 1);
+        WeightedCSR g(boost::edges_are_sorted, &edge, &edge + 1, 2);
+        std::istringstream seekable_in(data);
+        unseekable_buf buf(data);
+        std::istream unseekable_in(&buf);
+        try
+        {
+            boost::read_csr_snapshot(
+                seekable ? static_cast< std::istream& >(seekable_in)
+                         : unseekable_in,
+                g);
+            failed = false;
+        }
+        catch (const boost::csr_snapshot_error&)
+        {
+        }
+        failed = failed && num_vertices(g) == 2 && num_edges(g) == 1;
+    }
+    return failed;
+}
+
+void test_rejects_bad_streams()
+{
+    std::vector< std::pair< std::size_t, std::size_t > > edge_list;
+    edge_list.push_back(std::make_pair(0, 1));
+    edge_list.push_back(std::make_pair(1, 2));
+    edge_list.push_back(std::make_pair(1, 0));
+    std::vector< double > weights(3, 1.5);
+    WeightedCSR g(boost::edges_are_unsorted, edge_list.begin(),
+        edge_list.end(), weights.begin(), 3);
+    std::ostringstream out;
+    boost::write_csr_snapshot(out, g);
+    const std::string data = out.str();
+
+    // A stream without seeking still reads back
+    unseekable_buf buf(data);
+    std::istream in(&buf);
+    WeightedCSR g2;
+    boost::read_csr_snapshot(in, g2);
+    check_same_structure(g, g2);
+
+    const std::size_t num_vertices_at = 32, num_edges_at = 40;
+    const std::size_t column_offset_at = 48, property_offset_at = 56;
+    const std::size_t rowstart_at = sizeof(boost::csr_snapshot_header);
+
+    // Sizes that would need huge allocations, with offsets to match
+    {
+        std::string bad = data;
+        const boost::uint64_t n = boost::uint64_t(1) << 40;
+        boost::csr_snapshot_header h = boost::detail::make_csr_snapshot_header<
+            std::size_t, std::size_t, double >(n, n);
+        patch(bad, num_vertices_at, h.num_vertices);
+        patch(bad, num_edges_at, h.num_edges);
+        patch(bad, column_offset_at, h.column_offset);
+        patch(bad, property_offset_at, h.edge_property_offset);
+        BOOST_TEST(read_fails(bad));
+    }
+    // Sizes whose offsets wrap around
+    {
+        std::string bad = data;
+        patch(bad, num_vertices_at, ~boost::uint64_t(0) / 8);
+        BOOST_TEST(read_fails(bad));
+    }
+    // Decreasing row starts with the right first and last values
+    {
+        std::string bad = data;
+        patch(bad, rowstart_at + 1 * sizeof(std::size_t), std::size_t(3));
+        patch(bad, rowstart_at + 2 * sizeof(std::size_t), std::size_t(1));
+        BOOST_TEST(read_fails(bad));
+    }
+    // A target that is not a vertex
+    {
+        std::string bad = data;
+        boost::csr_snapshot_header h;
+        std::memcpy(&h, data.data(), sizeof(h));
+        patch(bad, std::size_t(h.column_offset), std::size_t(3));
+        BOOST_TEST(read_fails(bad));
+    }
+    // Truncated data
+    BOOST_TEST(read_fails(data.substr(0, data.size() - 1)));
+    BOOST_TEST(read_fails(data.substr(0, 40)));
+}
+
+int main()
+{
+    BOOST_CONCEPT_ASSERT((boost::IncidenceGraphConcept< MappedWeightedCSR >));
+    BOOST_CONCEPT_ASSERT((boost::AdjacencyGraphConcept< MappedWeightedCSR >));
+    BOOST_CONCEPT_ASSERT((boost::VertexListGraphConcept< MappedWeightedCSR >));
+    BOOST_CONCEPT_ASSERT((boost::EdgeListGraphConcept< MappedWeightedCSR >));
+
+    test_mapped_round_trip();
+    test_bundled_members();
+    test_read_into_csr();
+    test_allocator();
+    test_narrow_and_empty();
+    test_rejects_bad_files();
+    test_rejects_bad_streams();
+    std::remove(snapshot_file);
+    return boost::report_errors();
+}
@@ -0,0 +1,237 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#include <boost/graph/delta_compressed_csr_graph.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/breadth_first_search.hpp>
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/iteration_macros.hpp>
+#include <boost/graph/placement_allocator.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/cstdint.hpp>
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+typedef boost::compressed_sparse_row_graph< boost::directedS,
+    boost::no_property, double >
+    WeightedCSR;
+typedef boost::compressed_sparse_row_graph< boost::directedS,
+    boost::no_property, double, boost::no_property, std::size_t, std::size_t,
+    boost::placement_allocator< bool, boost::huge_page_placement > >
+    PlacedWeightedCSR;
+typedef boost::delta_compressed_csr_graph< double > DeltaWeightedCSR;
+typedef boost::delta_compressed_csr_graph<> DeltaCSR;
+typedef std::vector< std::pair< std::size_t, std::size_t > > EdgeList;
+
+// Edges mostly between nearby vertices, with a few long-range ones and
+// some parallel edges and self-loops
+void make_local_edges(std::size_t n, std::size_t m, EdgeList& edges,
+    std::vector< double >& weights)
+{
+    boost::minstd_rand gen(7);
+    boost::random::uniform_int_distribution< int > offset(-40, 40);
+    boost::random::uniform_int_distribution< std::size_t > any(0, n - 1);
+    boost::random::uniform_int_distribution< int > wdist(1, 100);
+    for (std::size_t i = 0; i < m; ++i)
+    {
+        std::size_t src = any(gen);
+        std::size_t tgt = i % 50 == 0
+            ? any(gen)
+            : std::size_t((src + n + offset(gen)) % n);
+        edges.push_back(std::make_pair(src, tgt));
+        weights.push_back(wdist(gen));
+    }
+}
+
+// Same neighbors per vertex, compared as sorted multisets
+template < typename G1, typename G2 >
+void check_same_adjacency(const G1& g1, const G2& g2)
+{
+    BOOST_TEST_EQ(num_vertices(g1), num_vertices(g2));
+    BOOST_TEST_EQ(num_edges(g1), num_edges(g2));
+    for (std::size_t v = 0; v < num_vertices(g1); ++v)
+    {
+        BOOST_TEST_EQ(out_degree(v, g1), out_degree(v, g2));
+        std::vector< std::size_t > n1, n2;
+        BGL_FORALL_ADJ_T(v, u, g1, G1) n1.push_back(u);
+        BGL_FORALL_ADJ_T(v, u, g2, G2) n2.push_back(u);
+        std::sort(n1.begin(), n1.end());
+        BOOST_TEST(n1 == n2); // Compressed rows come out sorted
+    }
+}
+
+void test_from_csr()
+{
+    const std::size_t n = 2000;
+    EdgeList edge_list;
+    std::vector< double > weights;
+    make_local_edges(n, 20000, edge_list, weights);
+    WeightedCSR g(boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), weights.begin(), n);
+    DeltaWeightedCSR dg(g);
+    check_same_adjacency(g, dg);
+
+    // Nearby neighbors need one or two bytes instead of sizeof(std::size_t)
+    BOOST_TEST(dg.compressed_size() * 3 < num_edges(g) * sizeof(std::size_t));
+    // Rows are located by two bytes per vertex and a word per 64 vertices
+    BOOST_TEST_EQ(dg.m_row_offset.size(), n);
+    BOOST_TEST_EQ(dg.m_block_offset.size(), (n + 63) / 64 + 1);
+    BOOST_TEST(dg.m_wide_row_offset.empty());
+
+    // Edge descriptors, indices and bundles are consistent
+    std::size_t count = 0;
+    BGL_FORALL_EDGES(e, dg, DeltaWeightedCSR)
+    {
+        BOOST_TEST_EQ(get(boost::edge_index, dg, e), count);
+        ++count;
+    }
+    BOOST_TEST_EQ(count, num_edges(dg));
+    BGL_FORALL_VERTICES(v, dg, DeltaWeightedCSR)
+    {
+        BGL_FORALL_OUTEDGES(v, e, dg, DeltaWeightedCSR)
+        {
+            BOOST_TEST_EQ(source(e, dg), v);
+            BOOST_TEST(dg[e] >= 1 && dg[e] <= 100);
+        }
+    }
+
+    // Algorithms give the same results as on the uncompressed graph
+    std::vector< double > d1(n), d2(n);
+    boost::dijkstra_shortest_paths(g, 0,
+        boost::weight_map(get(boost::edge_bundle, g))
+            .distance_map(boost::make_iterator_property_map(
+                d1.begin(), get(boost::vertex_index, g))));
+    boost::dijkstra_shortest_paths(dg, 0,
+        boost::weight_map(get(boost::edge_bundle, dg))
+            .distance_map(boost::make_iterator_property_map(
+                d2.begin(), get(boost::vertex_index, dg))));
+    BOOST_TEST(d1 == d2);
+
+    std::vector< std::size_t > h1(n, 0), h2(n, 0);
+    boost::breadth_first_search(g, 0,
+        boost::visitor(boost::make_bfs_visitor(boost::record_distances(
+            boost::make_iterator_property_map(
+                h1.begin(), get(boost::vertex_index, g)),
+            boost::on_tree_edge()))));
+    boost::breadth_first_search(dg, 0,
+        boost::visitor(boost::make_bfs_visitor(boost::record_distances(
+            boost::make_iterator_property_map(
+                h2.begin(), get(boost::vertex_index, dg)),
+            boost::on_tree_edge()))));
+    BOOST_TEST(h1 == h2);
+}
+
+void test_from_edges()
+{
+    // Targets below and far above their source, duplicates, empty rows
+    EdgeList edge_list;
+    edge_list.push_back(std::make_pair(5u, 0u));
+    edge_list.push_back(std::make_pair(5u, 1000000u));
+    edge_list.push_back(std::make_pair(5u, 5u));
+    edge_list.push_back(std::make_pair(5u, 0u));
+    edge_list.push_back(std::make_pair(1000000u, 2u));
+    DeltaCSR g(boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), 1000001);
+    BOOST_TEST_EQ(num_edges(g), 5u);
+    BOOST_TEST_EQ(out_degree(std::size_t(5), g), 4u);
+    BOOST_TEST_EQ(out_degree(std::size_t(0), g), 0u);
+
+    std::vector< std::size_t > row;
+    BGL_FORALL_ADJ(std::size_t(5), u, g, DeltaCSR) row.push_back(u);
+    BOOST_TEST_EQ(row.size(), 4u);
+    BOOST_TEST_EQ(row[0], 0u);
+    BOOST_TEST_EQ(row[1], 0u);
+    BOOST_TEST_EQ(row[2], 5u);
+    BOOST_TEST_EQ(row[3], 1000000u);
+
+    std::vector< std::pair< std::size_t, std::size_t > > seen;
+    BGL_FORALL_EDGES(e, g, DeltaCSR)
+    seen.push_back(std::make_pair(source(e, g), target(e, g)));
+    BOOST_TEST_EQ(seen.size(), 5u);
+    BOOST_TEST(seen.back().first == 1000000u);
+    BOOST_TEST(seen.back().second == 2u);
+
+    DeltaCSR empty;
+    BOOST_TEST_EQ(num_vertices(empty), 0u);
+    BOOST_TEST(edges(empty).first == edges(empty).second);
+}
+
+void test_long_rows()
+{
+    // Vertex 70 has far more encoded bytes than a 16-bit row offset can
+    // span, so the rows after it in its block use full offsets
+    const std::size_t n = 200;
+    EdgeList edge_list;
+    for (std::size_t i = 0; i < 70000; ++i)
+        edge_list.push_back(std::make_pair(70u, i % 2 ? 0u : n - 1));
+    for (std::size_t v = 0; v < n; ++v)
+        edge_list.push_back(std::make_pair(v, (v * 37) % n));
+    std::vector< double > weights(edge_list.size(), 1.0);
+    WeightedCSR g(boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), weights.begin(), n);
+    DeltaWeightedCSR dg(g);
+    BOOST_TEST_EQ(dg.m_wide_row_offset.size(), 64u);
+    check_same_adjacency(g, dg);
+}
+
+void test_from_placed_csr()
+{
+    // A CSR graph with a non-default allocator converts the same way
+    const std::size_t n = 500;
+    EdgeList edge_list;
+    std::vector< double > weights;
+    make_local_edges(n, 4000, edge_list, weights);
+    PlacedWeightedCSR g(boost::edges_are_unsorted_multi_pass,
+        edge_list.begin(), edge_list.end(), weights.begin(), n);
+    DeltaWeightedCSR dg(g);
+    check_same_adjacency(g, dg);
+    BGL_FORALL_EDGES(e, dg, DeltaWeightedCSR)
+    {
+        BOOST_TEST(dg[e] >= 1 && dg[e] <= 100);
+    }
+}
+
+void test_varint()
+{
+    const boost::uint64_t values[] = { 0, 1, 127, 128, 300, 16383, 16384,
+        boost::uint64_t(1) << 35, ~boost::uint64_t(0) };
+    std::vector< unsigned char > bytes;
+    for (std::size_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i)
+        boost::detail::encode_varint(values[i], bytes);
+    const unsigned char* pos = &bytes[0];
+    for (std::size_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i)
+        BOOST_TEST_EQ(boost::detail::decode_varint(pos), values[i]);
+    BOOST_TEST(pos == &bytes[0] + bytes.size());
+
+    const boost::int64_t deltas[] = { 0, -1, 1, -64, 64, -1000000 };
+    for (std::size_t i = 0; i < sizeof(deltas) / sizeof(deltas[0]); ++i)
+        BOOST_TEST_EQ(boost::int64_t(boost::detail::zigzag_decode(
+                          boost::detail::zigzag_encode(deltas[i]))),
+            deltas[i]);
+    BOOST_TEST_EQ(boost::detail::zigzag_encode(-1), 1u);
+    BOOST_TEST_EQ(boost::detail::zigzag_encode(1), 2u);
+}
+
+int main()
+{
+    BOOST_CONCEPT_ASSERT((boost::IncidenceGraphConcept< DeltaWeightedCSR >));
+    BOOST_CONCEPT_ASSERT((boost::AdjacencyGraphConcept< DeltaWeightedCSR >));
+    BOOST_CONCEPT_ASSERT((boost::VertexListGraphConcept< DeltaWeightedCSR >));
+    BOOST_CONCEPT_ASSERT((boost::EdgeListGraphConcept< DeltaWeightedCSR >));
+
+    test_varint();
+    test_from_csr();
+    test_from_placed_csr();
+    test_from_edges();
+    test_long_rows();
+    return boost::report_errors();
+}
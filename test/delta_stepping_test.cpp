@@ -0,0 +1,181 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#include <boost/graph/delta_stepping_shortest_paths.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/graph/iteration_macros.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <limits>
+#include <utility>
+#include <vector>
+
+struct Road
+{
+    int weight;
+};
+
+typedef boost::compressed_sparse_row_graph< boost::directedS,
+    boost::no_property, Road >
+    CSRGraph;
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::undirectedS,
+    boost::no_property, boost::property< boost::edge_weight_t, double > >
+    UndirGraph;
+typedef std::vector< std::pair< std::size_t, std::size_t > > EdgeList;
+
+EdgeList make_edges(std::size_t n, std::size_t m, unsigned seed)
+{
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_int_distribution< std::size_t > vdist(0, n - 1);
+    EdgeList edges;
+    for (std::size_t i = 0; i < m; ++i)
+        edges.push_back(std::make_pair(vdist(gen), vdist(gen)));
+    return edges;
+}
+
+// Compares against Dijkstra and checks that the predecessors form a
+// shortest-path tree
+template < typename Graph, typename WeightMap >
+void check_paths(const Graph& g, WeightMap weight,
+    typename boost::graph_traits< Graph >::vertex_descriptor s,
+    typename boost::property_traits< WeightMap >::value_type delta,
+    std::size_t num_threads)
+{
+    typedef typename boost::graph_traits< Graph >::vertex_descriptor Vertex;
+    typedef typename boost::property_traits< WeightMap >::value_type D;
+    const std::size_t n = num_vertices(g);
+    const D inf = (std::numeric_limits< D >::max)();
+    std::vector< D > expected(n), d(n);
+    std::vector< Vertex > p(n);
+    boost::dijkstra_shortest_paths(g, s,
+        boost::weight_map(weight).distance_map(
+            boost::make_iterator_property_map(
+                expected.begin(), get(boost::vertex_index, g))));
+    boost::delta_stepping_shortest_paths(g, s,
+        boost::weight_map(weight)
+            .distance_map(boost::make_iterator_property_map(
+                d.begin(), get(boost::vertex_index, g)))
+            .predecessor_map(boost::make_iterator_property_map(
+                p.begin(), get(boost::vertex_index, g)))
+            .bucket_width(delta)
+            .num_threads(num_threads));
+    BOOST_TEST(d == expected);
+
+    BGL_FORALL_VERTICES_T(v, g, Graph)
+    {
+        if (v == s || d[v] == inf)
+        {
+            BOOST_TEST(p[v] == v);
+            continue;
+        }
+        bool tight = false;
+        BGL_FORALL_OUTEDGES_T(p[v], e, g, Graph)
+        tight = tight
+            || (target(e, g) == v && d[p[v]] + get(weight, e) == d[v]);
+        BOOST_TEST(tight);
+        // Following predecessors leads back to s
+        Vertex u = v;
+        for (std::size_t i = 0; i < n && u != s; ++i)
+            u = p[u];
+        BOOST_TEST(u == s);
+    }
+}
+
+void test_integer_weights()
+{
+    const std::size_t n = 5000;
+    EdgeList edges = make_edges(n, 40000, 3);
+    boost::minstd_rand gen(4);
+    // Mostly light edges, some heavy ones and some of weight zero
+    boost::random::uniform_int_distribution< int > wdist(0, 100);
+    std::vector< Road > roads;
+    for (std::size_t i = 0; i < edges.size(); ++i)
+    {
+        Road r = { wdist(gen) };
+        if (i % 10 == 0)
+            r.weight *= 50;
+        roads.push_back(r);
+    }
+    CSRGraph g(boost::edges_are_unsorted_multi_pass, edges.begin(),
+        edges.end(), roads.begin(), n);
+
+    const std::size_t thread_counts[] = { 1, 2, 4, 0 };
+    const int deltas[] = { 0, 1, 7, 100000 };
+    for (std::size_t i = 0; i < 4; ++i)
+        for (std::size_t j = 0; j < 4; ++j)
+            check_paths(g, get(&Road::weight, g), 0, deltas[j],
+                thread_counts[i]);
+}
+
+void test_real_weights()
+{
+    const std::size_t n = 3000;
+    EdgeList edge_list = make_edges(n, 12000, 5);
+    UndirGraph g(edge_list.begin(), edge_list.end(), n);
+    boost::minstd_rand gen(6);
+    boost::random::uniform_real_distribution< double > wdist(0.0, 1.0);
+    BGL_FORALL_EDGES(e, g, UndirGraph)
+    put(boost::edge_weight, g, e, wdist(gen));
+
+    const std::size_t thread_counts[] = { 1, 3, 0 };
+    const double deltas[] = { 0.0, 0.05, 1e-9 };
+    for (std::size_t i = 0; i < 3; ++i)
+        for (std::size_t j = 0; j < 3; ++j)
+            check_paths(g, get(boost::edge_weight, g), 17, deltas[j],
+                thread_counts[i]);
+}
+
+void test_small_cases()
+{
+    // Unreachable vertices and all-zero weights
+    EdgeList edges;
+    edges.push_back(std::make_pair(1, 2));
+    edges.push_back(std::make_pair(2, 3));
+    edges.push_back(std::make_pair(3, 1));
+    std::vector< Road > roads(3);
+    for (std::size_t i = 0; i < 3; ++i)
+        roads[i].weight = 0;
+    CSRGraph g(boost::edges_are_unsorted_multi_pass, edges.begin(),
+        edges.end(), roads.begin(), std::size_t(5));
+    check_paths(g, get(&Road::weight, g), 0, 0, 2);
+    check_paths(g, get(&Road::weight, g), 1, 0, 2);
+
+    // Positional form and the default distance map
+    std::vector< long > d(5);
+    std::vector< std::size_t > p(5);
+    boost::delta_stepping_shortest_paths(g, 2, get(&Road::weight, g), &d[0],
+        &p[0], get(boost::vertex_index, g), 1L, 3);
+    BOOST_TEST_EQ(d[1], 0);
+    BOOST_TEST_EQ(p[1], 3u);
+    BOOST_TEST_EQ(d[4], (std::numeric_limits< long >::max)());
+    boost::delta_stepping_shortest_paths(g, 2,
+        boost::weight_map(get(&Road::weight, g)).predecessor_map(&p[0]));
+    BOOST_TEST_EQ(p[3], 2u);
+
+    // Negative weights are rejected
+    roads[1].weight = -1;
+    CSRGraph neg(boost::edges_are_unsorted_multi_pass, edges.begin(),
+        edges.end(), roads.begin(), std::size_t(5));
+    BOOST_TEST_THROWS(boost::delta_stepping_shortest_paths(neg, 1,
+                          boost::weight_map(get(&Road::weight, neg))
+                              .distance_map(&d[0])
+                              .num_threads(4)),
+        boost::negative_edge);
+}
+
+int main()
+{
+    test_integer_weights();
+    test_real_weights();
+    test_small_cases();
+    return boost::report_errors();
+}
@@ -6,165 +6,152 @@
 
 //  Authors: Douglas Gregor
 //           Andrew Lumsdaine
-#ifndef BOOST_GRAPH_DIJKSTRA_TESTING_DIETMAR
-#define BOOST_GRAPH_DIJKSTRA_TESTING
-#endif
+
+// Compares the priority queues selectable with priority_queue_kind, and
+// dijkstra_shortest_paths_no_color_map, on a road-like grid graph with
+// small integer weights.
+//
+// Usage: dijkstra_heap_performance [num_vertices [max_weight [seed]]]
 
 #include <boost/graph/dijkstra_shortest_paths.hpp>
 #include <boost/graph/dijkstra_shortest_paths_no_color_map.hpp>
-#include <boost/graph/adjacency_list.hpp>
-#include <boost/random/linear_congruential.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
 #include <boost/lexical_cast.hpp>
-#include <boost/random/uniform_real.hpp>
-#include <boost/timer/timer.hpp>
-#include <vector>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
 #include <iostream>
-
-#include <iterator>
+#include <limits>
 #include <utility>
-#include <boost/random/uniform_int.hpp>
-#include <boost/graph/graph_traits.hpp>
-#include <boost/graph/erdos_renyi_generator.hpp>
-#include <boost/type_traits/is_base_and_derived.hpp>
-#include <boost/type_traits/is_same.hpp>
-#include <boost/detail/lightweight_test.hpp>
+#include <vector>
 
 using namespace boost;
 
-#ifdef BOOST_GRAPH_DIJKSTRA_TESTING_DIETMAR
-
-struct show_events_visitor : dijkstra_visitor<>
+struct Road
 {
-    template < typename Vertex, typename Graph >
-    void discover_vertex(Vertex v, const Graph&)
-    {
-        std::cerr << "on_discover_vertex(" << v << ")\n";
-    }
-
-    template < typename Vertex, typename Graph >
-    void examine_vertex(Vertex v, const Graph&)
-    {
-        std::cerr << "on_discover_vertex(" << v << ")\n";
-    }
+    unsigned length;
 };
+typedef compressed_sparse_row_graph< directedS, no_property, Road > Graph;
+typedef std::chrono::steady_clock timer_clock;
 
-template < typename Graph, typename Kind >
-void run_test(const Graph& g, const char* name, Kind kind,
-    const std::vector< double >& correct_distances)
-{
-    std::vector< double > distances(num_vertices(g));
-
-    std::cout << "Running Dijkstra's with " << name << "...";
-    std::cout.flush();
-    boost::timer::cpu_timer t;
-    t.start();
-    dijkstra_heap_kind = kind;
+const int repeats = 5;
 
-    dijkstra_shortest_paths(g, vertex(0, g),
-        distance_map(&distances[0]).visitor(show_events_visitor()));
-    double run_time = t.stop();
-    std::cout << t.format() << " seconds.\n";
+double seconds_since(timer_clock::time_point start)
+{
+    return std::chrono::duration< double >(timer_clock::now() - start).count();
+}
 
-    BOOST_TEST(distances == correct_distances);
+void report(const char* name, double seconds, double baseline, double m)
+{
+    std::cout << std::left << std::setw(28) << name << std::right
+              << std::setw(10) << std::fixed << std::setprecision(4)
+              << seconds << " s " << std::setw(8) << std::setprecision(1)
+              << m / seconds / 1e6 << " Me/s " << std::setw(6)
+              << std::setprecision(2) << baseline / seconds << "x\n";
+}
 
-    if (distances != correct_distances)
+// Best time of several runs from the same sources
+template < typename Kind >
+double run(const Graph& g, const std::vector< std::size_t >& sources,
+    Kind kind, std::vector< std::vector< unsigned > >& distances)
+{
+    double best = (std::numeric_limits< double >::max)();
+    for (int r = 0; r < repeats; ++r)
     {
-        std::cout << "Expected: ";
-        std::copy(correct_distances.begin(), correct_distances.end(),
-            std::ostream_iterator< double >(std::cout, " "));
-        std::cout << "\nReceived: ";
-        std::copy(distances.begin(), distances.end(),
-            std::ostream_iterator< double >(std::cout, " "));
-        std::cout << std::endl;
+        timer_clock::time_point start = timer_clock::now();
+        dijkstra_shortest_paths(g, sources[r],
+            weight_map(get(&Road::length, g))
+                .distance_map(make_iterator_property_map(
+                    distances[r].begin(), get(vertex_index, g)))
+                .priority_queue_kind(kind));
+        best = (std::min)(best, seconds_since(start));
     }
+    return best;
 }
-#endif
 
 int main(int argc, char* argv[])
 {
-    unsigned n = (argc > 1 ? lexical_cast< unsigned >(argv[1]) : 10000u);
-    unsigned m = (argc > 2 ? lexical_cast< unsigned >(argv[2]) : 10 * n);
-    int seed = (argc > 3 ? lexical_cast< int >(argv[3]) : 1);
-
-    // Build random graph
-    typedef adjacency_list< vecS, vecS, directedS, no_property,
-        property< edge_weight_t, double > >
-        Graph;
-    std::cout << "Generating graph...";
-    std::cout.flush();
+    std::size_t n = 1000000;
+    unsigned max_weight = 100;
+    int seed = 1;
+    if (argc > 1)
+        n = lexical_cast< std::size_t >(argv[1]);
+    if (argc > 2)
+        max_weight = lexical_cast< unsigned >(argv[2]);
+    if (argc > 3)
+        seed = lexical_cast< int >(argv[3]);
+
+    // A square grid with two-way streets and a few missing blocks
     minstd_rand gen(seed);
-    double p = double(m) / (double(n) * double(n));
-    Graph g(erdos_renyi_iterator< minstd_rand, Graph >(gen, n, p),
-        erdos_renyi_iterator< minstd_rand, Graph >(), n);
-    std::cout << n << " vertices, " << num_edges(g) << " edges.\n";
-    uniform_real< double > rand01(0.0, 1.0);
-    graph_traits< Graph >::edge_iterator ei, ei_end;
-    for (boost::tie(ei, ei_end) = edges(g); ei != ei_end; ++ei)
-        put(edge_weight, g, *ei, rand01(gen));
-
-    std::vector< double > binary_heap_distances(n);
-    std::vector< double > relaxed_heap_distances(n);
-    std::vector< double > no_color_map_distances(n);
-
-    // Run binary or d-ary heap version
-    std::cout << "Running Dijkstra's with binary heap...";
-    std::cout.flush();
-    boost::timer::cpu_timer t;
-    t.start();
-
-    dijkstra_shortest_paths(g, vertex(0, g),
-        distance_map(boost::make_iterator_property_map(
-            binary_heap_distances.begin(), get(boost::vertex_index, g))));
-    t.stop();
-    boost::timer::cpu_times binary_heap_time = t.elapsed();
-    std::cout << boost::timer::format(binary_heap_time) << " seconds.\n";
-
-    std::cout << "Running Dijkstra's with d-ary heap (d=4)...";
-    std::cout.flush();
-    t.start();
-
-    dijkstra_shortest_paths(g, vertex(0, g),
-        distance_map(boost::make_iterator_property_map(
-            relaxed_heap_distances.begin(), get(boost::vertex_index, g))));
-    boost::timer::cpu_times relaxed_heap_time = t.elapsed();
-    std::cout << boost::timer::format(relaxed_heap_time) << " seconds.\n"
-              << "Speedup = " << (binary_heap_time.user / relaxed_heap_time.user)
-              << ".\n";
-
-    // Verify that the results are equivalent
-    BOOST_TEST(binary_heap_distances == relaxed_heap_distances);
-
-    // Run Michael's no-color-map version
-
-    std::cout << "Running Dijkstra's (no color map) with d-ary heap (d=4)...";
-    std::cout.flush();
-
-    t.start();
-    dijkstra_shortest_paths_no_color_map(g, vertex(0, g),
-        boost::dummy_property_map(),
-        boost::make_iterator_property_map(
-            no_color_map_distances.begin(), get(boost::vertex_index, g), 0.),
-        get(boost::edge_weight, g), get(boost::vertex_index, g),
-        std::less< double >(), boost::closed_plus< double >(),
-        (std::numeric_limits< double >::max)(), 0,
-        make_dijkstra_visitor(null_visitor()));
-    boost::timer::cpu_times no_color_map_time = t.elapsed();
-    std::cout << boost::timer::format(no_color_map_time) << " seconds.\n"
-              << "Speedup = " << (binary_heap_time.user / no_color_map_time.user)
-              << ".\n";
-
-    // Verify that the results are equivalent
-    BOOST_TEST(binary_heap_distances == no_color_map_distances);
-
-#ifdef BOOST_GRAPH_DIJKSTRA_TESTING_DIETMAR
-    run_test(g, "d-ary heap (d=2)", dijkstra_d_heap_2, binary_heap_distances);
-    run_test(g, "d-ary heap (d=3)", dijkstra_d_heap_3, binary_heap_distances);
-    run_test(
-        g, "Fibonacci heap", dijkstra_fibonacci_heap, binary_heap_distances);
-    run_test(g, "Lazy Fibonacci heap", dijkstra_lazy_fibonacci_heap,
-        binary_heap_distances);
-    run_test(g, "Pairing heap", dijkstra_pairing_heap, binary_heap_distances);
-    run_test(g, "Splay heap", dijkstra_splay_heap, binary_heap_distances);
-#endif
+    random::uniform_int_distribution< unsigned > wdist(1, max_weight);
+    random::uniform_int_distribution< int > keep(0, 9);
+    const std::size_t side = std::size_t(std::sqrt(double(n))) + 1;
+    n = side * side;
+    std::vector< std::pair< std::size_t, std::size_t > > edges;
+    std::vector< Road > roads;
+    for (std::size_t v = 0; v < n; ++v)
+    {
+        std::size_t right = v % side + 1 < side ? v + 1 : v;
+        std::size_t down = v + side < n ? v + side : v;
+        std::size_t next[] = { right, down };
+        for (int i = 0; i < 2; ++i)
+            if (next[i] != v && keep(gen) != 0)
+            {
+                Road r = { wdist(gen) };
+                edges.push_back(std::make_pair(v, next[i]));
+                roads.push_back(r);
+                edges.push_back(std::make_pair(next[i], v));
+                roads.push_back(r);
+            }
+    }
+    Graph g(edges_are_unsorted_multi_pass, edges.begin(), edges.end(),
+        roads.begin(), n);
+    const double m = double(num_edges(g));
+    std::cout << n << " vertices, " << num_edges(g) << " edges, weights 1.."
+              << max_weight << ", best of " << repeats << " runs\n";
+
+    random::uniform_int_distribution< std::size_t > vdist(0, n - 1);
+    std::vector< std::size_t > sources;
+    for (int r = 0; r < repeats; ++r)
+        sources.push_back(vdist(gen));
+    std::vector< std::vector< unsigned > > expected(
+        repeats, std::vector< unsigned >(n)),
+        distances = expected;
+
+    double base = run(g, sources, d_ary_heapS< 4 >(), expected);
+    report("d-ary heap (d = 4)", base, base, m);
+
+    double t = run(g, sources, d_ary_heapS< 2 >(), distances);
+    report("d-ary heap (d = 2)", t, base, m);
+    BOOST_TEST(distances == expected);
+
+    t = run(g, sources, d_ary_heapS< 8 >(), distances);
+    report("d-ary heap (d = 8)", t, base, m);
+    BOOST_TEST(distances == expected);
+
+    t = run(g, sources, radix_heapS(), distances);
+    report("radix heap", t, base, m);
+    BOOST_TEST(distances == expected);
+
+    t = run(g, sources, bucket_queueS(), distances);
+    report("bucket queue", t, base, m);
+    BOOST_TEST(distances == expected);
+
+    t = (std::numeric_limits< double >::max)();
+    for (int r = 0; r < repeats; ++r)
+    {
+        timer_clock::time_point start = timer_clock::now();
+        dijkstra_shortest_paths_no_color_map(g, sources[r],
+            weight_map(get(&Road::length, g))
+                .distance_map(make_iterator_property_map(
+                    distances[r].begin(), get(vertex_index, g))));
+        t = (std::min)(t, seconds_since(start));
+    }
+    report("no color map (d = 4)", t, base, m);
+    BOOST_TEST(distances == expected);
+
     return boost::report_errors();
 }
@@ -0,0 +1,250 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/exception.hpp>
+#include <boost/graph/iteration_macros.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::directedS,
+    boost::no_property, boost::property< boost::edge_weight_t, int > >
+    Graph;
+typedef boost::graph_traits< Graph >::vertex_descriptor Vertex;
+
+struct Road
+{
+    unsigned length;
+};
+typedef boost::compressed_sparse_row_graph< boost::directedS,
+    boost::no_property, Road >
+    CSRGraph;
+
+Graph make_graph(std::size_t n, std::size_t m, int max_weight)
+{
+    boost::minstd_rand gen(7);
+    boost::random::uniform_int_distribution< std::size_t > vdist(0, n - 1);
+    boost::random::uniform_int_distribution< int > wdist(0, max_weight);
+    Graph g(n);
+    for (std::size_t i = 0; i < m; ++i)
+        add_edge(vdist(gen), vdist(gen), wdist(gen), g);
+    return g;
+}
+
+template < typename Kind >
+void check_kind(const Graph& g, Kind kind, const std::vector< int >& expected)
+{
+    std::vector< int > d(num_vertices(g));
+    std::vector< Vertex > p(num_vertices(g));
+    boost::dijkstra_shortest_paths(g, 0,
+        boost::distance_map(boost::make_iterator_property_map(
+                                d.begin(), get(boost::vertex_index, g)))
+            .predecessor_map(&p[0])
+            .priority_queue_kind(kind));
+    BOOST_TEST(d == expected);
+    BGL_FORALL_VERTICES(v, g, Graph)
+    if (v != 0 && d[v] != (std::numeric_limits< int >::max)())
+    {
+        bool tight = false;
+        BGL_FORALL_OUTEDGES(p[v], e, g, Graph)
+        tight = tight
+            || (target(e, g) == v
+                && d[p[v]] + get(boost::edge_weight, g, e) == d[v]);
+        BOOST_TEST(tight);
+    }
+}
+
+void test_against_default_heap()
+{
+    // Small weights with many ties and zeros, then a wide range
+    const int max_weights[] = { 3, 1000, 1000000 };
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        Graph g = make_graph(2000, 12000, max_weights[i]);
+        std::vector< int > expected(num_vertices(g));
+        boost::dijkstra_shortest_paths(g, 0,
+            boost::distance_map(boost::make_iterator_property_map(
+                expected.begin(), get(boost::vertex_index, g))));
+        check_kind(g, boost::d_ary_heapS< 2 >(), expected);
+        check_kind(g, boost::d_ary_heapS< 8 >(), expected);
+        check_kind(g, boost::radix_heapS(), expected);
+        check_kind(g, boost::bucket_queueS(), expected);
+    }
+}
+
+void test_multiple_sources()
+{
+    std::vector< std::pair< std::size_t, std::size_t > > edges;
+    std::vector< Road > roads;
+    // A path in both directions
+    for (std::size_t i = 0; i + 1 < 100; ++i)
+    {
+        Road r = { unsigned(i % 5) };
+        edges.push_back(std::make_pair(i, i + 1));
+        roads.push_back(r);
+        edges.push_back(std::make_pair(i + 1, i));
+        roads.push_back(r);
+    }
+    CSRGraph g(boost::edges_are_unsorted_multi_pass, edges.begin(),
+        edges.end(), roads.begin(), std::size_t(100));
+    std::vector< unsigned > d1(100), d2(100);
+    boost::property_map< CSRGraph, boost::vertex_index_t >::type index
+        = get(boost::vertex_index, g);
+    std::size_t sources[] = { 10, 60 };
+    boost::dijkstra_shortest_paths(g, sources, sources + 2,
+        boost::dummy_property_map(),
+        boost::make_iterator_property_map(d1.begin(), index),
+        get(&Road::length, g), index,
+        std::less< unsigned >(), std::plus< unsigned >(),
+        (std::numeric_limits< unsigned >::max)(), 0u,
+        boost::dijkstra_visitor<>(),
+        boost::priority_queue_kind(boost::radix_heapS()));
+    boost::dijkstra_shortest_paths(g, sources, sources + 2,
+        boost::dummy_property_map(),
+        boost::make_iterator_property_map(d2.begin(), index),
+        get(&Road::length, g), index,
+        std::less< unsigned >(), std::plus< unsigned >(),
+        (std::numeric_limits< unsigned >::max)(), 0u,
+        boost::dijkstra_visitor<>(),
+        boost::priority_queue_kind(boost::bucket_queueS()));
+    BOOST_TEST(d1 == d2);
+    BOOST_TEST_EQ(d1[10], 0u);
+    BOOST_TEST_EQ(d1[60], 0u);
+    BOOST_TEST_EQ(d1[0], 20u);
+    BOOST_TEST_EQ(d1[35], 50u);
+}
+
+void test_queues_directly()
+{
+    // Decrease-key within and across buckets, and keys pushed equal to
+    // the last removed one
+    std::vector< int > key(6);
+    std::vector< std::size_t > index(6, std::size_t(-1));
+    boost::radix_heap_indirect< std::size_t, std::size_t*, int* > rh(
+        &key[0], &index[0]);
+    boost::bucket_queue_indirect< std::size_t, std::size_t*, int* > bq(
+        &key[0], &index[0], 10);
+    const int initial[] = { 5, 9, 3, 7, 7, 10 };
+    for (int round = 0; round < 2; ++round)
+    {
+        for (std::size_t v = 0; v < 6; ++v)
+            key[v] = initial[v];
+        std::vector< std::size_t > order;
+        for (std::size_t v = 0; v < 6; ++v)
+            round == 0 ? rh.push(v) : bq.push(v);
+        key[5] = 4;
+        key[1] = 7;
+        round == 0 ? rh.update(5) : bq.update(5);
+        round == 0 ? rh.update(1) : bq.update(1);
+        BOOST_TEST(round == 0 ? rh.contains(1) : bq.contains(1));
+        while (!(round == 0 ? rh.empty() : bq.empty()))
+        {
+            std::size_t v = round == 0 ? rh.top() : bq.top();
+            round == 0 ? rh.pop() : bq.pop();
+            BOOST_TEST(order.empty() || key[order.back()] <= key[v]);
+            order.push_back(v);
+            if (v == 0)
+            {
+                key[2] = 5;
+                round == 0 ? rh.push(2) : bq.push(2);
+            }
+        }
+        BOOST_TEST_EQ(order.size(), 7u);
+        BOOST_TEST_EQ(order[0], 2u);
+        BOOST_TEST_EQ(order[1], 5u);
+        BOOST_TEST(!(round == 0 ? rh.contains(1) : bq.contains(1)));
+    }
+}
+
+// The overloads with an explicit color map take the queue kind last
+template < typename Kind >
+void check_color_overloads(
+    const Graph& g, Kind kind, const std::vector< int >& expected)
+{
+    typedef boost::property_map< Graph, boost::vertex_index_t >::const_type
+        Index;
+    Index index = get(boost::vertex_index, g);
+    const int inf = (std::numeric_limits< int >::max)();
+    std::vector< int > d(num_vertices(g));
+    std::vector< Vertex > p(num_vertices(g));
+    std::vector< boost::default_color_type > color(num_vertices(g));
+    boost::dijkstra_shortest_paths(g, Vertex(0), &p[0],
+        boost::make_iterator_property_map(d.begin(), index),
+        get(boost::edge_weight, g), index, std::less< int >(),
+        std::plus< int >(), inf, 0, boost::dijkstra_visitor<>(),
+        boost::make_iterator_property_map(color.begin(), index), kind);
+    BOOST_TEST(d == expected);
+
+    std::fill(d.begin(), d.end(), inf);
+    std::fill(color.begin(), color.end(), boost::white_color);
+    d[0] = 0;
+    boost::dijkstra_shortest_paths_no_init(g, Vertex(0), &p[0],
+        boost::make_iterator_property_map(d.begin(), index),
+        get(boost::edge_weight, g), index, std::less< int >(),
+        std::plus< int >(), 0, boost::dijkstra_visitor<>(),
+        boost::make_iterator_property_map(color.begin(), index), kind);
+    BOOST_TEST(d == expected);
+}
+
+void test_color_overloads()
+{
+    Graph g = make_graph(500, 3000, 20);
+    std::vector< int > expected(num_vertices(g));
+    boost::dijkstra_shortest_paths(g, 0,
+        boost::distance_map(boost::make_iterator_property_map(
+            expected.begin(), get(boost::vertex_index, g))));
+    check_color_overloads(g, boost::d_ary_heapS< 2 >(), expected);
+    check_color_overloads(g, boost::radix_heapS(), expected);
+    check_color_overloads(g, boost::bucket_queueS(), expected);
+}
+
+template < typename Kind > void run_kind(const Graph& g, Kind kind)
+{
+    std::vector< int > d(num_vertices(g));
+    boost::dijkstra_shortest_paths(g, 0,
+        boost::distance_map(boost::make_iterator_property_map(
+                                d.begin(), get(boost::vertex_index, g)))
+            .priority_queue_kind(kind));
+}
+
+void test_negative_weights()
+{
+    // The bucket queue reads every weight before the search starts, and
+    // must not turn a negative one into a huge or empty span
+    const int weights[] = { -1, -3 };
+    for (std::size_t i = 0; i < 2; ++i)
+    {
+        Graph g(3);
+        add_edge(0, 2, 2, g);
+        add_edge(2, 1, weights[i], g);
+        BOOST_TEST_THROWS(
+            run_kind(g, boost::bucket_queueS()), boost::negative_edge);
+        BOOST_TEST_THROWS(
+            run_kind(g, boost::radix_heapS()), boost::negative_edge);
+        BOOST_TEST_THROWS(
+            run_kind(g, boost::d_ary_heapS< 4 >()), boost::negative_edge);
+    }
+}
+
+int main()
+{
+    test_against_default_heap();
+    test_multiple_sources();
+    test_queues_directly();
+    test_negative_weights();
+    test_color_overloads();
+    return boost::report_errors();
+}
@@ -0,0 +1,246 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#include <boost/graph/dijkstra_workspace.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/exception.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::directedS,
+    boost::no_property, boost::property< boost::edge_weight_t, int > >
+    Graph;
+typedef boost::graph_traits< Graph >::vertex_descriptor Vertex;
+typedef boost::dijkstra_workspace< Graph, int > Workspace;
+
+struct Road
+{
+    unsigned length;
+};
+typedef boost::compressed_sparse_row_graph< boost::directedS,
+    boost::no_property, Road >
+    CSRGraph;
+
+const int inf = (std::numeric_limits< int >::max)();
+
+Graph make_graph(std::size_t n, std::size_t m, int max_weight)
+{
+    boost::minstd_rand gen(11);
+    boost::random::uniform_int_distribution< std::size_t > vdist(0, n - 1);
+    boost::random::uniform_int_distribution< int > wdist(0, max_weight);
+    Graph g(n);
+    for (std::size_t i = 0; i < m; ++i)
+        add_edge(vdist(gen), vdist(gen), wdist(gen), g);
+    return g;
+}
+
+std::vector< int > reference_distances(const Graph& g, Vertex s)
+{
+    std::vector< int > d(num_vertices(g));
+    boost::dijkstra_shortest_paths(g, s,
+        boost::distance_map(boost::make_iterator_property_map(
+            d.begin(), get(boost::vertex_index, g))));
+    return d;
+}
+
+struct counting_visitor : public boost::dijkstra_visitor<>
+{
+    explicit counting_visitor(std::size_t& examined) : m_examined(&examined)
+    {
+    }
+
+    void examine_vertex(Vertex, const Graph&) { ++*m_examined; }
+
+    std::size_t* m_examined;
+};
+
+void test_reuse()
+{
+    // Few edges, so that many vertices are unreachable from each source
+    Graph g = make_graph(500, 900, 20);
+    Workspace ws(g);
+    for (Vertex s = 0; s < 100; ++s)
+    {
+        std::vector< int > expected = reference_distances(g, s);
+        std::size_t examined = 0;
+        boost::dijkstra_shortest_paths(
+            g, s, ws, boost::visitor(counting_visitor(examined)));
+        std::size_t reachable = 0;
+        for (Vertex v = 0; v < num_vertices(g); ++v)
+        {
+            BOOST_TEST_EQ(ws.distance(v), expected[v]);
+            BOOST_TEST_EQ(get(ws.distance_map(), v), expected[v]);
+            BOOST_TEST_EQ(ws.reached(v), expected[v] != inf);
+            reachable += expected[v] != inf;
+            Vertex p = ws.predecessor(v);
+            if (v == s || expected[v] == inf)
+                BOOST_TEST_EQ(p, v);
+            else
+                BOOST_TEST(expected[p]
+                        + get(boost::edge_weight, g, edge(p, v, g).first)
+                    <= expected[v]);
+        }
+        BOOST_TEST_EQ(ws.reached_vertices().size(), reachable);
+        BOOST_TEST_EQ(examined, reachable);
+    }
+}
+
+void test_one_to_many()
+{
+    Graph g = make_graph(2000, 10000, 50);
+    std::vector< int > expected = reference_distances(g, 0);
+    std::vector< Vertex > targets;
+    targets.push_back(0);
+    targets.push_back(5);
+    targets.push_back(17);
+    targets.push_back(5);
+    add_vertex(g); // unreachable
+    Workspace ws(g);
+    targets.push_back(2000);
+    expected.push_back(inf);
+
+    std::vector< int > d;
+    boost::dijkstra_one_to_many(g, 0, targets.begin(), targets.end(), ws,
+        std::back_inserter(d), boost::weight_map(get(boost::edge_weight, g)));
+    BOOST_TEST_EQ(d.size(), targets.size());
+    for (std::size_t j = 0; j < targets.size(); ++j)
+        BOOST_TEST_EQ(d[j], expected[targets[j]]);
+
+    // A close target stops the search early, and the next search starts
+    // over from a clean state
+    Vertex near = 0;
+    for (Vertex v = 1; v < 2000; ++v)
+        if (expected[v] != inf && (near == 0 || expected[v] < expected[near]))
+            near = v;
+    d.clear();
+    boost::dijkstra_one_to_many(g, 0, &near, &near + 1, ws,
+        std::back_inserter(d), boost::weight_map(get(boost::edge_weight, g)));
+    BOOST_TEST_EQ(d[0], expected[near]);
+    BOOST_TEST(ws.reached_vertices().size() < 100);
+    boost::dijkstra_shortest_paths(g, 0, ws, boost::vertex_index_map(
+        get(boost::vertex_index, g)));
+    for (Vertex v = 0; v < 2000; ++v)
+        BOOST_TEST_EQ(ws.distance(v), expected[v]);
+}
+
+struct record_rows
+{
+    void operator()(std::size_t i, const Workspace& ws) const
+    {
+        for (Vertex v = 0; v < (*rows)[i].size(); ++v)
+            (*rows)[i][v] = ws.distance(v);
+    }
+
+    std::vector< std::vector< int > >* rows;
+};
+
+void test_batch()
+{
+    Graph g = make_graph(1000, 5000, 100);
+    std::vector< Vertex > sources;
+    for (Vertex s = 0; s < 1000; s += 7)
+        sources.push_back(s);
+    const std::size_t thread_counts[] = { 1, 2, 4 };
+    for (std::size_t k = 0; k < 3; ++k)
+    {
+        std::vector< std::vector< int > > rows(
+            sources.size(), std::vector< int >(num_vertices(g)));
+        record_rows f = { &rows };
+        boost::dijkstra_shortest_paths_batch(g, sources.begin(),
+            sources.end(), f, boost::num_threads(thread_counts[k]));
+        for (std::size_t i = 0; i < sources.size(); ++i)
+            BOOST_TEST(rows[i] == reference_distances(g, sources[i]));
+    }
+}
+
+void test_many_to_many()
+{
+    std::vector< std::pair< std::size_t, std::size_t > > edges;
+    std::vector< Road > roads;
+    boost::minstd_rand gen(3);
+    boost::random::uniform_int_distribution< unsigned > wdist(1, 9);
+    // A grid with two-way streets
+    const std::size_t side = 40, n = side * side;
+    for (std::size_t v = 0; v < n; ++v)
+    {
+        if (v % side + 1 < side)
+        {
+            Road r = { wdist(gen) };
+            edges.push_back(std::make_pair(v, v + 1));
+            edges.push_back(std::make_pair(v + 1, v));
+            roads.push_back(r);
+            roads.push_back(r);
+        }
+        if (v + side < n)
+        {
+            Road r = { wdist(gen) };
+            edges.push_back(std::make_pair(v, v + side));
+            edges.push_back(std::make_pair(v + side, v));
+            roads.push_back(r);
+            roads.push_back(r);
+        }
+    }
+    CSRGraph g(boost::edges_are_unsorted_multi_pass, edges.begin(),
+        edges.end(), roads.begin(), n);
+    std::vector< std::size_t > sources, targets;
+    for (std::size_t i = 0; i < 30; ++i)
+    {
+        sources.push_back((i * 53) % n);
+        targets.push_back((i * 97 + 5) % n);
+    }
+    targets.push_back(targets[0]);
+
+    std::vector< std::vector< unsigned > > D(
+        sources.size(), std::vector< unsigned >(targets.size()));
+    boost::dijkstra_many_to_many(g, sources.begin(), sources.end(),
+        targets.begin(), targets.end(), D,
+        boost::weight_map(get(&Road::length, g)).num_threads(4));
+    for (std::size_t i = 0; i < sources.size(); ++i)
+    {
+        std::vector< unsigned > d(n);
+        boost::dijkstra_shortest_paths(g, sources[i],
+            boost::weight_map(get(&Road::length, g))
+                .distance_map(boost::make_iterator_property_map(
+                    d.begin(), get(boost::vertex_index, g))));
+        for (std::size_t j = 0; j < targets.size(); ++j)
+            BOOST_TEST_EQ(D[i][j], d[targets[j]]);
+    }
+}
+
+void test_negative_edge()
+{
+    Graph g(3);
+    add_edge(0, 1, 2, g);
+    add_edge(1, 2, -1, g);
+    Workspace ws(g);
+    BOOST_TEST_THROWS(boost::dijkstra_shortest_paths(g, 0, ws,
+                          boost::weight_map(get(boost::edge_weight, g))),
+        boost::negative_edge);
+    // The workspace stays usable
+    boost::dijkstra_shortest_paths(
+        g, 2, ws, boost::weight_map(get(boost::edge_weight, g)));
+    BOOST_TEST_EQ(ws.distance(2), 0);
+    BOOST_TEST_EQ(ws.distance(0), inf);
+}
+
+int main()
+{
+    test_reuse();
+    test_one_to_many();
+    test_batch();
+    test_many_to_many();
+    test_negative_edge();
+    return boost::report_errors();
+}
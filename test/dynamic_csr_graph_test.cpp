@@ -0,0 +1,164 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#include <boost/graph/dynamic_csr_graph.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/breadth_first_search.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/iteration_macros.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+typedef boost::dynamic_csr_graph< int > DynamicCSR;
+typedef std::vector< std::pair< std::size_t, std::size_t > > EdgeList;
+
+// Reference adjacency: (target, property) pairs in insertion order
+typedef std::vector< std::vector< std::pair< std::size_t, int > > > Oracle;
+
+void check_against(const DynamicCSR& g, const Oracle& oracle)
+{
+    BOOST_TEST_EQ(num_vertices(g), oracle.size());
+    std::size_t total = 0;
+    for (std::size_t v = 0; v < oracle.size(); ++v)
+    {
+        BOOST_TEST_EQ(out_degree(v, g), oracle[v].size());
+        std::size_t i = 0;
+        BGL_FORALL_OUTEDGES(v, e, g, DynamicCSR)
+        {
+            BOOST_TEST_EQ(source(e, g), v);
+            BOOST_TEST_EQ(target(e, g), oracle[v][i].first);
+            BOOST_TEST_EQ(g[e], oracle[v][i].second);
+            ++i;
+        }
+        total += oracle[v].size();
+    }
+    BOOST_TEST_EQ(num_edges(g), total);
+    std::size_t count = 0;
+    BGL_FORALL_EDGES(e, g, DynamicCSR)
+    {
+        BOOST_TEST_EQ(get(boost::edge_bundle, g)[e], g[e]);
+        ++count;
+    }
+    BOOST_TEST_EQ(count, total);
+}
+
+void test_streaming_batches()
+{
+    const std::size_t n = 300;
+    boost::minstd_rand gen(3);
+    boost::random::uniform_int_distribution< std::size_t > vdist(0, n - 1);
+    // Skewed sources, so some rows grow much faster than others
+    boost::random::uniform_int_distribution< std::size_t > hot(0, 9);
+
+    DynamicCSR g(n);
+    Oracle oracle(n);
+    int next_prop = 0;
+    for (int batch = 0; batch < 200; ++batch)
+    {
+        EdgeList edge_list;
+        std::vector< int > props;
+        for (int i = 0; i < 25; ++i)
+        {
+            std::size_t src = i % 3 == 0 ? hot(gen) : vdist(gen);
+            std::size_t tgt = vdist(gen);
+            edge_list.push_back(std::make_pair(src, tgt));
+            props.push_back(next_prop);
+            oracle[src].push_back(std::make_pair(tgt, next_prop));
+            ++next_prop;
+        }
+        add_edges(edge_list.begin(), edge_list.end(), props.begin(),
+            props.end(), g);
+
+        // Holes never outgrow half of the array by much
+        BOOST_TEST(2 * g.m_abandoned <= g.m_column.size() + n + 2 * 25);
+    }
+    check_against(g, oracle);
+    BOOST_TEST(g.m_column.size() <= 4 * num_edges(g) + 4 * n);
+
+    g.compact();
+    BOOST_TEST_EQ(g.m_abandoned, 0u);
+    check_against(g, oracle);
+
+    // Single edges and new vertices
+    std::size_t v = add_vertex(g);
+    oracle.resize(oracle.size() + 1);
+    BOOST_TEST_EQ(v, n);
+    std::pair< DynamicCSR::edge_descriptor, bool > added
+        = add_edge(v, std::size_t(0), 42, g);
+    BOOST_TEST(added.second);
+    BOOST_TEST_EQ(g[added.first], 42);
+    oracle[v].push_back(std::make_pair(std::size_t(0), 42));
+    add_edge(std::size_t(0), v, 43, g);
+    oracle[0].push_back(std::make_pair(v, 43));
+    BOOST_TEST_EQ(add_vertices(5, g), n + 1);
+    oracle.resize(oracle.size() + 5);
+    check_against(g, oracle);
+}
+
+void test_construct_and_traverse()
+{
+    const std::size_t n = 500;
+    boost::minstd_rand gen(11);
+    boost::random::uniform_int_distribution< std::size_t > vdist(0, n - 1);
+    EdgeList edge_list;
+    for (std::size_t i = 0; i < 3000; ++i)
+        edge_list.push_back(std::make_pair(vdist(gen), vdist(gen)));
+
+    // Half of the edges at construction, half added afterwards
+    EdgeList::iterator middle = edge_list.begin() + 1500;
+    boost::dynamic_csr_graph<> g(boost::edges_are_unsorted_multi_pass,
+        edge_list.begin(), middle, n);
+    add_edges(middle, edge_list.end(), g);
+    typedef boost::compressed_sparse_row_graph< boost::directedS > CSR;
+    CSR reference(boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), n);
+    BOOST_TEST_EQ(num_edges(g), num_edges(reference));
+
+    std::vector< std::size_t > h1(n, 0), h2(n, 0);
+    boost::breadth_first_search(reference, 0,
+        boost::visitor(boost::make_bfs_visitor(boost::record_distances(
+            boost::make_iterator_property_map(
+                h1.begin(), get(boost::vertex_index, reference)),
+            boost::on_tree_edge()))));
+    boost::breadth_first_search(g, 0,
+        boost::visitor(boost::make_bfs_visitor(boost::record_distances(
+            boost::make_iterator_property_map(
+                h2.begin(), get(boost::vertex_index, g)),
+            boost::on_tree_edge()))));
+    BOOST_TEST(h1 == h2);
+
+    // A static CSR copy can be taken once ingestion is done
+    CSR snapshot(g);
+    BOOST_TEST_EQ(num_edges(snapshot), num_edges(g));
+    for (std::size_t v = 0; v < n; ++v)
+    {
+        std::vector< std::size_t > a(adjacent_vertices(v, g).first,
+            adjacent_vertices(v, g).second);
+        std::vector< std::size_t > b(adjacent_vertices(v, reference).first,
+            adjacent_vertices(v, reference).second);
+        std::sort(a.begin(), a.end());
+        std::sort(b.begin(), b.end());
+        BOOST_TEST(a == b);
+    }
+}
+
+int main()
+{
+    BOOST_CONCEPT_ASSERT((boost::IncidenceGraphConcept< DynamicCSR >));
+    BOOST_CONCEPT_ASSERT((boost::AdjacencyGraphConcept< DynamicCSR >));
+    BOOST_CONCEPT_ASSERT((boost::VertexListGraphConcept< DynamicCSR >));
+    BOOST_CONCEPT_ASSERT((boost::EdgeListGraphConcept< DynamicCSR >));
+
+    test_streaming_batches();
+    test_construct_and_traverse();
+    return boost::report_errors();
+}
@@ -0,0 +1,175 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#include <boost/graph/floyd_warshall_shortest.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <vector>
+
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::directedS,
+    boost::no_property, boost::property< boost::edge_weight_t, int > >
+    Graph;
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::undirectedS,
+    boost::no_property, boost::property< boost::edge_weight_t, double > >
+    UGraph;
+typedef std::vector< std::vector< int > > Matrix;
+
+const int inf = (std::numeric_limits< int >::max)();
+
+// Not std::less, so that the matrices below take the plain triple loop
+template < typename T > struct less_than
+{
+    bool operator()(const T& x, const T& y) const { return x < y; }
+};
+
+// Random edges with weights w + p(u) - p(v) for w >= 0, so that every cycle
+// is non-negative although many edges are negative
+Graph make_graph(std::size_t n, std::size_t m, int seed)
+{
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_int_distribution< std::size_t > vdist(0, n - 1);
+    boost::random::uniform_int_distribution< int > wdist(0, 20), pdist(0, 50);
+    std::vector< int > p(n);
+    for (std::size_t v = 0; v < n; ++v)
+        p[v] = pdist(gen);
+    Graph g(n);
+    for (std::size_t i = 0; i < m; ++i)
+    {
+        std::size_t u = vdist(gen), v = vdist(gen);
+        add_edge(u, v, wdist(gen) + p[u] - p[v], g);
+    }
+    return g;
+}
+
+template < typename G, typename T >
+bool reference(const G& g, std::vector< std::vector< T > >& d, T infinity)
+{
+    d.assign(num_vertices(g), std::vector< T >(num_vertices(g)));
+    return boost::floyd_warshall_all_pairs_shortest_paths(g, d,
+        get(boost::edge_weight, g), less_than< T >(),
+        boost::closed_plus< T >(infinity), infinity, T());
+}
+
+void test_directed()
+{
+    // 200 vertices make three full tiles and a partial one
+    Graph g = make_graph(200, 1200, 1);
+    Matrix expected;
+    BOOST_TEST(reference(g, expected, inf));
+    std::size_t unreachable = 0;
+    for (std::size_t i = 0; i < 200; ++i)
+        for (std::size_t j = 0; j < 200; ++j)
+            unreachable += expected[i][j] == inf;
+    BOOST_TEST(unreachable > 0);
+
+    for (std::size_t threads = 0; threads < 4; ++threads)
+    {
+        Matrix d(200, std::vector< int >(200));
+        BOOST_TEST(boost::floyd_warshall_all_pairs_shortest_paths(
+            g, d, boost::weight_map(get(boost::edge_weight, g))
+                      .num_threads(threads)));
+        BOOST_TEST(d == expected);
+    }
+
+    // Positional version, and rows longer than needed
+    Matrix d(210, std::vector< int >(220, 7));
+    BOOST_TEST(boost::floyd_warshall_all_pairs_shortest_paths(g, d,
+        get(boost::edge_weight, g), std::less< int >(),
+        boost::closed_plus< int >(inf), inf, 0, 2));
+    for (std::size_t i = 0; i < 200; ++i)
+        BOOST_TEST(std::equal(
+            expected[i].begin(), expected[i].end(), d[i].begin()));
+    BOOST_TEST_EQ(d[0][210], 7);
+    BOOST_TEST_EQ(d[205][0], 7);
+
+    // The initialized version continues from the given distances
+    Matrix e(expected);
+    BOOST_TEST(boost::floyd_warshall_initialized_all_pairs_shortest_paths(
+        g, e, boost::num_threads(3)));
+    BOOST_TEST(e == expected);
+}
+
+void test_negative_cycle()
+{
+    Graph g = make_graph(150, 600, 2);
+    // A cycle of total weight -1
+    add_edge(140, 141, -40, g);
+    add_edge(141, 142, 19, g);
+    add_edge(142, 140, 20, g);
+    Matrix expected;
+    BOOST_TEST(!reference(g, expected, inf));
+    for (std::size_t threads = 1; threads < 4; ++threads)
+    {
+        Matrix d(150, std::vector< int >(150));
+        BOOST_TEST(!boost::floyd_warshall_all_pairs_shortest_paths(
+            g, d, boost::num_threads(threads)));
+    }
+
+    // A negative self-loop alone
+    Graph h(3);
+    add_edge(0, 1, 2, h);
+    add_edge(1, 1, -1, h);
+    Matrix d(3, std::vector< int >(3));
+    BOOST_TEST(!boost::floyd_warshall_all_pairs_shortest_paths(h, d));
+}
+
+void test_undirected_double()
+{
+    boost::minstd_rand gen(3);
+    boost::random::uniform_int_distribution< std::size_t > vdist(0, 129);
+    boost::random::uniform_real_distribution< double > wdist(0.5, 10.0);
+    UGraph g(130);
+    for (int i = 0; i < 260; ++i)
+        add_edge(vdist(gen), vdist(gen), wdist(gen), g);
+
+    // A finite infinity, larger than any path
+    const double big = 1e9;
+    std::vector< std::vector< double > > expected, d(130,
+        std::vector< double >(130));
+    BOOST_TEST(reference(g, expected, big));
+    BOOST_TEST(boost::floyd_warshall_all_pairs_shortest_paths(g, d,
+        boost::weight_map(get(boost::edge_weight, g))
+            .distance_inf(big)
+            .num_threads(2)));
+    // Equal path lengths may round differently in another summation order
+    for (std::size_t i = 0; i < 130; ++i)
+        for (std::size_t j = 0; j < 130; ++j)
+        {
+            BOOST_TEST(std::abs(d[i][j] - expected[i][j]) < 1e-9);
+            BOOST_TEST(std::abs(d[i][j] - d[j][i]) < 1e-9);
+        }
+}
+
+void test_array()
+{
+    Graph g = make_graph(70, 300, 4);
+    Matrix expected;
+    BOOST_TEST(reference(g, expected, inf));
+    static int d[80][75];
+    BOOST_TEST(boost::floyd_warshall_all_pairs_shortest_paths(
+        g, d, boost::num_threads(2)));
+    for (std::size_t i = 0; i < 70; ++i)
+        for (std::size_t j = 0; j < 70; ++j)
+            BOOST_TEST_EQ(d[i][j], expected[i][j]);
+}
+
+int main()
+{
+    test_directed();
+    test_negative_cycle();
+    test_undirected_double();
+    test_array();
+    return boost::report_errors();
+}
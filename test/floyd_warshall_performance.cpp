@@ -0,0 +1,109 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Compares the plain triple loop of floyd_warshall_all_pairs_shortest_paths
+// with the blocked algorithm it uses for std::vector rows, on one thread and
+// on several, for a random directed graph with integer weights.  The plain
+// loop is skipped above 4096 vertices, where it takes hours.
+//
+// Usage: floyd_warshall_performance [num_vertices [average_degree [threads]]]
+
+#include <boost/graph/floyd_warshall_shortest.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+typedef boost::compressed_sparse_row_graph< boost::directedS,
+    boost::no_property, int >
+    Graph;
+typedef std::vector< std::vector< int > > Matrix;
+
+// Not std::less, which selects the blocked algorithm
+struct less_than
+{
+    bool operator()(int x, int y) const { return x < y; }
+};
+
+int main(int argc, char* argv[])
+{
+    std::size_t n = 1000;
+    std::size_t degree = 16;
+    std::size_t threads = 0;
+    if (argc > 1)
+        n = boost::lexical_cast< std::size_t >(argv[1]);
+    if (argc > 2)
+        degree = boost::lexical_cast< std::size_t >(argv[2]);
+    if (argc > 3)
+        threads = boost::lexical_cast< std::size_t >(argv[3]);
+    threads = boost::graph::detail::resolve_num_threads(threads);
+
+    boost::minstd_rand gen(5);
+    boost::random::uniform_int_distribution< std::size_t > vdist(0, n - 1);
+    boost::random::uniform_int_distribution< int > wdist(1, 1000);
+    std::vector< std::pair< std::size_t, std::size_t > > edge_list;
+    std::vector< int > weights;
+    for (std::size_t i = 0; i < n * degree; ++i)
+    {
+        edge_list.push_back(std::make_pair(vdist(gen), vdist(gen)));
+        weights.push_back(wdist(gen));
+    }
+    Graph g(boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), weights.begin(), n);
+    const int inf = (std::numeric_limits< int >::max)();
+
+    typedef std::chrono::steady_clock clock;
+    Matrix blocked(n, std::vector< int >(n));
+    clock::time_point start = clock::now();
+    BOOST_TEST(boost::floyd_warshall_all_pairs_shortest_paths(g, blocked,
+        boost::weight_map(get(boost::edge_bundle, g)).num_threads(1)));
+    const double serial_seconds
+        = std::chrono::duration< double >(clock::now() - start).count();
+
+    Matrix parallel(n, std::vector< int >(n));
+    start = clock::now();
+    BOOST_TEST(boost::floyd_warshall_all_pairs_shortest_paths(g, parallel,
+        boost::weight_map(get(boost::edge_bundle, g)).num_threads(threads)));
+    const double parallel_seconds
+        = std::chrono::duration< double >(clock::now() - start).count();
+    BOOST_TEST(parallel == blocked);
+
+    double plain_seconds = 0;
+    if (n <= 4096)
+    {
+        Matrix plain(n, std::vector< int >(n));
+        start = clock::now();
+        BOOST_TEST(boost::floyd_warshall_all_pairs_shortest_paths(g, plain,
+            get(boost::edge_bundle, g), less_than(),
+            boost::closed_plus< int >(inf), inf, 0));
+        plain_seconds
+            = std::chrono::duration< double >(clock::now() - start).count();
+        BOOST_TEST(plain == blocked);
+    }
+
+    std::cout << n << " vertices, " << num_edges(g) << " edges\n"
+              << std::setprecision(3);
+    if (plain_seconds > 0)
+        std::cout << std::left << std::setw(32) << "triple loop" << std::right
+                  << std::setw(10) << plain_seconds << " s\n";
+    std::cout << std::left << std::setw(32) << "blocked, num_threads(1)"
+              << std::right << std::setw(10) << serial_seconds << " s\n"
+              << std::left << std::setw(32)
+              << "blocked, num_threads("
+            + boost::lexical_cast< std::string >(threads) + ")"
+              << std::right << std::setw(10) << parallel_seconds << " s\n";
+    return boost::report_errors();
+}
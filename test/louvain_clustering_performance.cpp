@@ -0,0 +1,86 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Compares louvain_clustering with parallel_louvain_clustering on one
+// thread and on several, for a random graph with planted communities.
+//
+// Usage: louvain_clustering_performance [num_vertices [average_degree
+//        [community_size [threads]]]]
+
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/louvain_clustering.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using Graph = boost::adjacency_list<boost::vecS, boost::vecS, boost::undirectedS>;
+using edge_descriptor = boost::graph_traits<Graph>::edge_descriptor;
+
+int main(int argc, char* argv[])
+{
+    std::size_t n = 200000;
+    std::size_t degree = 16;
+    std::size_t community_size = 100;
+    std::size_t threads = 0;
+    if (argc > 1)
+        n = boost::lexical_cast<std::size_t>(argv[1]);
+    if (argc > 2)
+        degree = boost::lexical_cast<std::size_t>(argv[2]);
+    if (argc > 3)
+        community_size = boost::lexical_cast<std::size_t>(argv[3]);
+    if (argc > 4)
+        threads = boost::lexical_cast<std::size_t>(argv[4]);
+    threads = boost::graph::detail::resolve_num_threads(threads);
+
+    // Four in five edges stay inside their community
+    Graph g(n);
+    std::mt19937 gen(5);
+    std::uniform_int_distribution<std::size_t> any(0, n - 1);
+    std::uniform_int_distribution<std::size_t> near(0, community_size - 1);
+    for (std::size_t i = 0; i < n * degree / 2; ++i) {
+        std::size_t u = any(gen);
+        std::size_t v = i % 5 == 0 ? any(gen) : (std::min)(u - u % community_size + near(gen), n - 1);
+        if (u != v) {
+            add_edge(u, v, g);
+        }
+    }
+    boost::static_property_map<double, edge_descriptor> weight(1.0);
+    auto index = get(boost::vertex_index, g);
+
+    using clock = std::chrono::steady_clock;
+    std::vector<std::size_t> serial(n), one(n), many(n);
+    std::mt19937 gen_serial(1), gen_one(1), gen_many(1);
+    clock::time_point start = clock::now();
+    double Q_serial = boost::louvain_clustering(g, boost::make_iterator_property_map(serial.begin(), index), weight, gen_serial);
+    double serial_seconds = std::chrono::duration<double>(clock::now() - start).count();
+
+    start = clock::now();
+    double Q_one = boost::parallel_louvain_clustering(g, boost::make_iterator_property_map(one.begin(), index), weight, gen_one, boost::newman_and_girvan{}, 0.0, 0.0, 1);
+    double one_seconds = std::chrono::duration<double>(clock::now() - start).count();
+
+    start = clock::now();
+    double Q_many = boost::parallel_louvain_clustering(g, boost::make_iterator_property_map(many.begin(), index), weight, gen_many, boost::newman_and_girvan{}, 0.0, 0.0, threads);
+    double many_seconds = std::chrono::duration<double>(clock::now() - start).count();
+    BOOST_TEST(many == one);
+    BOOST_TEST(Q_one > Q_serial - 0.01);
+
+    std::cout << n << " vertices, " << num_edges(g) << " edges\n"
+              << std::setprecision(4) << std::left << std::setw(36) << "louvain_clustering"
+              << std::right << std::setw(10) << serial_seconds << " s, Q = " << Q_serial << "\n"
+              << std::left << std::setw(36) << "parallel, num_threads(1)"
+              << std::right << std::setw(10) << one_seconds << " s, Q = " << Q_one << "\n"
+              << std::left << std::setw(36)
+              << "parallel, num_threads(" + boost::lexical_cast<std::string>(threads) + ")"
+              << std::right << std::setw(10) << many_seconds << " s, Q = " << Q_many << "\n";
+    return boost::report_errors();
+}
@@ -0,0 +1,109 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#include <boost/graph/narrowest_csr_graph.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/cstdint.hpp>
+#include <utility>
+#include <vector>
+
+typedef std::vector< std::pair< std::size_t, std::size_t > > EdgeList;
+
+// Runs Dijkstra from vertex 0 and records the distances and the size of the
+// graph's index types
+struct distances_visitor
+{
+    std::vector< double >* distances;
+    std::size_t* vertex_size;
+    std::size_t* edge_index_size;
+
+    template < typename Graph > void operator()(const Graph& g) const
+    {
+        distances->assign(num_vertices(g), 0.);
+        boost::dijkstra_shortest_paths(g, vertex(0, g),
+            boost::weight_map(get(boost::edge_bundle, g))
+                .distance_map(boost::make_iterator_property_map(
+                    distances->begin(), get(boost::vertex_index, g))));
+        *vertex_size = sizeof(typename Graph::vertex_descriptor);
+        *edge_index_size = sizeof(typename Graph::edges_size_type);
+    }
+};
+
+void test_width_selection()
+{
+    using boost::uint32_t;
+    const boost::uintmax_t max32 = 0xFFFFFFFFu;
+    BOOST_TEST(boost::narrowest_csr_index_width(0, 0) == boost::csr_index_32_32);
+    BOOST_TEST(boost::narrowest_csr_index_width(max32 - 1, max32)
+        == boost::csr_index_32_32);
+    // The largest vertex value is null_vertex()
+    BOOST_TEST(boost::narrowest_csr_index_width(max32, 10)
+        == boost::csr_index_64_64);
+    BOOST_TEST(boost::narrowest_csr_index_width(1000, max32 + 1)
+        == boost::csr_index_32_64);
+    BOOST_TEST(boost::narrowest_csr_index_width(max32 + 1, max32 + 1)
+        == boost::csr_index_64_64);
+    BOOST_TEST((boost::csr_index_types_fit< boost::uint16_t, uint32_t >(
+        65534, 100000)));
+    BOOST_TEST(!(boost::csr_index_types_fit< boost::uint16_t, uint32_t >(
+        65535, 100000)));
+}
+
+void test_visit()
+{
+    EdgeList edge_list;
+    std::vector< double > weights;
+    const std::size_t n = 100;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        edge_list.push_back(std::make_pair(i, (i * 7 + 3) % n));
+        weights.push_back(double(i % 5 + 1));
+        edge_list.push_back(std::make_pair(i, (i + 1) % n));
+        weights.push_back(10.);
+    }
+
+    boost::compressed_sparse_row_graph< boost::directedS, boost::no_property,
+        double >
+        wide(boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+            edge_list.end(), weights.begin(), n);
+    std::vector< double > expected(n);
+    boost::dijkstra_shortest_paths(wide, 0,
+        boost::weight_map(get(boost::edge_bundle, wide))
+            .distance_map(boost::make_iterator_property_map(
+                expected.begin(), get(boost::vertex_index, wide))));
+
+    std::vector< double > distances;
+    std::size_t vertex_size = 0, edge_index_size = 0;
+    distances_visitor vis = { &distances, &vertex_size, &edge_index_size };
+    boost::csr_index_width width = boost::visit_narrowest_csr_graph<
+        boost::directedS, boost::no_property, double >(
+        boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), weights.begin(), n, vis);
+    BOOST_TEST(width == boost::csr_index_32_32);
+    BOOST_TEST_EQ(vertex_size, 4u);
+    BOOST_TEST_EQ(edge_index_size, 4u);
+    BOOST_TEST(distances == expected);
+
+    // Without edge properties, using a generic lambda
+    std::size_t edges_seen = 0;
+    width = boost::visit_narrowest_csr_graph(
+        boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), n,
+        [&](const auto& g) { edges_seen = num_edges(g); });
+    BOOST_TEST(width == boost::csr_index_32_32);
+    BOOST_TEST_EQ(edges_seen, edge_list.size());
+}
+
+int main()
+{
+    test_width_selection();
+    test_visit();
+    return boost::report_errors();
+}
@@ -0,0 +1,81 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Times 20 iterations of page_rank and of parallel_page_rank, on one
+// thread and on several, for a random bidirectional CSR graph.
+//
+// Usage: page_rank_performance [num_vertices [average_degree [threads]]]
+
+#include <boost/graph/page_rank.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+typedef boost::compressed_sparse_row_graph< boost::bidirectionalS > Graph;
+
+int main(int argc, char* argv[])
+{
+    std::size_t n = 1000000;
+    std::size_t degree = 8;
+    std::size_t threads = 0;
+    if (argc > 1)
+        n = boost::lexical_cast< std::size_t >(argv[1]);
+    if (argc > 2)
+        degree = boost::lexical_cast< std::size_t >(argv[2]);
+    if (argc > 3)
+        threads = boost::lexical_cast< std::size_t >(argv[3]);
+    threads = boost::graph::detail::resolve_num_threads(threads);
+
+    boost::minstd_rand gen(5);
+    boost::random::uniform_int_distribution< std::size_t > vdist(0, n - 1);
+    std::vector< std::pair< std::size_t, std::size_t > > edge_list;
+    for (std::size_t i = 0; i < n * degree; ++i)
+        edge_list.push_back(std::make_pair(vdist(gen), vdist(gen)));
+    Graph g(boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), n);
+
+    typedef std::chrono::steady_clock clock;
+    std::vector< double > serial(n), one(n), many(n);
+    clock::time_point start = clock::now();
+    boost::graph::page_rank(g, serial.data());
+    const double serial_seconds
+        = std::chrono::duration< double >(clock::now() - start).count();
+
+    start = clock::now();
+    boost::graph::parallel_page_rank(
+        g, one.data(), boost::graph::n_iterations(20), 0.85, 1);
+    const double one_seconds
+        = std::chrono::duration< double >(clock::now() - start).count();
+
+    start = clock::now();
+    boost::graph::parallel_page_rank(
+        g, many.data(), boost::graph::n_iterations(20), 0.85, threads);
+    const double many_seconds
+        = std::chrono::duration< double >(clock::now() - start).count();
+    BOOST_TEST(many == one);
+
+    std::cout << n << " vertices, " << num_edges(g) << " edges\n"
+              << std::setprecision(3) << std::left << std::setw(32)
+              << "page_rank" << std::right << std::setw(10) << serial_seconds
+              << " s\n"
+              << std::left << std::setw(32) << "parallel, num_threads(1)"
+              << std::right << std::setw(10) << one_seconds << " s\n"
+              << std::left << std::setw(32)
+              << "parallel, num_threads("
+            + boost::lexical_cast< std::string >(threads) + ")"
+              << std::right << std::setw(10) << many_seconds << " s\n";
+    return boost::report_errors();
+}
@@ -0,0 +1,141 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#include <boost/graph/betweenness_centrality.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+typedef boost::property< boost::edge_weight_t, int,
+    boost::property< boost::edge_index_t, std::size_t > >
+    EdgeProperties;
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::directedS,
+    boost::no_property, EdgeProperties >
+    Graph;
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::undirectedS,
+    boost::no_property, EdgeProperties >
+    UGraph;
+
+// Random edges with small weights, so that many shortest paths tie
+template < typename G > G make_graph(std::size_t n, std::size_t m, int seed)
+{
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_int_distribution< std::size_t > vdist(0, n - 1);
+    boost::random::uniform_int_distribution< int > wdist(1, 3);
+    G g(n);
+    for (std::size_t i = 0; i < m; ++i)
+        add_edge(vdist(gen), vdist(gen), EdgeProperties(wdist(gen), i), g);
+    return g;
+}
+
+// Sums of other orders round differently
+bool close(const std::vector< double >& x, const std::vector< double >& y)
+{
+    if (x.size() != y.size())
+        return false;
+    for (std::size_t i = 0; i < x.size(); ++i)
+        if (std::abs(x[i] - y[i]) > 1e-9 * (1 + std::abs(y[i])))
+            return false;
+    return true;
+}
+
+template < typename G > void test_against_serial(const G& g)
+{
+    const std::size_t n = num_vertices(g), m = num_edges(g);
+    std::vector< double > c(n), ec(m), wc(n), wec(m);
+    boost::brandes_betweenness_centrality(g,
+        boost::centrality_map(c.data()).edge_centrality_map(
+            boost::make_iterator_property_map(
+                ec.begin(), get(boost::edge_index, g))));
+    boost::brandes_betweenness_centrality(g,
+        boost::centrality_map(wc.data())
+            .edge_centrality_map(boost::make_iterator_property_map(
+                wec.begin(), get(boost::edge_index, g)))
+            .weight_map(get(boost::edge_weight, g)));
+
+    for (std::size_t threads = 1; threads < 5; ++threads)
+    {
+        std::vector< double > pc(n, -1), pec(m, -1);
+        boost::parallel_brandes_betweenness_centrality(g,
+            boost::centrality_map(pc.data())
+                .edge_centrality_map(boost::make_iterator_property_map(
+                    pec.begin(), get(boost::edge_index, g)))
+                .num_threads(threads));
+        BOOST_TEST(close(pc, c));
+        BOOST_TEST(close(pec, ec));
+
+        boost::parallel_brandes_betweenness_centrality(g, pc.data(),
+            boost::make_iterator_property_map(
+                pec.begin(), get(boost::edge_index, g)),
+            get(boost::vertex_index, g), get(boost::edge_index, g),
+            get(boost::edge_weight, g), threads, threads % 2 == 0);
+        BOOST_TEST(close(pc, wc));
+        BOOST_TEST(close(pec, wec));
+    }
+
+    // Vertex centrality alone, needing no edge index, with the default
+    // number of threads
+    std::vector< double > pc(n, -1);
+    boost::parallel_brandes_betweenness_centrality(g, pc.data());
+    BOOST_TEST(close(pc, c));
+}
+
+void test_deterministic()
+{
+    Graph g = make_graph< Graph >(300, 1500, 3);
+    std::vector< double > first(300), again(300);
+    boost::parallel_brandes_betweenness_centrality(g,
+        boost::centrality_map(first.data())
+            .weight_map(get(boost::edge_weight, g))
+            .num_threads(3)
+            .deterministic_reduction(true));
+    for (int run = 0; run < 3; ++run)
+    {
+        boost::parallel_brandes_betweenness_centrality(g,
+            boost::centrality_map(again.data())
+                .weight_map(get(boost::edge_weight, g))
+                .num_threads(3)
+                .deterministic_reduction(true));
+        BOOST_TEST(again == first);
+    }
+}
+
+void test_csr_edges_only()
+{
+    typedef boost::compressed_sparse_row_graph< boost::directedS > CSR;
+    typedef std::pair< std::size_t, std::size_t > Pair;
+    // Two disjoint paths from 0 to 5, and an unreachable vertex 6
+    const Pair pairs[] = { Pair(0, 1), Pair(0, 2), Pair(1, 3), Pair(2, 4),
+        Pair(3, 5), Pair(4, 5) };
+    CSR g(boost::edges_are_sorted, pairs, pairs + 6, 7);
+    std::vector< double > ec(6, -1);
+    boost::parallel_brandes_betweenness_centrality(g,
+        boost::edge_centrality_map(boost::make_iterator_property_map(
+                                       ec.begin(), get(boost::edge_index, g)))
+            .num_threads(2));
+    // Edge (0, 1) carries the paths 0-1 and 0-3 and half of 0-5; edge
+    // (1, 3) also carries 1-3 and 1-5
+    BOOST_TEST_EQ(ec[0], 2.5);
+    BOOST_TEST_EQ(ec[1], 2.5);
+    BOOST_TEST_EQ(ec[2], 3.5);
+    BOOST_TEST_EQ(ec[4], 2.5);
+}
+
+int main()
+{
+    test_against_serial(make_graph< Graph >(200, 800, 1));
+    test_against_serial(make_graph< UGraph >(150, 400, 2));
+    test_deterministic();
+    test_csr_edges_only();
+    return boost::report_errors();
+}
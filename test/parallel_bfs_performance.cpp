@@ -0,0 +1,95 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Compares the traversal rate of breadth_first_search and
+// parallel_breadth_first_search on a bidirectional CSR graph whose
+// out-degrees follow a power law, as in low-diameter social networks.
+//
+// Usage: parallel_bfs_performance [num_vertices [average_degree [threads]]]
+
+#include <boost/graph/parallel_breadth_first_search.hpp>
+#include <boost/graph/breadth_first_search.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <utility>
+#include <vector>
+
+typedef boost::compressed_sparse_row_graph< boost::bidirectionalS > Graph;
+typedef std::vector< std::pair< std::size_t, std::size_t > > EdgeList;
+
+int main(int argc, char* argv[])
+{
+    std::size_t n = 1000000;
+    std::size_t degree = 16;
+    std::size_t threads = 0;
+    if (argc > 1)
+        n = boost::lexical_cast< std::size_t >(argv[1]);
+    if (argc > 2)
+        degree = boost::lexical_cast< std::size_t >(argv[2]);
+    if (argc > 3)
+        threads = boost::lexical_cast< std::size_t >(argv[3]);
+    const int repeats = 4;
+
+    // Sources drawn with probability decreasing as 1/sqrt(rank)
+    boost::minstd_rand gen(3);
+    boost::random::uniform_real_distribution< double > unit(0, 1);
+    boost::random::uniform_int_distribution< std::size_t > vdist(0, n - 1);
+    EdgeList edge_list;
+    for (std::size_t i = 0; i < n * degree; ++i)
+    {
+        double x = unit(gen);
+        edge_list.push_back(
+            std::make_pair(std::size_t(double(n - 1) * x * x), vdist(gen)));
+    }
+    Graph g(boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), n);
+    const double m = double(num_edges(g));
+
+    typedef std::chrono::steady_clock clock;
+    std::vector< std::size_t > serial(n), parallel(n);
+    double serial_seconds = 0, parallel_seconds = 0;
+    for (int i = 0; i < repeats; ++i)
+    {
+        std::size_t s = vdist(gen) % (n / 100 + 1);
+        std::fill(serial.begin(), serial.end(),
+            (std::numeric_limits< std::size_t >::max)());
+        serial[s] = 0;
+        clock::time_point start = clock::now();
+        boost::breadth_first_search(g, s,
+            boost::visitor(boost::make_bfs_visitor(
+                boost::record_distances(&serial[0], boost::on_tree_edge()))));
+        serial_seconds
+            += std::chrono::duration< double >(clock::now() - start).count();
+
+        start = clock::now();
+        boost::parallel_breadth_first_search(g, s,
+            boost::distance_map(&parallel[0]).num_threads(threads));
+        parallel_seconds
+            += std::chrono::duration< double >(clock::now() - start).count();
+        BOOST_TEST(serial == parallel);
+    }
+
+    std::cout << n << " vertices, " << num_edges(g) << " edges, " << repeats
+              << " sources\n"
+              << std::left << std::setw(32) << "breadth_first_search"
+              << std::right << std::setw(10) << std::setprecision(3)
+              << m * repeats / serial_seconds / 1e6 << " Me/s\n"
+              << std::left << std::setw(32)
+              << "parallel_breadth_first_search" << std::right
+              << std::setw(10) << m * repeats / parallel_seconds / 1e6
+              << " Me/s\n";
+    return boost::report_errors();
+}
@@ -0,0 +1,182 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#include <boost/graph/parallel_breadth_first_search.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/breadth_first_search.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/iteration_macros.hpp>
+#include <boost/graph/visitors.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+typedef boost::compressed_sparse_row_graph< boost::directedS > DirCSR;
+typedef boost::compressed_sparse_row_graph< boost::bidirectionalS > BidirCSR;
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::undirectedS >
+    UndirGraph;
+typedef std::vector< std::pair< std::size_t, std::size_t > > EdgeList;
+
+// A graph with a few hubs, so that the frontier grows quickly and the
+// search turns bottom-up, plus a long path that turns it back top-down
+EdgeList make_edges(std::size_t n, std::size_t m, std::size_t path)
+{
+    boost::minstd_rand gen(11);
+    boost::random::uniform_int_distribution< std::size_t > vdist(
+        0, n - path - 1);
+    boost::random::uniform_int_distribution< std::size_t > hub(0, 15);
+    EdgeList edges;
+    for (std::size_t i = 0; i < m; ++i)
+    {
+        std::size_t u = vdist(gen), v = vdist(gen);
+        edges.push_back(std::make_pair(i % 3 == 0 ? hub(gen) : u, v));
+    }
+    for (std::size_t i = n - path - 1; i + 1 < n; ++i)
+        edges.push_back(std::make_pair(i, i + 1));
+    return edges;
+}
+
+template < typename Graph >
+std::vector< std::size_t > serial_distances(
+    const Graph& g, typename boost::graph_traits< Graph >::vertex_descriptor s)
+{
+    std::vector< std::size_t > d(
+        num_vertices(g), (std::numeric_limits< std::size_t >::max)());
+    d[get(boost::vertex_index, g, s)] = 0;
+    boost::breadth_first_search(g, s,
+        boost::visitor(boost::make_bfs_visitor(boost::record_distances(
+            boost::make_iterator_property_map(
+                d.begin(), get(boost::vertex_index, g)),
+            boost::on_tree_edge()))));
+    return d;
+}
+
+template < typename Graph >
+void check_search(const Graph& g,
+    typename boost::graph_traits< Graph >::vertex_descriptor s,
+    std::size_t num_threads)
+{
+    typedef typename boost::graph_traits< Graph >::vertex_descriptor Vertex;
+    std::vector< std::size_t > expected = serial_distances(g, s);
+    std::vector< std::size_t > d(num_vertices(g));
+    std::vector< Vertex > p(num_vertices(g));
+    boost::parallel_breadth_first_search(g, s,
+        boost::distance_map(
+            boost::make_iterator_property_map(
+                d.begin(), get(boost::vertex_index, g)))
+            .predecessor_map(boost::make_iterator_property_map(
+                p.begin(), get(boost::vertex_index, g)))
+            .num_threads(num_threads));
+    BOOST_TEST(d == expected);
+
+    // Every reached vertex other than s hangs off a vertex one level up
+    BGL_FORALL_VERTICES_T(v, g, Graph)
+    {
+        std::size_t vi = get(boost::vertex_index, g, v);
+        if (v == s || d[vi] == (std::numeric_limits< std::size_t >::max)())
+        {
+            BOOST_TEST(p[vi] == v);
+            continue;
+        }
+        std::size_t pi = get(boost::vertex_index, g, p[vi]);
+        BOOST_TEST_EQ(d[pi] + 1, d[vi]);
+        bool is_edge = false;
+        BGL_FORALL_OUTEDGES_T(p[vi], e, g, Graph)
+        is_edge = is_edge || target(e, g) == v;
+        BOOST_TEST(is_edge);
+    }
+}
+
+void test_graph_types()
+{
+    const std::size_t n = 20000;
+    EdgeList edges = make_edges(n, 120000, 300);
+    DirCSR dg(boost::edges_are_unsorted_multi_pass, edges.begin(),
+        edges.end(), n);
+    BidirCSR bg(boost::edges_are_unsorted_multi_pass, edges.begin(),
+        edges.end(), n);
+    UndirGraph ug(edges.begin(), edges.end(), n);
+
+    const std::size_t thread_counts[] = { 1, 2, 4, 0 };
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        check_search(dg, 0, thread_counts[i]);
+        check_search(bg, 0, thread_counts[i]);
+        check_search(ug, 0, thread_counts[i]);
+        // Starting on the path, where the first levels are tiny
+        check_search(ug, n - 200, thread_counts[i]);
+    }
+}
+
+void test_small_cases()
+{
+    // Single vertex, isolated source, and unreachable parts
+    UndirGraph one(1);
+    check_search(one, 0, 2);
+
+    EdgeList edges;
+    edges.push_back(std::make_pair(1, 2));
+    edges.push_back(std::make_pair(2, 3));
+    BidirCSR g(boost::edges_are_unsorted_multi_pass, edges.begin(),
+        edges.end(), 5);
+    check_search(g, 0, 3);
+    check_search(g, 1, 3);
+
+    // Positional form with distances of another type
+    std::vector< double > d(5);
+    std::vector< std::size_t > p(5);
+    boost::parallel_breadth_first_search(g, 1, &d[0], &p[0],
+        get(boost::vertex_index, g), 2);
+    BOOST_TEST_EQ(d[3], 2.0);
+    BOOST_TEST_EQ(p[3], 2u);
+    BOOST_TEST_EQ(d[0], (std::numeric_limits< double >::max)());
+}
+
+// A predecessor map that fails once the search reaches a given vertex
+struct failing_predecessor_map
+{
+    typedef std::size_t key_type;
+    typedef std::size_t value_type;
+    typedef std::size_t reference;
+    typedef boost::writable_property_map_tag category;
+    std::size_t fail_at;
+};
+
+void put(failing_predecessor_map m, std::size_t v, std::size_t u)
+{
+    if (v == m.fail_at && u != v)
+        throw std::runtime_error("put");
+}
+
+void test_exceptions()
+{
+    // A worker that throws releases the others waiting at the next level
+    const std::size_t n = 20000;
+    EdgeList edges = make_edges(n, 120000, 300);
+    BidirCSR g(boost::edges_are_unsorted_multi_pass, edges.begin(),
+        edges.end(), n);
+    std::vector< std::size_t > d(n);
+    failing_predecessor_map p = { n - 100 };
+    BOOST_TEST_THROWS(boost::parallel_breadth_first_search(g, 0,
+                          boost::distance_map(&d[0])
+                              .predecessor_map(p)
+                              .num_threads(4)),
+        std::runtime_error);
+}
+
+int main()
+{
+    test_graph_types();
+    test_small_cases();
+    test_exceptions();
+    return boost::report_errors();
+}
@@ -0,0 +1,182 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#include <boost/graph/johnson_all_pairs_shortest.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <limits>
+#include <utility>
+#include <vector>
+
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::directedS,
+    boost::no_property, boost::property< boost::edge_weight_t, int > >
+    Graph;
+typedef boost::graph_traits< Graph >::vertex_descriptor Vertex;
+typedef std::vector< std::vector< int > > Matrix;
+
+const int inf = (std::numeric_limits< int >::max)();
+
+// Random edges with weights w + p(u) - p(v) for w >= 0, so that every cycle
+// is non-negative although many edges are negative
+Graph make_graph(std::size_t n, std::size_t m, int seed)
+{
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_int_distribution< std::size_t > vdist(0, n - 1);
+    boost::random::uniform_int_distribution< int > wdist(0, 20), pdist(0, 50);
+    std::vector< int > p(n);
+    for (std::size_t v = 0; v < n; ++v)
+        p[v] = pdist(gen);
+    Graph g(n);
+    for (std::size_t i = 0; i < m; ++i)
+    {
+        std::size_t u = vdist(gen), v = vdist(gen);
+        add_edge(u, v, wdist(gen) + p[u] - p[v], g);
+    }
+    return g;
+}
+
+// Stores each row and counts the calls; the rows of distinct sources are
+// distinct, so the threads never write to the same entry
+template < typename T > struct row_collector
+{
+    template < typename V > void operator()(V s, const std::vector< T >& row)
+    {
+        (*m_rows)[s] = row;
+        ++(*m_calls)[s];
+    }
+
+    std::vector< std::vector< T > >* m_rows;
+    std::vector< int >* m_calls;
+};
+
+template < typename T >
+row_collector< T > collect(
+    std::vector< std::vector< T > >& rows, std::vector< int >& calls)
+{
+    row_collector< T > f = { &rows, &calls };
+    return f;
+}
+
+void test_negative_weights()
+{
+    Graph g = make_graph(300, 1500, 1);
+    Matrix expected(300, std::vector< int >(300));
+    BOOST_TEST(boost::johnson_all_pairs_shortest_paths(g, expected));
+
+    for (std::size_t threads = 1; threads < 5; ++threads)
+    {
+        Matrix rows(300);
+        std::vector< int > calls(300, 0);
+        BOOST_TEST(boost::parallel_johnson_all_pairs_shortest_paths(g,
+            collect(rows, calls), get(boost::edge_weight, g),
+            get(boost::vertex_index, g), threads));
+        BOOST_TEST(rows == expected);
+        BOOST_TEST(calls == std::vector< int >(300, 1));
+    }
+
+    // Into one row-major array, as for a mapped file
+    std::vector< int > flat(300 * 300, -1);
+    BOOST_TEST(boost::parallel_johnson_all_pairs_shortest_paths(g,
+        boost::make_distance_row_writer(
+            flat.data(), get(boost::vertex_index, g)),
+        boost::num_threads(3)));
+    for (std::size_t u = 0; u < 300; ++u)
+        for (std::size_t v = 0; v < 300; ++v)
+            BOOST_TEST_EQ(flat[u * 300 + v], expected[u][v]);
+}
+
+void test_negative_cycle()
+{
+    Graph g = make_graph(200, 800, 2);
+    add_edge(150, 151, -40, g);
+    add_edge(151, 152, 19, g);
+    add_edge(152, 150, 20, g);
+    for (std::size_t threads = 1; threads < 4; ++threads)
+    {
+        Matrix rows(200);
+        std::vector< int > calls(200, 0);
+        BOOST_TEST(!boost::parallel_johnson_all_pairs_shortest_paths(g,
+            collect(rows, calls),
+            boost::weight_map(get(boost::edge_weight, g))
+                .num_threads(threads)));
+        BOOST_TEST(calls == std::vector< int >(200, 0));
+    }
+}
+
+void test_csr_unreachable()
+{
+    // Two one-way chains with non-negative weights; nothing leads back
+    typedef boost::compressed_sparse_row_graph< boost::directedS,
+        boost::no_property, unsigned >
+        CSR;
+    typedef std::pair< std::size_t, std::size_t > Pair;
+    std::vector< Pair > edges;
+    std::vector< unsigned > weights;
+    for (std::size_t v = 0; v + 1 < 100; ++v)
+        if (v != 49)
+        {
+            edges.push_back(Pair(v, v + 1));
+            weights.push_back(unsigned(v % 7));
+        }
+    CSR g(boost::edges_are_sorted, edges.begin(), edges.end(),
+        weights.begin(), 100);
+
+    std::vector< std::vector< unsigned > > rows(100);
+    std::vector< int > calls(100, 0);
+    BOOST_TEST(boost::parallel_johnson_all_pairs_shortest_paths(g,
+        collect(rows, calls),
+        boost::weight_map(get(boost::edge_bundle, g)).num_threads(2)));
+    for (std::size_t s = 0; s < 100; ++s)
+    {
+        std::vector< unsigned > d(100);
+        boost::dijkstra_shortest_paths(g, s,
+            boost::weight_map(get(boost::edge_bundle, g))
+                .distance_map(d.data()));
+        BOOST_TEST(rows[s] == d);
+        BOOST_TEST_EQ(calls[s], 1);
+    }
+    BOOST_TEST_EQ(rows[10][60], (std::numeric_limits< unsigned >::max)());
+}
+
+void test_undirected()
+{
+    typedef boost::adjacency_list< boost::vecS, boost::vecS,
+        boost::undirectedS, boost::no_property,
+        boost::property< boost::edge_weight_t, int > >
+        UGraph;
+    boost::minstd_rand gen(5);
+    boost::random::uniform_int_distribution< std::size_t > vdist(0, 79);
+    boost::random::uniform_int_distribution< int > wdist(1, 30);
+    UGraph g(80);
+    for (int i = 0; i < 200; ++i)
+        add_edge(vdist(gen), vdist(gen), wdist(gen), g);
+    Matrix expected(80, std::vector< int >(80)), rows(80);
+    BOOST_TEST(boost::johnson_all_pairs_shortest_paths(g, expected));
+    std::vector< int > calls(80, 0);
+    BOOST_TEST(boost::parallel_johnson_all_pairs_shortest_paths(
+        g, collect(rows, calls)));
+    BOOST_TEST(rows == expected);
+
+    // A negative undirected edge is a negative cycle
+    add_edge(3, 4, -1, g);
+    BOOST_TEST(!boost::parallel_johnson_all_pairs_shortest_paths(
+        g, collect(rows, calls)));
+}
+
+int main()
+{
+    test_negative_weights();
+    test_negative_cycle();
+    test_csr_unreachable();
+    test_undirected();
+    return boost::report_errors();
+}
@@ -0,0 +1,185 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/louvain_clustering.hpp>
+#include <boost/graph/louvain_quality_functions.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cmath>
+#include <random>
+#include <set>
+#include <vector>
+
+using Graph = boost::adjacency_list<boost::vecS, boost::vecS, boost::undirectedS>;
+using WeightedGraph = boost::adjacency_list<boost::vecS, boost::vecS, boost::undirectedS, boost::no_property, boost::property<boost::edge_weight_t, double>>;
+using ListGraph = boost::adjacency_list<boost::vecS, boost::listS, boost::undirectedS, boost::property<boost::vertex_index_t, std::size_t>, boost::property<boost::edge_weight_t, double>>;
+using edge_descriptor = boost::graph_traits<Graph>::edge_descriptor;
+
+// Planted partition: dense blocks with sparse links between them
+Graph make_planted_partition(std::size_t num_blocks, std::size_t block_size, double p_in, double p_out, unsigned seed)
+{
+    std::size_t n = num_blocks * block_size;
+    Graph g(n);
+    std::mt19937 gen(seed);
+    std::bernoulli_distribution in(p_in), out(p_out);
+    for (std::size_t u = 0; u < n; ++u) {
+        for (std::size_t v = u + 1; v < n; ++v) {
+            bool same = u / block_size == v / block_size;
+            if (same ? in(gen) : out(gen)) {
+                add_edge(u, v, g);
+            }
+        }
+    }
+    return g;
+}
+
+// The modularity of a partition, with the quality function of the serial algorithm
+template <typename G, typename WeightMap>
+double modularity(const G& g, const std::vector<std::size_t>& clusters, const WeightMap& w)
+{
+    auto cmap = boost::make_iterator_property_map(clusters.begin(), get(boost::vertex_index, g));
+    return boost::newman_and_girvan{}.quality(g, cmap, w);
+}
+
+void test_planted_partition()
+{
+    Graph g = make_planted_partition(20, 50, 0.3, 0.005, 1);
+    std::size_t n = num_vertices(g);
+    boost::static_property_map<double, edge_descriptor> weight_map(1.0);
+
+    std::vector<std::size_t> serial(n);
+    std::mt19937 gen(42);
+    double Q_serial = boost::louvain_clustering(g, boost::make_iterator_property_map(serial.begin(), get(boost::vertex_index, g)), weight_map, gen);
+
+    std::vector<std::size_t> first;
+    for (std::size_t threads = 1; threads < 5; ++threads) {
+        std::vector<std::size_t> clusters(n);
+        std::mt19937 pgen(42);
+        double Q = boost::parallel_louvain_clustering(g, boost::make_iterator_property_map(clusters.begin(), get(boost::vertex_index, g)), weight_map, pgen, boost::newman_and_girvan{}, 0.0, 0.0, threads);
+
+        // Comparable to the serial algorithm, and what it reports
+        BOOST_TEST(Q > Q_serial - 0.01);
+        BOOST_TEST(std::abs(Q - modularity(g, clusters, weight_map)) < 1e-9);
+
+        // The planted blocks are found
+        std::set<std::size_t> unique_communities(clusters.begin(), clusters.end());
+        BOOST_TEST_EQ(unique_communities.size(), 20u);
+        BOOST_TEST_EQ(*unique_communities.rbegin(), 19u);
+
+        // The same partition on any number of threads
+        if (threads == 1) {
+            first = clusters;
+        }
+        BOOST_TEST(clusters == first);
+    }
+}
+
+void test_ring_of_cliques()
+{
+    const int num_cliques = 30;
+    const int clique_size = 5;
+    WeightedGraph g(num_cliques * clique_size);
+    for (int c = 0; c < num_cliques; ++c) {
+        int base = c * clique_size;
+        for (int i = 0; i < clique_size; ++i) {
+            for (int j = i + 1; j < clique_size; ++j) {
+                boost::add_edge(base + i, base + j, {1.0}, g);
+            }
+        }
+        boost::add_edge(base + clique_size - 1, ((c + 1) % num_cliques) * clique_size, {1.0}, g);
+    }
+    // Self-loops count towards the degrees and the internal weights
+    boost::add_edge(0, 0, {2.0}, g);
+
+    std::vector<std::size_t> clusters(num_vertices(g));
+    std::mt19937 gen(7);
+    double Q = boost::parallel_louvain_clustering(g, boost::make_iterator_property_map(clusters.begin(), get(boost::vertex_index, g)), get(boost::edge_weight, g), gen, boost::newman_and_girvan{}, 0.0, 0.0, 3);
+
+    BOOST_TEST(Q > 0.80);
+    BOOST_TEST(std::abs(Q - modularity(g, clusters, get(boost::edge_weight, g))) < 1e-9);
+    std::set<std::size_t> unique_communities(clusters.begin(), clusters.end());
+    BOOST_TEST(unique_communities.size() > 1);
+    BOOST_TEST(unique_communities.size() <= std::size_t(num_cliques));
+}
+
+void test_list_graph()
+{
+    // Vertices that are not integers, numbered by an interior index
+    ListGraph g;
+    std::vector<boost::graph_traits<ListGraph>::vertex_descriptor> v;
+    for (std::size_t i = 0; i < 6; ++i) {
+        v.push_back(add_vertex(i, g));
+    }
+    boost::add_edge(v[0], v[1], 5.0, g);
+    boost::add_edge(v[1], v[2], 5.0, g);
+    boost::add_edge(v[0], v[2], 5.0, g);
+    boost::add_edge(v[3], v[4], 5.0, g);
+    boost::add_edge(v[4], v[5], 5.0, g);
+    boost::add_edge(v[3], v[5], 5.0, g);
+    boost::add_edge(v[2], v[3], 0.01, g);
+
+    std::vector<std::size_t> clusters(6);
+    std::mt19937 gen(3);
+    double Q = boost::parallel_louvain_clustering(g, boost::make_iterator_property_map(clusters.begin(), get(boost::vertex_index, g)), get(boost::edge_weight, g), gen);
+    BOOST_TEST(Q > 0.49);
+    BOOST_TEST_EQ(clusters[0], clusters[1]);
+    BOOST_TEST_EQ(clusters[0], clusters[2]);
+    BOOST_TEST_EQ(clusters[3], clusters[4]);
+    BOOST_TEST_EQ(clusters[3], clusters[5]);
+    BOOST_TEST(clusters[0] != clusters[3]);
+}
+
+void test_parallel_aggregate()
+{
+    // Barbell: two triangles joined by one edge
+    WeightedGraph g(6);
+    boost::add_edge(0, 1, {1.0}, g);
+    boost::add_edge(1, 2, {1.0}, g);
+    boost::add_edge(0, 2, {1.0}, g);
+    boost::add_edge(3, 4, {1.0}, g);
+    boost::add_edge(4, 5, {1.0}, g);
+    boost::add_edge(3, 5, {1.0}, g);
+    boost::add_edge(2, 3, {2.0}, g);
+
+    auto csr = boost::louvain_detail::to_csr(g, get(boost::edge_weight, g), get(boost::vertex_index, g), 2);
+    std::vector<std::size_t> community = {4, 4, 4, 1, 1, 1};
+    auto coarse = boost::louvain_detail::parallel_aggregate(csr, community, 2);
+
+    BOOST_TEST_EQ(coarse.size(), 2u);
+    BOOST_TEST(community == std::vector<std::size_t>({0, 0, 0, 1, 1, 1}));
+    BOOST_TEST_EQ(coarse.self_loops[0], 6.0);
+    BOOST_TEST_EQ(coarse.self_loops[1], 6.0);
+    BOOST_TEST(coarse.offsets == std::vector<std::size_t>({0, 1, 2}));
+    BOOST_TEST(coarse.targets == std::vector<std::size_t>({1, 0}));
+    BOOST_TEST_EQ(coarse.weights[0], 2.0);
+    BOOST_TEST_EQ(coarse.weights[1], 2.0);
+}
+
+void test_small()
+{
+    Graph empty;
+    boost::static_property_map<double, edge_descriptor> weight_map(1.0);
+    std::vector<std::size_t> none;
+    std::mt19937 gen(1);
+    BOOST_TEST_EQ(boost::parallel_louvain_clustering(empty, none.data(), weight_map, gen), 0.0);
+
+    Graph g(3);
+    std::vector<std::size_t> clusters(3, 7);
+    BOOST_TEST_EQ(boost::parallel_louvain_clustering(g, clusters.data(), weight_map, gen), 0.0);
+    BOOST_TEST(clusters == std::vector<std::size_t>({0, 1, 2}));
+}
+
+int main()
+{
+    test_planted_partition();
+    test_ring_of_cliques();
+    test_list_graph();
+    test_parallel_aggregate();
+    test_small();
+    return boost::report_errors();
+}
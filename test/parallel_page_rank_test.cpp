@@ -0,0 +1,182 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#include <boost/graph/page_rank.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+typedef std::pair< std::size_t, std::size_t > Edge;
+typedef boost::adjacency_list< boost::vecS, boost::vecS,
+    boost::bidirectionalS >
+    Graph;
+typedef boost::compressed_sparse_row_graph< boost::directedS > CSR;
+typedef boost::compressed_sparse_row_graph< boost::bidirectionalS > BidirCSR;
+
+// Random edges; the vertices above n / 2 get no out-edges
+std::vector< Edge > make_edges(std::size_t n, std::size_t m, int seed)
+{
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_int_distribution< std::size_t > src(0, n / 2);
+    boost::random::uniform_int_distribution< std::size_t > tgt(0, n - 1);
+    std::vector< Edge > edges;
+    for (std::size_t i = 0; i < m; ++i)
+        edges.push_back(Edge(src(gen), tgt(gen)));
+    return edges;
+}
+
+// Plain power iteration, with the rank of dangling vertices following
+// the personalization
+std::vector< double > reference(std::size_t n, const std::vector< Edge >& edges,
+    std::vector< double > p, double damping, std::size_t iterations)
+{
+    if (p.empty())
+        p.assign(n, 1.0 / n);
+    std::vector< std::size_t > out(n);
+    for (std::size_t i = 0; i < edges.size(); ++i)
+        ++out[edges[i].first];
+    std::vector< double > rank(p), next(n);
+    for (std::size_t k = 0; k < iterations; ++k)
+    {
+        double dangling = 0;
+        for (std::size_t v = 0; v < n; ++v)
+            if (out[v] == 0)
+                dangling += rank[v];
+        for (std::size_t v = 0; v < n; ++v)
+            next[v] = (1 - damping + damping * dangling) * p[v];
+        for (std::size_t i = 0; i < edges.size(); ++i)
+            next[edges[i].second]
+                += damping * rank[edges[i].first] / out[edges[i].first];
+        rank.swap(next);
+    }
+    return rank;
+}
+
+bool close(const std::vector< double >& x, const std::vector< double >& y)
+{
+    for (std::size_t i = 0; i < x.size(); ++i)
+        if (std::abs(x[i] - y[i]) > 1e-12)
+            return false;
+    return x.size() == y.size();
+}
+
+double sum(const std::vector< double >& x)
+{
+    double s = 0;
+    for (std::size_t i = 0; i < x.size(); ++i)
+        s += x[i];
+    return s;
+}
+
+template < typename G >
+void test_graph(const G& g, std::size_t n, const std::vector< Edge >& edges)
+{
+    const std::vector< double > expected
+        = reference(n, edges, std::vector< double >(), 0.85, 30);
+    std::vector< double > first(n);
+    BOOST_TEST_EQ(boost::graph::parallel_page_rank(g, first.data(),
+                      boost::graph::n_iterations(30), 0.85, 1),
+        30u);
+    BOOST_TEST(close(first, expected));
+    BOOST_TEST(std::abs(sum(first) - 1) < 1e-12);
+
+    // The same bits on any number of threads
+    for (std::size_t threads = 2; threads < 5; ++threads)
+    {
+        std::vector< double > rank(n);
+        boost::graph::parallel_page_rank(g, rank.data(),
+            boost::graph::n_iterations(30), 0.85,
+            get(boost::vertex_index, g), threads);
+        BOOST_TEST(rank == first);
+    }
+
+    // Converged ranks change little under further iteration
+    std::vector< double > converged(n);
+    const std::size_t iterations
+        = boost::graph::parallel_page_rank(g, converged.data());
+    BOOST_TEST(iterations > 1 && iterations < 1000);
+    const std::vector< double > more = reference(n, edges,
+        std::vector< double >(), 0.85, iterations + 100);
+    double error = 0;
+    for (std::size_t v = 0; v < n; ++v)
+        error += std::abs(converged[v] - more[v]);
+    BOOST_TEST(error < 1e-5);
+
+    // All of the personalization on vertex 0
+    std::vector< double > p(n, 0.0), personalized(n);
+    p[0] = 4;
+    boost::graph::parallel_personalized_page_rank(g, personalized.data(),
+        p.data(), boost::graph::n_iterations(30), 0.5, 3);
+    p[0] = 1;
+    BOOST_TEST(close(personalized, reference(n, edges, p, 0.5, 30)));
+}
+
+void test_against_page_rank()
+{
+    // Without dangling vertices, page_rank computes n times the ranks
+    const std::size_t n = 50;
+    Graph g(n);
+    boost::minstd_rand gen(9);
+    boost::random::uniform_int_distribution< std::size_t > vdist(0, n - 1);
+    for (std::size_t v = 0; v < n; ++v)
+    {
+        add_edge(v, (v + 1) % n, g);
+        add_edge(v, vdist(gen), g);
+    }
+    std::vector< double > old_rank(n), rank(n);
+    boost::graph::page_rank(
+        g, old_rank.data(), boost::graph::n_iterations(200));
+    boost::graph::parallel_page_rank(g, rank.data(),
+        boost::graph::l1_residual(1e-14), 0.85, 2);
+    for (std::size_t v = 0; v < n; ++v)
+        BOOST_TEST(std::abs(rank[v] * n - old_rank[v]) < 1e-9);
+}
+
+void test_small_and_invalid()
+{
+    Graph empty;
+    std::vector< double > none;
+    BOOST_TEST_EQ(boost::graph::parallel_page_rank(empty, none.data()), 0u);
+
+    Graph g(3);
+    std::vector< double > rank(3), p(3, 0.0);
+    BOOST_TEST_EQ(boost::graph::parallel_page_rank(g, rank.data()), 1u);
+    BOOST_TEST(std::abs(rank[0] - 1.0 / 3) < 1e-15);
+    BOOST_TEST_THROWS(boost::graph::parallel_personalized_page_rank(
+                          g, rank.data(), p.data()),
+        std::invalid_argument);
+    p[1] = -1;
+    p[2] = 2;
+    BOOST_TEST_THROWS(boost::graph::parallel_personalized_page_rank(
+                          g, rank.data(), p.data()),
+        std::invalid_argument);
+}
+
+int main()
+{
+    // More vertices than one chunk of work
+    const std::size_t n = 10000;
+    const std::vector< Edge > edges = make_edges(n, 60000, 1);
+    Graph g(edges.begin(), edges.end(), n);
+    test_graph(g, n, edges);
+    CSR csr(boost::edges_are_unsorted_multi_pass, edges.begin(), edges.end(),
+        n);
+    test_graph(csr, n, edges);
+    BidirCSR bidir(boost::edges_are_unsorted_multi_pass, edges.begin(),
+        edges.end(), n);
+    test_graph(bidir, n, edges);
+    test_against_page_rank();
+    test_small_and_invalid();
+    return boost::report_errors();
+}
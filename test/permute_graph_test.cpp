@@ -0,0 +1,229 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/locality_ordering.hpp>
+#include <boost/graph/iteration_macros.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <iterator>
+#include <set>
+#include <utility>
+#include <vector>
+
+struct VertexData
+{
+    std::size_t original;
+};
+
+struct EdgeData
+{
+    std::size_t from;
+    std::size_t to;
+};
+
+typedef boost::compressed_sparse_row_graph< boost::directedS, VertexData,
+    EdgeData >
+    DirectedCSR;
+typedef boost::compressed_sparse_row_graph< boost::bidirectionalS,
+    VertexData, EdgeData >
+    BidirCSR;
+typedef std::vector< std::pair< std::size_t, std::size_t > > EdgeList;
+
+// Two dense communities per block of 20 vertices, with vertex numbers
+// scattered so that the input has poor locality
+void make_clustered_edges(std::size_t n, EdgeList& edges,
+    std::vector< EdgeData >& props, std::vector< std::size_t >& scatter)
+{
+    boost::minstd_rand gen(5);
+    scatter.resize(n);
+    for (std::size_t i = 0; i < n; ++i)
+        scatter[i] = i;
+    for (std::size_t i = n - 1; i > 0; --i)
+    {
+        boost::random::uniform_int_distribution< std::size_t > pick(0, i);
+        std::swap(scatter[i], scatter[pick(gen)]);
+    }
+    boost::random::uniform_int_distribution< std::size_t > in_block(0, 19);
+    for (std::size_t i = 0; i < 8 * n; ++i)
+    {
+        std::size_t block = (i % n) / 20 * 20;
+        std::size_t u = std::min(n - 1, block + in_block(gen));
+        std::size_t v = std::min(n - 1, block + in_block(gen));
+        EdgeData d = { scatter[u], scatter[v] };
+        edges.push_back(std::make_pair(scatter[u], scatter[v]));
+        props.push_back(d);
+    }
+}
+
+template < typename Graph >
+void label_vertices(Graph& g)
+{
+    BGL_FORALL_VERTICES_T(v, g, Graph) g[v].original = v;
+}
+
+// Every edge and bundle of g, expressed in the original vertex numbers
+template < typename Graph >
+std::multiset< std::pair< std::size_t, std::size_t > > original_edges(
+    const Graph& g)
+{
+    std::multiset< std::pair< std::size_t, std::size_t > > result;
+    BGL_FORALL_EDGES_T(e, g, Graph)
+    {
+        std::size_t u = g[source(e, g)].original;
+        std::size_t v = g[target(e, g)].original;
+        BOOST_TEST_EQ(g[e].from, u);
+        BOOST_TEST_EQ(g[e].to, v);
+        result.insert(std::make_pair(u, v));
+    }
+    return result;
+}
+
+// Average distance between the endpoints of each edge
+template < typename Graph > double edge_span(const Graph& g)
+{
+    double total = 0;
+    BGL_FORALL_EDGES_T(e, g, Graph)
+    total += std::abs(double(source(e, g)) - double(target(e, g)));
+    return total / num_edges(g);
+}
+
+template < typename Graph >
+bool is_permutation_of_vertices(
+    const Graph& g, const std::vector< std::size_t >& inverse)
+{
+    std::vector< std::size_t > sorted(inverse);
+    std::sort(sorted.begin(), sorted.end());
+    for (std::size_t i = 0; i < sorted.size(); ++i)
+        if (sorted[i] != i)
+            return false;
+    return sorted.size() == num_vertices(g);
+}
+
+template < typename Graph > void test_orderings()
+{
+    const std::size_t n = 400;
+    EdgeList edge_list;
+    std::vector< EdgeData > props;
+    std::vector< std::size_t > scatter;
+    make_clustered_edges(n, edge_list, props, scatter);
+    Graph g(boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), props.begin(), n);
+    label_vertices(g);
+    std::multiset< std::pair< std::size_t, std::size_t > > expected
+        = original_edges(g);
+    double scattered_span = edge_span(g);
+
+    // Gorder
+    std::vector< std::size_t > inverse;
+    boost::gorder_ordering(g, std::back_inserter(inverse));
+    BOOST_TEST(is_permutation_of_vertices(g, inverse));
+    std::vector< std::size_t > perm(n);
+    boost::invert_permutation(inverse.begin(), inverse.end(),
+        boost::make_iterator_property_map(
+            perm.begin(), get(boost::vertex_index, g)));
+    boost::permute_graph(g, boost::make_iterator_property_map(
+                                perm.begin(), get(boost::vertex_index, g)));
+    BOOST_TEST(original_edges(g) == expected);
+    for (std::size_t v = 0; v < n; ++v)
+        BOOST_TEST_EQ(g[v].original, inverse[v]);
+    // The communities end up in nearby positions again
+    BOOST_TEST(edge_span(g) * 4 < scattered_span);
+
+    // Degree sort
+    inverse.clear();
+    boost::degree_sort_ordering(g, std::back_inserter(inverse));
+    BOOST_TEST(is_permutation_of_vertices(g, inverse));
+    boost::invert_permutation(inverse.begin(), inverse.end(),
+        boost::make_iterator_property_map(
+            perm.begin(), get(boost::vertex_index, g)));
+    boost::permute_graph(g, boost::make_iterator_property_map(
+                                perm.begin(), get(boost::vertex_index, g)));
+    BOOST_TEST(original_edges(g) == expected);
+    for (std::size_t v = 1; v < n; ++v)
+        BOOST_TEST(out_degree(v - 1, g) >= out_degree(v, g));
+}
+
+void test_bidirectional_in_edges()
+{
+    EdgeList edge_list;
+    std::vector< EdgeData > props;
+    std::vector< std::size_t > scatter;
+    make_clustered_edges(100, edge_list, props, scatter);
+    BidirCSR g(boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), props.begin(), 100);
+    label_vertices(g);
+
+    // Reverse the vertex numbering
+    std::vector< std::size_t > perm(100);
+    for (std::size_t v = 0; v < 100; ++v)
+        perm[v] = 99 - v;
+    boost::permute_graph(g, boost::make_iterator_property_map(
+                                perm.begin(), get(boost::vertex_index, g)));
+    BGL_FORALL_VERTICES(v, g, BidirCSR)
+    {
+        BOOST_TEST_EQ(g[v].original, 99 - v);
+        BGL_FORALL_INEDGES(v, e, g, BidirCSR)
+        {
+            BOOST_TEST_EQ(target(e, g), v);
+            BOOST_TEST_EQ(g[e].to, g[v].original);
+            BOOST_TEST_EQ(g[e].from, g[source(e, g)].original);
+        }
+    }
+}
+
+void test_edge_order_kept()
+{
+    // Out-edges of each vertex keep their relative order, parallel edges
+    // included
+    typedef boost::compressed_sparse_row_graph< boost::directedS,
+        boost::no_property, int >
+        Graph;
+    EdgeList edge_list;
+    edge_list.push_back(std::make_pair(0u, 2u));
+    edge_list.push_back(std::make_pair(0u, 1u));
+    edge_list.push_back(std::make_pair(0u, 2u));
+    edge_list.push_back(std::make_pair(2u, 0u));
+    int props[] = { 10, 11, 12, 13 };
+    Graph g(boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), props, 3);
+    std::size_t perm[] = { 2, 0, 1 };
+    boost::permute_graph(g,
+        boost::make_iterator_property_map(perm, get(boost::vertex_index, g)));
+    BOOST_TEST_EQ(out_degree(std::size_t(2), g), 3u);
+    std::vector< int > row;
+    std::vector< std::size_t > targets;
+    BGL_FORALL_OUTEDGES(std::size_t(2), e, g, Graph)
+    {
+        row.push_back(g[e]);
+        targets.push_back(target(e, g));
+    }
+    BOOST_TEST_EQ(row[0], 10);
+    BOOST_TEST_EQ(row[1], 11);
+    BOOST_TEST_EQ(row[2], 12);
+    BOOST_TEST_EQ(targets[0], 1u);
+    BOOST_TEST_EQ(targets[1], 0u);
+    BOOST_TEST_EQ(targets[2], 1u);
+    BOOST_TEST_EQ(out_degree(std::size_t(1), g), 1u);
+    // Edge indices follow the new row order
+    BOOST_TEST_EQ(g[*out_edges(std::size_t(1), g).first], 13);
+    BOOST_TEST_EQ(
+        get(boost::edge_index, g, *out_edges(std::size_t(1), g).first), 0u);
+}
+
+int main()
+{
+    test_orderings< DirectedCSR >();
+    test_orderings< BidirCSR >();
+    test_bidirectional_in_edges();
+    test_edge_order_kept();
+    return boost::report_errors();
+}
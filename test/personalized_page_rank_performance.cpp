@@ -0,0 +1,99 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Times personalized_page_rank_push queries from random seeds, reusing
+// one workspace, against one run of parallel_personalized_page_rank, for
+// a random directed CSR graph.
+//
+// Usage: personalized_page_rank_performance [num_vertices [average_degree
+//        [epsilon [queries]]]]
+
+#include <boost/graph/personalized_page_rank.hpp>
+#include <boost/graph/page_rank.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+typedef boost::compressed_sparse_row_graph< boost::directedS > Graph;
+
+int main(int argc, char* argv[])
+{
+    std::size_t n = 1000000;
+    std::size_t degree = 8;
+    double epsilon = 1e-4;
+    std::size_t queries = 1000;
+    if (argc > 1)
+        n = boost::lexical_cast< std::size_t >(argv[1]);
+    if (argc > 2)
+        degree = boost::lexical_cast< std::size_t >(argv[2]);
+    if (argc > 3)
+        epsilon = boost::lexical_cast< double >(argv[3]);
+    if (argc > 4)
+        queries = boost::lexical_cast< std::size_t >(argv[4]);
+
+    boost::minstd_rand gen(5);
+    boost::random::uniform_int_distribution< std::size_t > vdist(0, n - 1);
+    std::vector< std::pair< std::size_t, std::size_t > > edge_list;
+    for (std::size_t i = 0; i < n * degree; ++i)
+        edge_list.push_back(std::make_pair(vdist(gen), vdist(gen)));
+    Graph g(boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), n);
+
+    typedef std::chrono::steady_clock clock;
+    const std::size_t seed = vdist(gen);
+    std::vector< double > rank(n), p(n, 0.0);
+    p[seed] = 1;
+    clock::time_point start = clock::now();
+    boost::graph::parallel_personalized_page_rank(
+        g, rank.data(), p.data(), boost::graph::l1_residual(1e-6));
+    const double full_seconds
+        = std::chrono::duration< double >(clock::now() - start).count();
+
+    boost::graph::personalized_page_rank_workspace< Graph > ws;
+    boost::graph::personalized_page_rank_push(g, seed, epsilon, ws);
+    // The estimates miss the residual mass left
+    double error = 0, left = 0;
+    for (std::size_t v = 0; v < n; ++v)
+    {
+        error += rank[v] - ws.estimate(v);
+        left += ws.residual(v);
+    }
+    BOOST_TEST(std::abs(error - left) < 1e-5);
+
+    std::size_t pushes = 0, touched = 0;
+    start = clock::now();
+    for (std::size_t q = 0; q < queries; ++q)
+    {
+        pushes += boost::graph::personalized_page_rank_push(
+            g, vdist(gen), epsilon, ws);
+        touched += ws.residuals().size();
+    }
+    const double push_seconds
+        = std::chrono::duration< double >(clock::now() - start).count();
+
+    std::cout << n << " vertices, " << num_edges(g) << " edges, epsilon "
+              << epsilon << "\n"
+              << std::setprecision(3) << std::left << std::setw(40)
+              << "parallel_personalized_page_rank" << std::right
+              << std::setw(10) << full_seconds * 1000 << " ms\n"
+              << std::left << std::setw(40)
+              << "personalized_page_rank_push, mean" << std::right
+              << std::setw(10) << push_seconds * 1000 / queries << " ms, "
+              << pushes / queries << " pushes, " << touched / queries
+              << " vertices touched\n"
+              << "L1 error of one query: " << error << "\n";
+    return boost::report_errors();
+}
@@ -0,0 +1,126 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#include <boost/graph/personalized_page_rank.hpp>
+#include <boost/graph/page_rank.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+typedef std::pair< std::size_t, std::size_t > Edge;
+typedef boost::compressed_sparse_row_graph< boost::directedS > CSR;
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::undirectedS >
+    UGraph;
+
+// Random edges; the vertices above n / 2 get no out-edges
+std::vector< Edge > make_edges(std::size_t n, std::size_t m, int seed)
+{
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_int_distribution< std::size_t > src(0, n / 2);
+    boost::random::uniform_int_distribution< std::size_t > tgt(0, n - 1);
+    std::vector< Edge > edges;
+    for (std::size_t i = 0; i < m; ++i)
+        edges.push_back(Edge(src(gen), tgt(gen)));
+    return edges;
+}
+
+template < typename G >
+void check_query(const G& g, std::size_t seed, double epsilon,
+    boost::graph::personalized_page_rank_workspace< G >& ws)
+{
+    const std::size_t n = num_vertices(g);
+    const double damping = 0.85;
+    std::vector< double > exact(n), p(n, 0.0);
+    p[seed] = 1;
+    boost::graph::parallel_personalized_page_rank(g, exact.data(), p.data(),
+        boost::graph::l1_residual(1e-14), damping, 1);
+
+    const std::size_t pushes
+        = boost::graph::personalized_page_rank_push(g, seed, epsilon, ws);
+    BOOST_TEST(pushes > 0);
+    BOOST_TEST(pushes <= 1 / (epsilon * (1 - damping)));
+    BOOST_TEST(ws.estimates().size() <= ws.residuals().size());
+
+    // The estimates fall short of the exact ranks by exactly the
+    // residual mass left, which is small at every vertex
+    double missing = 0, left = 0;
+    bool below = true, small = true;
+    for (std::size_t v = 0; v < n; ++v)
+    {
+        below = below && ws.estimate(v) <= exact[v] + 1e-12;
+        missing += exact[v] - ws.estimate(v);
+        const std::size_t d = out_degree(v, g);
+        small = small && ws.residual(v) <= epsilon * (d == 0 ? 1 : d);
+        left += ws.residual(v);
+    }
+    BOOST_TEST(below);
+    BOOST_TEST(small);
+    BOOST_TEST(std::abs(missing - left) < 1e-9);
+}
+
+void test_directed()
+{
+    const std::size_t n = 5000;
+    const std::vector< Edge > edges = make_edges(n, 20000, 1);
+    CSR g(boost::edges_are_unsorted_multi_pass, edges.begin(), edges.end(),
+        n);
+    boost::graph::personalized_page_rank_workspace< CSR > ws;
+    check_query(g, 0, 1e-4, ws);
+    // A query touches few vertices for a large epsilon
+    check_query(g, 10, 1e-2, ws);
+    BOOST_TEST(ws.residuals().size() < n / 10);
+    // A dangling seed
+    check_query(g, n - 1, 1e-5, ws);
+
+    // A reused workspace gives the results of a new one
+    boost::graph::personalized_page_rank_workspace< CSR > fresh;
+    boost::graph::personalized_page_rank_push(g, 10, 1e-3, ws);
+    boost::graph::personalized_page_rank_push(g, 10, 1e-3, fresh);
+    BOOST_TEST(ws.estimates() == fresh.estimates());
+    BOOST_TEST(ws.residuals() == fresh.residuals());
+}
+
+void test_undirected()
+{
+    const std::vector< Edge > edges = make_edges(2000, 6000, 2);
+    UGraph g(edges.begin(), edges.end(), 2000);
+    boost::graph::personalized_page_rank_workspace< UGraph > ws;
+    check_query(g, 3, 1e-5, ws);
+}
+
+void test_invalid()
+{
+    UGraph g(2);
+    boost::graph::personalized_page_rank_workspace< UGraph > ws;
+    BOOST_TEST_THROWS(
+        boost::graph::personalized_page_rank_push(g, 0, 0.0, ws),
+        std::invalid_argument);
+    BOOST_TEST_THROWS(
+        boost::graph::personalized_page_rank_push(g, 0, 0.1, ws, 1.0),
+        std::invalid_argument);
+
+    // An isolated seed keeps its mass
+    BOOST_TEST_EQ(boost::graph::personalized_page_rank_push(g, 0, 0.5, ws),
+        5u);
+    BOOST_TEST(std::abs(ws.estimate(0) + ws.residual(0) - 1) < 1e-15);
+    BOOST_TEST_EQ(ws.estimate(1), 0.0);
+}
+
+int main()
+{
+    test_directed();
+    test_undirected();
+    test_invalid();
+    return boost::report_errors();
+}
@@ -0,0 +1,162 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// Compares traversal throughput on compressed_sparse_row_graph with its
+// arrays allocated under each memory_placement policy: sequential BFS, and
+// a multithreaded pass in which each thread sums the neighbor values of a
+// contiguous block of vertices (the access pattern of pull-style PageRank).
+// NUMA policies only differ on machines with several nodes.
+//
+// Usage: placement_allocator_performance [num_vertices [average_degree
+//            [num_threads]]]
+
+#include <boost/graph/placement_allocator.hpp>
+#include <boost/graph/breadth_first_search.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/detail/parallel_for.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+typedef std::vector< std::pair< std::size_t, std::size_t > > EdgeList;
+
+struct benchmark_results
+{
+    double build_seconds;
+    double bfs_seconds;
+    double pull_seconds;
+    double checksum;
+};
+
+template < unsigned Placement >
+benchmark_results run_benchmark(std::size_t n, const EdgeList& edge_list,
+    std::size_t num_threads, int repeats)
+{
+    typedef boost::compressed_sparse_row_graph< boost::directedS,
+        boost::no_property, boost::no_property, boost::no_property,
+        std::size_t, std::size_t,
+        boost::placement_allocator< bool, Placement > >
+        Graph;
+    typedef std::chrono::steady_clock clock;
+    typedef boost::placement_allocator< double, Placement > DoubleAlloc;
+    benchmark_results r;
+
+    clock::time_point start = clock::now();
+    Graph g(boost::edges_are_unsorted_parallel_t(num_threads),
+        edge_list.begin(), edge_list.end(), n);
+    r.build_seconds
+        = std::chrono::duration< double >(clock::now() - start).count();
+
+    std::vector< std::size_t > hops(n);
+    start = clock::now();
+    for (int i = 0; i < repeats; ++i)
+        boost::breadth_first_search(g, vertex(i, g),
+            boost::visitor(boost::make_bfs_visitor(boost::record_distances(
+                boost::make_iterator_property_map(
+                    hops.begin(), get(boost::vertex_index, g)),
+                boost::on_tree_edge()))));
+    r.bfs_seconds
+        = std::chrono::duration< double >(clock::now() - start).count();
+
+    std::vector< double, DoubleAlloc > value(n, 1.0), next(n);
+    start = clock::now();
+    for (int i = 0; i < repeats; ++i)
+    {
+        boost::graph::detail::parallel_for_blocks(n, num_threads,
+            [&](std::size_t, std::size_t begin, std::size_t end) {
+                for (std::size_t v = begin; v != end; ++v)
+                {
+                    double sum = 0;
+                    typename boost::graph_traits< Graph >::adjacency_iterator
+                        ai,
+                        ai_end;
+                    for (boost::tie(ai, ai_end) = adjacent_vertices(v, g);
+                         ai != ai_end; ++ai)
+                        sum += value[*ai];
+                    next[v] = 0.5 + 0.5 * sum / double(n);
+                }
+            });
+        value.swap(next);
+    }
+    r.pull_seconds
+        = std::chrono::duration< double >(clock::now() - start).count();
+
+    r.checksum = 0;
+    for (std::size_t v = 0; v < n; ++v)
+        r.checksum += value[v] + double(hops[v]);
+    return r;
+}
+
+void report(const char* name, const benchmark_results& r, std::size_t m,
+    int repeats)
+{
+    std::cout << std::left << std::setw(22) << name << std::right
+              << std::setprecision(3) << std::setw(10) << r.build_seconds
+              << std::setw(12) << m * repeats / r.bfs_seconds / 1e6
+              << std::setw(12) << m * repeats / r.pull_seconds / 1e6 << "\n";
+}
+
+int main(int argc, char* argv[])
+{
+    std::size_t n = 4000000;
+    std::size_t degree = 16;
+    std::size_t num_threads = 0;
+    if (argc > 1)
+        n = boost::lexical_cast< std::size_t >(argv[1]);
+    if (argc > 2)
+        degree = boost::lexical_cast< std::size_t >(argv[2]);
+    if (argc > 3)
+        num_threads = boost::lexical_cast< std::size_t >(argv[3]);
+    const int repeats = 3;
+
+    boost::minstd_rand gen(1);
+    boost::random::uniform_int_distribution< std::size_t > vdist(0, n - 1);
+    EdgeList edge_list;
+    for (std::size_t i = 0; i < n * degree; ++i)
+        edge_list.push_back(std::make_pair(vdist(gen), vdist(gen)));
+    const std::size_t m = edge_list.size();
+
+    std::cout << n << " vertices, " << m << " edges, " << repeats
+              << " repeats\n"
+              << std::left << std::setw(22) << "placement" << std::right
+              << std::setw(10) << "build s" << std::setw(12) << "BFS Me/s"
+              << std::setw(12) << "pull Me/s" << "\n";
+
+    benchmark_results base = run_benchmark< boost::default_placement >(
+        n, edge_list, num_threads, repeats);
+    report("default", base, m, repeats);
+
+    benchmark_results huge = run_benchmark< boost::huge_page_placement >(
+        n, edge_list, num_threads, repeats);
+    report("huge pages", huge, m, repeats);
+    BOOST_TEST_EQ(base.checksum, huge.checksum);
+
+    benchmark_results interleaved
+        = run_benchmark< boost::interleaved_placement >(
+            n, edge_list, num_threads, repeats);
+    report("interleaved", interleaved, m, repeats);
+    BOOST_TEST_EQ(base.checksum, interleaved.checksum);
+
+    benchmark_results partitioned
+        = run_benchmark< boost::partitioned_placement >(
+            n, edge_list, num_threads, repeats);
+    report("partitioned", partitioned, m, repeats);
+    BOOST_TEST_EQ(base.checksum, partitioned.checksum);
+
+    benchmark_results both = run_benchmark< boost::huge_page_placement
+        | boost::interleaved_placement >(n, edge_list, num_threads, repeats);
+    report("huge + interleaved", both, m, repeats);
+    BOOST_TEST_EQ(base.checksum, both.checksum);
+    return boost::report_errors();
+}
@@ -0,0 +1,209 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#include <boost/graph/placement_allocator.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/breadth_first_search.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/iteration_macros.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+struct EdgeData
+{
+    std::size_t source;
+};
+
+typedef std::vector< std::pair< std::size_t, std::size_t > > EdgeList;
+
+void make_random_edges(std::size_t n, std::size_t m, EdgeList& edges)
+{
+    boost::minstd_rand gen(11);
+    boost::random::uniform_int_distribution< std::size_t > any(0, n - 1);
+    for (std::size_t i = 0; i < m; ++i)
+        edges.push_back(std::make_pair(any(gen), any(gen)));
+}
+
+template < typename Graph >
+std::vector< std::size_t > bfs_distances(const Graph& g)
+{
+    std::vector< std::size_t > dist(num_vertices(g), 0);
+    boost::breadth_first_search(g, vertex(0, g),
+        boost::visitor(boost::make_bfs_visitor(boost::record_distances(
+            boost::make_iterator_property_map(
+                dist.begin(), get(boost::vertex_index, g)),
+            boost::on_tree_edge()))));
+    return dist;
+}
+
+template < unsigned Placement > void test_allocator()
+{
+    typedef boost::placement_allocator< double, Placement > Alloc;
+    Alloc alloc;
+    // Large enough to be mapped directly, small enough for operator new
+    const std::size_t sizes[] = { std::size_t(1) << 20, 1000, 0 };
+    for (std::size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s)
+    {
+        std::size_t n = sizes[s];
+        double* p = alloc.allocate(n);
+        for (std::size_t i = 0; i < n; ++i)
+            p[i] = double(i);
+        std::size_t bad = 0;
+        for (std::size_t i = 0; i < n; ++i)
+            bad += p[i] != double(i);
+        BOOST_TEST_EQ(bad, 0u);
+#if defined(__linux__)
+        if ((Placement & boost::huge_page_placement) && n >= 1u << 20)
+            BOOST_TEST_EQ(std::size_t(p) % (std::size_t(1) << 21), 0u);
+#endif
+        alloc.deallocate(p, n);
+    }
+
+    // Rebinding keeps the policy, and all instances compare equal
+    typename Alloc::template rebind< int >::other ints(alloc);
+    BOOST_TEST(ints == Alloc());
+    std::vector< int, typename Alloc::template rebind< int >::other > v(
+        std::size_t(1) << 18, 7);
+    v.resize(std::size_t(1) << 19, 8);
+    BOOST_TEST_EQ(v.front(), 7);
+    BOOST_TEST_EQ(v.back(), 8);
+}
+
+template < unsigned Placement > void test_csr()
+{
+    typedef boost::compressed_sparse_row_graph< boost::bidirectionalS,
+        boost::no_property, EdgeData, boost::no_property, std::size_t,
+        std::size_t, boost::placement_allocator< bool, Placement > >
+        PlacedCSR;
+    typedef boost::compressed_sparse_row_graph< boost::bidirectionalS,
+        boost::no_property, EdgeData >
+        CSR;
+    BOOST_CONCEPT_ASSERT((boost::IncidenceGraphConcept< PlacedCSR >));
+    BOOST_CONCEPT_ASSERT((boost::AdjacencyGraphConcept< PlacedCSR >));
+
+    const std::size_t n = 50000;
+    EdgeList edge_list;
+    make_random_edges(n, 200000, edge_list);
+    std::vector< EdgeData > props;
+    for (std::size_t i = 0; i < edge_list.size(); ++i)
+    {
+        EdgeData d = { edge_list[i].first };
+        props.push_back(d);
+    }
+    PlacedCSR g(boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), props.begin(), n);
+    CSR reference(boost::edges_are_unsorted_multi_pass, edge_list.begin(),
+        edge_list.end(), props.begin(), n);
+    BOOST_TEST_EQ(num_edges(g), num_edges(reference));
+    BOOST_TEST(bfs_distances(g) == bfs_distances(reference));
+    std::size_t bad = 0;
+    BGL_FORALL_VERTICES_T(v, g, PlacedCSR)
+    {
+        BGL_FORALL_INEDGES_T(v, e, g, PlacedCSR)
+        bad += g[e].source != source(e, g);
+    }
+    BOOST_TEST_EQ(bad, 0u);
+
+    // Relabeling keeps the placed storage consistent
+    std::vector< std::size_t > perm(n);
+    for (std::size_t v = 0; v < n; ++v)
+        perm[v] = n - 1 - v;
+    boost::permute_graph(g,
+        boost::make_iterator_property_map(
+            perm.begin(), get(boost::vertex_index, g)));
+    BOOST_TEST_EQ(in_degree(n - 1, g), in_degree(std::size_t(0), reference));
+}
+
+void test_csr_inplace()
+{
+    // The source and target vectors use std::allocator, so they are copied
+    // into the graph rather than swapped
+    typedef boost::compressed_sparse_row_graph< boost::directedS,
+        boost::no_property, int, boost::no_property, std::size_t,
+        std::size_t,
+        boost::placement_allocator< bool, boost::interleaved_placement > >
+        PlacedCSR;
+    std::vector< std::size_t > sources, targets;
+    std::vector< int > props;
+    for (std::size_t i = 0; i < 100000; ++i)
+    {
+        sources.push_back((i * 7919) % 1000);
+        targets.push_back(i % 1000);
+        props.push_back(int(i));
+    }
+    PlacedCSR g(boost::construct_inplace_from_sources_and_targets, sources,
+        targets, props, 1000);
+    BOOST_TEST_EQ(num_edges(g), 100000u);
+    BOOST_TEST(targets.empty());
+    BOOST_TEST(props.empty());
+    std::size_t bad = 0;
+    BGL_FORALL_EDGES(e, g, PlacedCSR)
+    bad += (std::size_t(g[e]) * 7919) % 1000 != source(e, g)
+        || std::size_t(g[e]) % 1000 != target(e, g);
+    BOOST_TEST_EQ(bad, 0u);
+
+    std::pair< std::size_t, std::size_t > extra[] = { std::make_pair(3u, 4u) };
+    int extra_props[] = { -1 };
+    add_edges(extra, extra + 1, extra_props, extra_props + 1, g);
+    BOOST_TEST_EQ(num_edges(g), 100001u);
+}
+
+void test_adjacency_list()
+{
+    typedef boost::adjacency_list< boost::vecS,
+        boost::vec_with_allocatorS< boost::placement_allocator< int,
+            boost::interleaved_placement | boost::huge_page_placement > >,
+        boost::bidirectionalS, boost::no_property, EdgeData >
+        PlacedList;
+    typedef boost::adjacency_list< boost::vecS, boost::vecS,
+        boost::bidirectionalS, boost::no_property, EdgeData >
+        List;
+    BOOST_CONCEPT_ASSERT((boost::BidirectionalGraphConcept< PlacedList >));
+    BOOST_CONCEPT_ASSERT((boost::MutableGraphConcept< PlacedList >));
+
+    const std::size_t n = 20000;
+    EdgeList edge_list;
+    make_random_edges(n, 60000, edge_list);
+    PlacedList g(n);
+    List reference(n);
+    for (std::size_t i = 0; i < edge_list.size(); ++i)
+    {
+        EdgeData d = { edge_list[i].first };
+        add_edge(edge_list[i].first, edge_list[i].second, d, g);
+        add_edge(edge_list[i].first, edge_list[i].second, d, reference);
+    }
+    BOOST_TEST(bfs_distances(g) == bfs_distances(reference));
+
+    remove_edge(edge_list[0].first, edge_list[0].second, g);
+    remove_edge(edge_list[0].first, edge_list[0].second, reference);
+    std::size_t v = add_vertex(g);
+    add_vertex(reference);
+    BOOST_TEST_EQ(v, n);
+    BOOST_TEST_EQ(num_edges(g), num_edges(reference));
+    BOOST_TEST(bfs_distances(g) == bfs_distances(reference));
+}
+
+int main()
+{
+    test_allocator< boost::default_placement >();
+    test_allocator< boost::huge_page_placement >();
+    test_allocator< boost::interleaved_placement >();
+    test_allocator< boost::partitioned_placement
+        | boost::huge_page_placement >();
+    test_csr< boost::huge_page_placement >();
+    test_csr< boost::interleaved_placement >();
+    test_csr< boost::partitioned_placement >();
+    test_csr_inplace();
+    test_adjacency_list();
+    return boost::report_errors();
+}
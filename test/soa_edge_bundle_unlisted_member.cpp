@@ -0,0 +1,32 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+// This file must FAIL to compile.
+// soa_edge_bundle stores only the listed members, so asking for a property
+// map over a member of a type that no stored member has is rejected.
+
+#include <boost/graph/soa_edge_bundle.hpp>
+#include <string>
+
+struct Road
+{
+    double weight;
+    std::string name;
+};
+
+int main()
+{
+    typedef boost::compressed_sparse_row_graph< boost::directedS,
+        boost::no_property,
+        boost::soa_edge_bundle< Road,
+            BOOST_GRAPH_BUNDLE_MEMBER(Road, weight) > >
+        Graph;
+    Graph g;
+    get(&Road::name, g);
+    return 0;
+}
@@ -0,0 +1,253 @@
+//=======================================================================
+// Copyright (C) 2026
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//=======================================================================
+
+#include <boost/graph/spfa_shortest_paths.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/bellman_ford_shortest_paths.hpp>
+#include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+
+typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::directedS,
+    boost::no_property, boost::property< boost::edge_weight_t, int > >
+    Graph;
+typedef boost::graph_traits< Graph >::vertex_descriptor Vertex;
+
+const int inf = (std::numeric_limits< int >::max)();
+
+// Random edges with weights w + p(u) - p(v) for w >= 0, so that every cycle
+// is non-negative although many edges are negative
+Graph make_graph(std::size_t n, std::size_t m, int seed)
+{
+    boost::minstd_rand gen(seed);
+    boost::random::uniform_int_distribution< std::size_t > vdist(0, n - 1);
+    boost::random::uniform_int_distribution< int > wdist(0, 20), pdist(0, 50);
+    std::vector< int > p(n);
+    for (std::size_t v = 0; v < n; ++v)
+        p[v] = pdist(gen);
+    Graph g(n);
+    for (std::size_t i = 0; i < m; ++i)
+    {
+        std::size_t u = vdist(gen), v = vdist(gen);
+        add_edge(u, v, wdist(gen) + p[u] - p[v], g);
+    }
+    return g;
+}
+
+std::vector< int > reference(const Graph& g, Vertex s)
+{
+    std::vector< int > d(num_vertices(g), inf);
+    d[s] = 0;
+    BOOST_TEST(boost::bellman_ford_shortest_paths(g, int(num_vertices(g)),
+        boost::distance_map(d.data())));
+    return d;
+}
+
+// The predecessors form a tree of tight edges
+void check_tree(const Graph& g, Vertex s, const std::vector< int >& d,
+    const std::vector< Vertex >& pred)
+{
+    for (Vertex v = 0; v < num_vertices(g); ++v)
+    {
+        if (v == s || d[v] == inf)
+        {
+            BOOST_TEST_EQ(pred[v], v);
+            continue;
+        }
+        bool tight = false;
+        boost::graph_traits< Graph >::out_edge_iterator ei, ei_end;
+        for (boost::tie(ei, ei_end) = out_edges(pred[v], g); ei != ei_end;
+             ++ei)
+            tight = tight
+                || (target(*ei, g) == v
+                    && d[pred[v]] + get(boost::edge_weight, g, *ei) == d[v]);
+        BOOST_TEST(tight);
+    }
+}
+
+// cycle is a cycle of g with negative weight
+template < typename G, typename W >
+bool negative_cycle(const G& g, const std::vector< Vertex >& cycle, W weight)
+{
+    if (cycle.empty())
+        return false;
+    double total = 0;
+    for (std::size_t i = 0; i < cycle.size(); ++i)
+    {
+        Vertex u = cycle[i], v = cycle[(i + 1) % cycle.size()];
+        bool found = false;
+        double best = 0;
+        typename boost::graph_traits< G >::out_edge_iterator ei, ei_end;
+        for (boost::tie(ei, ei_end) = out_edges(u, g); ei != ei_end; ++ei)
+            if (target(*ei, g) == v && (!found || get(weight, *ei) < best))
+            {
+                best = get(weight, *ei);
+                found = true;
+            }
+        if (!found)
+            return false;
+        total += best;
+    }
+    return total < 0;
+}
+
+void test_no_negative_cycle()
+{
+    Graph g = make_graph(500, 2500, 1);
+    for (Vertex s = 0; s < 500; s += 97)
+    {
+        std::vector< int > expected = reference(g, s);
+        std::size_t threads[] = { 0, 1, 2, 3, 4 };
+        for (std::size_t k = 0; k < 5; ++k)
+        {
+            std::vector< int > d(500);
+            std::vector< Vertex > pred(500), cycle;
+            bool ok = k == 0
+                ? boost::spfa_shortest_paths(g, s, get(boost::edge_weight, g),
+                    d.data(), pred.data(), get(boost::vertex_index, g),
+                    std::back_inserter(cycle))
+                : boost::parallel_bellman_ford_shortest_paths(g, s,
+                    get(boost::edge_weight, g), d.data(), pred.data(),
+                    get(boost::vertex_index, g), std::back_inserter(cycle),
+                    threads[k]);
+            BOOST_TEST(ok);
+            BOOST_TEST(cycle.empty());
+            BOOST_TEST(d == expected);
+            check_tree(g, s, d, pred);
+        }
+    }
+
+    // Named parameters, with the default distance map
+    std::vector< int > d(500);
+    BOOST_TEST(boost::spfa_shortest_paths(g, 3, boost::distance_map(d.data())));
+    BOOST_TEST(d == reference(g, 3));
+    std::vector< Vertex > pred(500);
+    BOOST_TEST(boost::parallel_bellman_ford_shortest_paths(
+        g, 3, boost::predecessor_map(pred.data()).num_threads(2)));
+    check_tree(g, 3, d, pred);
+}
+
+void test_negative_cycle()
+{
+    for (int seed = 2; seed < 8; ++seed)
+    {
+        Graph g = make_graph(400, 1600, seed);
+        // A cycle of total weight -1 far from the source
+        add_edge(350, 351, -40, g);
+        add_edge(351, 352, 19, g);
+        add_edge(352, 350, 20, g);
+        add_edge(0, 340, 5, g);
+        add_edge(340, 350, 5, g);
+        for (std::size_t threads = 0; threads < 4; ++threads)
+        {
+            std::vector< Vertex > cycle;
+            bool ok = threads == 0
+                ? boost::spfa_shortest_paths(g, 0, std::back_inserter(cycle),
+                    boost::weight_map(get(boost::edge_weight, g)))
+                : boost::parallel_bellman_ford_shortest_paths(g, 0,
+                    std::back_inserter(cycle),
+                    boost::weight_map(get(boost::edge_weight, g))
+                        .num_threads(threads));
+            BOOST_TEST(!ok);
+            BOOST_TEST(negative_cycle(g, cycle, get(boost::edge_weight, g)));
+        }
+
+        // Unreachable from the source: no cycle
+        Graph h(402);
+        add_edge(0, 1, -3, h);
+        add_edge(400, 401, -1, h);
+        add_edge(401, 400, -1, h);
+        std::vector< Vertex > cycle;
+        BOOST_TEST(boost::spfa_shortest_paths(h, 0, std::back_inserter(cycle),
+            boost::weight_map(get(boost::edge_weight, h))));
+        BOOST_TEST(boost::parallel_bellman_ford_shortest_paths(h, 0,
+            std::back_inserter(cycle),
+            boost::weight_map(get(boost::edge_weight, h))));
+        BOOST_TEST(cycle.empty());
+    }
+}
+
+void test_self_loop_and_undirected()
+{
+    Graph g(3);
+    add_edge(0, 1, 2, g);
+    add_edge(1, 1, -1, g);
+    add_edge(1, 2, 2, g);
+    for (std::size_t threads = 0; threads < 3; ++threads)
+    {
+        std::vector< Vertex > cycle;
+        bool ok = threads == 0
+            ? boost::spfa_shortest_paths(g, 0, std::back_inserter(cycle),
+                boost::weight_map(get(boost::edge_weight, g)))
+            : boost::parallel_bellman_ford_shortest_paths(g, 0,
+                std::back_inserter(cycle),
+                boost::weight_map(get(boost::edge_weight, g))
+                    .num_threads(threads));
+        BOOST_TEST(!ok);
+        BOOST_TEST_EQ(cycle.size(), 1u);
+        BOOST_TEST(negative_cycle(g, cycle, get(boost::edge_weight, g)));
+    }
+
+    // An undirected negative edge is a cycle of two edges
+    typedef boost::adjacency_list< boost::vecS, boost::vecS,
+        boost::undirectedS, boost::no_property,
+        boost::property< boost::edge_weight_t, int > >
+        UGraph;
+    UGraph u(4);
+    add_edge(0, 1, 3, u);
+    add_edge(1, 2, -1, u);
+    add_edge(2, 3, 3, u);
+    std::vector< Vertex > cycle;
+    BOOST_TEST(!boost::spfa_shortest_paths(u, 0, std::back_inserter(cycle),
+        boost::weight_map(get(boost::edge_weight, u))));
+    BOOST_TEST_EQ(cycle.size(), 2u);
+    BOOST_TEST(negative_cycle(u, cycle, get(boost::edge_weight, u)));
+}
+
+// Currency exchange: a cycle of rates whose product exceeds 1 is a
+// negative cycle of -log(rate)
+void test_arbitrage()
+{
+    typedef boost::compressed_sparse_row_graph< boost::directedS,
+        boost::no_property, double >
+        Market;
+    typedef std::pair< std::size_t, std::size_t > Pair;
+    const Pair pairs[] = { Pair(0, 1), Pair(1, 0), Pair(1, 2), Pair(2, 1),
+        Pair(0, 2), Pair(2, 0), Pair(2, 3), Pair(3, 0) };
+    const double rates[] = { 0.9, 1.1, 130.0, 0.0076, 118.0, 0.0084, 1.25,
+        0.0069 };
+    std::vector< double > cost;
+    for (std::size_t i = 0; i < 8; ++i)
+        cost.push_back(-std::log(rates[i]));
+    Market m(boost::edges_are_unsorted_multi_pass, pairs, pairs + 8,
+        cost.begin(), 4);
+    std::vector< double > d(4);
+    std::vector< Vertex > cycle;
+    BOOST_TEST(!boost::parallel_bellman_ford_shortest_paths(m, 0,
+        std::back_inserter(cycle),
+        boost::weight_map(get(boost::edge_bundle, m))
+            .distance_map(d.data())
+            .num_threads(2)));
+    BOOST_TEST(negative_cycle(m, cycle, get(boost::edge_bundle, m)));
+}
+
+int main()
+{
+    test_no_negative_cycle();
+    test_negative_cycle();
+    test_self_loop_and_undirected();
+    test_arbitrage();
+    return boost::report_errors();
+}